@@ -26,6 +26,8 @@ vtkAnimationPlayer::vtkAnimationPlayer()
   this->CurrentTime = 0;
   this->StopPlay = false;
   this->Loop = false;
+  this->FrameStride = 1;
+  this->FrameOffset = 0;
 }
 
 //----------------------------------------------------------------------------
@@ -93,6 +95,10 @@ void vtkAnimationPlayer::Play()
   {
     this->StartLoop(starttime, endtime, this->CurrentTime, playbackWindow);
     this->AnimationScene->Initialize();
+    for (int cc = 0; cc < this->FrameOffset && this->CurrentTime <= playbackWindow[1]; ++cc)
+    {
+      this->CurrentTime = this->GetNextTime(this->CurrentTime);
+    }
     double deltatime = 0.0;
     while (!this->StopPlay && this->CurrentTime <= playbackWindow[1])
     {
@@ -101,7 +107,12 @@ void vtkAnimationPlayer::Play()
         (this->CurrentTime - playbackWindow[0]) / (playbackWindow[1] - playbackWindow[0]);
       this->InvokeEvent(vtkCommand::ProgressEvent, &progress);
 
-      double nexttime = this->GetNextTime(this->CurrentTime);
+      // frames between the ones played are skipped without ticking the scene.
+      double nexttime = this->CurrentTime;
+      for (int cc = 0; cc < this->FrameStride && nexttime <= playbackWindow[1]; ++cc)
+      {
+        nexttime = this->GetNextTime(nexttime);
+      }
       deltatime = nexttime - this->CurrentTime;
       this->CurrentTime = nexttime;
     }
@@ -192,4 +203,6 @@ void vtkAnimationPlayer::GoToPrevious()
 void vtkAnimationPlayer::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "FrameStride: " << this->FrameStride << endl;
+  os << indent << "FrameOffset: " << this->FrameOffset << endl;
 }
@@ -66,6 +66,18 @@ public:
   vtkGetMacro(Loop, bool);
   //@}
 
+  //@{
+  /**
+   * Play only every `FrameStride`-th frame of the playback window, starting
+   * with frame `FrameOffset`. The other frames are skipped without ticking the
+   * scene. Defaults to 1 and 0, i.e. all frames are played.
+   */
+  vtkSetClampMacro(FrameStride, int, 1, VTK_INT_MAX);
+  vtkGetMacro(FrameStride, int);
+  vtkSetClampMacro(FrameOffset, int, 0, VTK_INT_MAX);
+  vtkGetMacro(FrameOffset, int);
+  //@}
+
   /**
    * Take the animation scene to next frame.
    */
@@ -113,6 +125,8 @@ private:
   bool StopPlay;
   bool Loop;
   double CurrentTime;
+  int FrameStride;
+  int FrameOffset;
 };
 
 #endif
@@ -509,6 +509,30 @@ int vtkSMAnimationScene::GetLoop()
   return this->AnimationPlayer->GetLoop();
 }
 
+//----------------------------------------------------------------------------
+void vtkSMAnimationScene::SetFrameStride(int val)
+{
+  this->AnimationPlayer->SetFrameStride(val);
+}
+
+//----------------------------------------------------------------------------
+int vtkSMAnimationScene::GetFrameStride()
+{
+  return this->AnimationPlayer->GetFrameStride();
+}
+
+//----------------------------------------------------------------------------
+void vtkSMAnimationScene::SetFrameOffset(int val)
+{
+  this->AnimationPlayer->SetFrameOffset(val);
+}
+
+//----------------------------------------------------------------------------
+int vtkSMAnimationScene::GetFrameOffset()
+{
+  return this->AnimationPlayer->GetFrameOffset();
+}
+
 //----------------------------------------------------------------------------
 void vtkSMAnimationScene::Play()
 {
@@ -152,6 +152,10 @@ public:
    */
   void SetLoop(int val);
   int GetLoop();
+  void SetFrameStride(int val);
+  int GetFrameStride();
+  void SetFrameOffset(int val);
+  int GetFrameOffset();
   void Play();
   void Stop();
   void GoToNext();
@@ -26,6 +26,8 @@
 #include "vtkPVRenderingCapabilitiesInformation.h"
 #include "vtkPVServerInformation.h"
 #include "vtkPVXMLElement.h"
+#include "vtkProcessModule.h"
+#include "vtkProgressObserver.h"
 #include "vtkSMAnimationScene.h"
 #include "vtkSMAnimationSceneWriter.h"
 #include "vtkSMParaViewPipelineController.h"
@@ -38,7 +40,14 @@
 #include "vtkSMViewLayoutProxy.h"
 #include "vtkSMViewProxy.h"
 
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
 #include <sstream>
+#include <thread>
+#include <utility>
+#include <vector>
 #include <vtksys/SystemTools.hxx>
 
 namespace vtkSMSaveAnimationProxyNS
@@ -59,6 +68,29 @@ class SceneImageWriter : public vtkSMAnimationSceneWriter
   vtkSmartPointer<T> Writer;
   vtkWeakPointer<vtkSMSaveAnimationProxy> Helper;
 
+  // Captured frames waiting to be written, and the frame being written by the
+  // WriterThread. These are only modified on the main thread, which connects
+  // and disconnects the writer input, so that VTK objects are never created
+  // nor released on the WriterThread.
+  int QueueDepth;
+  std::deque<std::pair<double, vtkSmartPointer<vtkImageData> > > Queue;
+  vtkSmartPointer<vtkImageData> FrameInFlight;
+
+  // Synchronization with the WriterThread, which only calls Write() on the
+  // writer. Write() executes the writer's pipeline on the WriterThread. This
+  // assumes that the pipeline is private to the writer: its only input is a
+  // trivial producer for a captured image that nothing else shares, and the
+  // main thread touches neither the writer, the image nor their executives
+  // until the write is done. While frames are queued, the writer reports
+  // progress to WriterProgress rather than to its observers, such as the
+  // progress handler, which must only be called on the main thread.
+  vtkNew<vtkProgressObserver> WriterProgress;
+  std::mutex WriterMutex;
+  std::condition_variable WriterCondition;
+  std::thread WriterThread;
+  bool WriteRequested;
+  bool StopWriting;
+
 public:
   vtkTemplateTypeMacro(SceneImageWriter, vtkSMAnimationSceneWriter);
   /**
@@ -72,11 +104,52 @@ public:
   void SetWriter(T* writer) { this->Writer = writer; }
   T* GetWriter() { return this->Writer; }
 
+  /**
+   * Play and save only every `stride`-th frame, starting with frame `offset`.
+   * This is used to interleave frames between time-parallel groups. The other
+   * frames are not played at all.
+   */
+  void SetFrameInterleaving(int stride, int offset)
+  {
+    this->FrameStride = stride;
+    this->FrameOffset = offset;
+  }
+
+  /**
+   * Set the number of captured frames that can wait to be written. When
+   * positive, each frame is written on a separate thread while the next ones
+   * are rendered. 0 writes each frame before rendering the next.
+   */
+  void SetQueueDepth(int depth) { this->QueueDepth = depth; }
+
 protected:
-  SceneImageWriter() {}
-  ~SceneImageWriter() {}
+  SceneImageWriter()
+    : QueueDepth(0)
+    , WriteRequested(false)
+    , StopWriting(false)
+    , FrameStride(1)
+    , FrameOffset(0)
+  {
+  }
+  ~SceneImageWriter()
+  {
+    // SaveFinalize() has written the queued frames already. This waits for the
+    // frame being written, if the save was interrupted.
+    if (this->WriterThread.joinable())
+    {
+      {
+        std::lock_guard<std::mutex> lock(this->WriterMutex);
+        this->StopWriting = true;
+      }
+      this->WriterCondition.notify_all();
+      this->WriterThread.join();
+      this->Writer->SetProgressObserver(nullptr);
+    }
+  }
   bool SaveInitialize(int vtkNotUsed(startCount)) override
   {
+    this->AnimationScene->SetFrameStride(this->FrameStride);
+    this->AnimationScene->SetFrameOffset(this->FrameOffset);
     // Animation scene call render on each tick. We override that render call
     // since it's a waste of rendering, the code to save the images will call
     // render anyways.
@@ -99,16 +172,123 @@ protected:
       return true;
     }
 
-    return this->WriteFrameImage(time, image);
+    if (this->QueueDepth <= 0)
+    {
+      this->PrepareFrame(time, image);
+      this->Writer->Write();
+      return this->FinishFrame();
+    }
+    this->Queue.push_back(std::make_pair(time, image));
+    return this->WriteQueuedFrames(false);
   }
 
   bool SaveFinalize() override
   {
+    const bool status = this->FlushFrames();
     this->AnimationScene->SetOverrideStillRender(0);
-    return true;
+    this->AnimationScene->SetFrameStride(1);
+    this->AnimationScene->SetFrameOffset(0);
+    return status;
+  }
+
+  /**
+   * Connects the writer to the frame image. Called on the main thread.
+   */
+  virtual void PrepareFrame(double time, vtkImageData* data) = 0;
+
+  /**
+   * Disconnects the writer from the frame image once written, and returns
+   * false if writing failed. Called on the main thread.
+   */
+  virtual bool FinishFrame() = 0;
+
+  int FrameStride;
+  int FrameOffset;
+
+  /**
+   * Waits for all queued frames to be written. Returns false if writing any
+   * of the frames failed.
+   */
+  bool FlushFrames()
+  {
+    const bool status = this->WriteQueuedFrames(true);
+    this->Queue.clear();
+    if (this->WriterThread.joinable())
+    {
+      this->Writer->SetProgressObserver(nullptr);
+    }
+    return status;
+  }
+
+private:
+  // Hands the queued frames to the WriterThread, one at a time. Only waits for
+  // the frame being written if `flush` is set or if the queue is full.
+  bool WriteQueuedFrames(bool flush)
+  {
+    while (true)
+    {
+      if (this->FrameInFlight)
+      {
+        std::unique_lock<std::mutex> lock(this->WriterMutex);
+        if (flush || this->Queue.size() > static_cast<size_t>(this->QueueDepth))
+        {
+          this->WriterCondition.wait(lock, [this]() { return !this->WriteRequested; });
+        }
+        else if (this->WriteRequested)
+        {
+          return true;
+        }
+        lock.unlock();
+
+        this->FrameInFlight = nullptr;
+        if (!this->FinishFrame())
+        {
+          this->Queue.clear();
+          return false;
+        }
+      }
+
+      if (this->Queue.empty())
+      {
+        return true;
+      }
+
+      this->FrameInFlight = this->Queue.front().second;
+      this->PrepareFrame(this->Queue.front().first, this->FrameInFlight);
+      this->Queue.pop_front();
+      if (!this->WriterThread.joinable())
+      {
+        this->WriterThread = std::thread([this]() { this->WriteFrames(); });
+      }
+      this->Writer->SetProgressObserver(this->WriterProgress);
+      {
+        std::lock_guard<std::mutex> lock(this->WriterMutex);
+        this->WriteRequested = true;
+      }
+      this->WriterCondition.notify_all();
+    }
   }
 
-  virtual bool WriteFrameImage(double time, vtkImageData* data) = 0;
+  // Runs on the WriterThread. The writer input is connected by the main
+  // thread, which does not touch the writer until the write is done.
+  void WriteFrames()
+  {
+    std::unique_lock<std::mutex> lock(this->WriterMutex);
+    while (true)
+    {
+      this->WriterCondition.wait(
+        lock, [this]() { return this->StopWriting || this->WriteRequested; });
+      if (!this->WriteRequested)
+      {
+        return;
+      }
+      lock.unlock();
+      this->Writer->Write();
+      lock.lock();
+      this->WriteRequested = false;
+      this->WriterCondition.notify_all();
+    }
+  }
 
 private:
   SceneImageWriter(const SceneImageWriter&) = delete;
@@ -139,7 +319,7 @@ protected:
     return false;
   }
 
-  bool WriteFrameImage(double vtkNotUsed(time), vtkImageData* data) override
+  void PrepareFrame(double vtkNotUsed(time), vtkImageData* data) override
   {
     assert(data);
     auto* writer = this->GetWriter();
@@ -149,19 +329,25 @@ protected:
       this->Started = true;
       writer->Start(); // start needs input data, hence we do it here.
     }
-    writer->Write();
+  }
+
+  bool FinishFrame() override
+  {
+    auto* writer = this->GetWriter();
     writer->SetInputData(nullptr);
     return (writer->GetError() == 0 && writer->GetError() == vtkErrorCode::NoError);
   }
 
   bool SaveFinalize() override
   {
+    // the frames must all be written before ending the movie.
+    const bool status = this->FlushFrames();
     if (this->Started)
     {
       this->GetWriter()->End();
     }
     this->Started = false;
-    return this->Superclass::SaveFinalize();
+    return this->Superclass::SaveFinalize() && status;
   }
 
 private:
@@ -193,7 +379,7 @@ protected:
 
   bool SaveInitialize(int startCount) override
   {
-    this->Counter = startCount;
+    this->Counter = startCount + this->FrameOffset;
     auto path = vtksys::SystemTools::GetFilenamePath(this->FileName);
     auto prefix = vtksys::SystemTools::GetFilenameWithoutLastExtension(this->FileName);
     this->Prefix = path.empty() ? prefix : path + "/" + prefix;
@@ -201,7 +387,7 @@ protected:
     return this->Superclass::SaveInitialize(startCount);
   }
 
-  bool WriteFrameImage(double vtkNotUsed(time), vtkImageData* data) override
+  void PrepareFrame(double vtkNotUsed(time), vtkImageData* data) override
   {
     auto writer = this->GetWriter();
     assert(data);
@@ -215,11 +401,15 @@ protected:
     str << this->Prefix << buffer << this->Extension;
     writer->SetInputData(data);
     writer->SetFileName(str.str().c_str());
-    writer->Write();
+  }
+
+  bool FinishFrame() override
+  {
+    auto writer = this->GetWriter();
     writer->SetInputData(nullptr);
 
     const bool success = writer->GetErrorCode() == vtkErrorCode::NoError;
-    this->Counter += success ? 1 : 0;
+    this->Counter += success ? this->FrameStride : 0;
     return success;
   }
 
@@ -331,21 +521,46 @@ bool vtkSMSaveAnimationProxy::WriteAnimationLocally(const char* filename)
     .Set(vtkSMPropertyHelper(this, "FrameRate").GetAsInt());
   formatProxy->UpdateVTKObjects();
 
+  // number of frames that can be waiting to be written while the next ones
+  // are rendered.
+  const int queueDepth = vtkSMPropertyHelper(this, "FrameQueueDepth", true).GetAsInt();
+
+  // when running time-parallel, each group saves a subset of the frames.
+  vtkProcessModule* pm = vtkProcessModule::GetProcessModule();
+  const int numGroups = pm ? pm->GetNumberOfTimeParallelGroups() : 1;
+  const int group = pm ? pm->GetTimeParallelGroup() : 0;
+  vtkSMSaveAnimationProxyNS::SceneImageWriterImageSeries* imageSeriesWriter = nullptr;
+
   // based on the format, we create an appropriate SceneImageWriter.
   auto formatObj = formatProxy->GetClientSideObject();
   if (auto imgWriter = vtkImageWriter::SafeDownCast(formatObj))
   {
     vtkNew<vtkSMSaveAnimationProxyNS::SceneImageWriterImageSeries> realWriter;
+    imageSeriesWriter = realWriter.Get();
     realWriter->SetWriter(imgWriter);
     realWriter->SetSuffixFormat(vtkSMPropertyHelper(formatProxy, "SuffixFormat").GetAsString());
     realWriter->SetHelper(this);
+    realWriter->SetQueueDepth(queueDepth);
     writer = realWriter;
   }
   else if (auto movieWriter = vtkGenericMovieWriter::SafeDownCast(formatObj))
   {
+    if (numGroups > 1)
+    {
+      // a movie cannot be split between groups, the first group saves it all.
+      if (group != 0)
+      {
+        this->Cleanup();
+        return true;
+      }
+      vtkWarningMacro("Movies are not saved time-parallel. Save an image series instead to "
+                      "distribute the frames between the "
+        << numGroups << " time-parallel groups.");
+    }
     vtkNew<vtkSMSaveAnimationProxyNS::SceneImageWriterMovie> realWriter;
     realWriter->SetWriter(movieWriter);
     realWriter->SetHelper(this);
+    realWriter->SetQueueDepth(queueDepth);
     writer = realWriter;
   }
   else
@@ -369,7 +584,7 @@ bool vtkSMSaveAnimationProxy::WriteAnimationLocally(const char* filename)
   // values as animation time.
   int frameWindow[2] = { 0, 0 };
   vtkSMPropertyHelper(this, "FrameWindow").Get(frameWindow, 2);
-  double playbackTimeWindow[2] = { -1, 0 };
+  std::function<double(int)> frameTime;
   switch (vtkSMPropertyHelper(sceneProxy, "PlayMode").GetAsInt())
   {
     case vtkCompositeAnimationPlayer::SEQUENCE:
@@ -379,10 +594,9 @@ bool vtkSMSaveAnimationProxy::WriteAnimationLocally(const char* filename)
       double endTime = vtkSMPropertyHelper(sceneProxy, "EndTime").GetAsDouble();
       frameWindow[0] = frameWindow[0] < 0 ? 0 : frameWindow[0];
       frameWindow[1] = frameWindow[1] >= numFrames ? numFrames - 1 : frameWindow[1];
-      playbackTimeWindow[0] =
-        startTime + ((endTime - startTime) * frameWindow[0]) / (numFrames - 1);
-      playbackTimeWindow[1] =
-        startTime + ((endTime - startTime) * frameWindow[1]) / (numFrames - 1);
+      frameTime = [=](int frame) {
+        return startTime + ((endTime - startTime) * frame) / (numFrames - 1);
+      };
     }
     break;
     case vtkCompositeAnimationPlayer::SNAP_TO_TIMESTEPS:
@@ -392,8 +606,10 @@ bool vtkSMSaveAnimationProxy::WriteAnimationLocally(const char* filename)
       int numTS = tsValuesHelper.GetNumberOfElements();
       frameWindow[0] = frameWindow[0] < 0 ? 0 : frameWindow[0];
       frameWindow[1] = frameWindow[1] >= numTS ? numTS - 1 : frameWindow[1];
-      playbackTimeWindow[0] = tsValuesHelper.GetAsDouble(frameWindow[0]);
-      playbackTimeWindow[1] = tsValuesHelper.GetAsDouble(frameWindow[1]);
+      std::vector<double> tsValues = tsValuesHelper.GetDoubleArray();
+      frameTime = [tsValues](int frame) {
+        return frame >= 0 && frame < static_cast<int>(tsValues.size()) ? tsValues[frame] : 0.0;
+      };
     }
 
     break;
@@ -402,6 +618,33 @@ bool vtkSMSaveAnimationProxy::WriteAnimationLocally(const char* filename)
       // changed the play mode to SEQUENCE or SNAP_TO_TIMESTEPS.
       abort();
   }
+
+  if (numGroups > 1 && imageSeriesWriter)
+  {
+    if (vtkSMPropertyHelper(this, "FrameDistribution", true).GetAsInt() ==
+      vtkSMSaveAnimationProxy::CONTIGUOUS)
+    {
+      // each group saves a contiguous range of frames.
+      const int count = frameWindow[1] - frameWindow[0] + 1;
+      const int first = frameWindow[0] + (count * group) / numGroups;
+      const int last = frameWindow[0] + (count * (group + 1)) / numGroups - 1;
+      if (last < first)
+      {
+        // more groups than frames, nothing to save for this group.
+        this->Cleanup();
+        return true;
+      }
+      frameWindow[0] = first;
+      frameWindow[1] = last;
+    }
+    else
+    {
+      // groups take turns saving frames.
+      imageSeriesWriter->SetFrameInterleaving(numGroups, group);
+    }
+  }
+
+  double playbackTimeWindow[2] = { frameTime(frameWindow[0]), frameTime(frameWindow[1]) };
   writer->SetStartFileCount(frameWindow[0]);
   writer->SetPlaybackTimeWindow(playbackTimeWindow);
 
@@ -42,6 +42,16 @@ public:
   vtkTypeMacro(vtkSMSaveAnimationProxy, vtkSMSaveScreenshotProxy);
   void PrintSelf(ostream& os, vtkIndent indent) override;
 
+  /**
+   * How the frames are distributed between time-parallel groups, see
+   * vtkProcessModule::GetNumberOfTimeParallelGroups().
+   */
+  enum FrameDistributionModes
+  {
+    INTERLEAVED = 0,
+    CONTIGUOUS = 1
+  };
+
   /**
    * Save animation as images/video. The properties on this proxy provide all
    * the necessary information to save the animation.
@@ -45,12 +45,11 @@ void vtkSequenceAnimationPlayer::StartLoop(
   // determine the actual frame index from which to resume the animation
   if (playbackWindow[0] > starttime)
   {
-    // let's resume from the frame NEXT to the one on which the animation WAS
-    // paused / stopped
+    // the first frame played is the one at the start of the window,
+    // GetNextTime() then moves on to the NEXT one.
     this->FrameNo = static_cast<int>((playbackWindow[0] - this->StartTime) *
-                        (this->NumberOfFrames - 1) / (this->EndTime - this->StartTime) +
-                      0.5) +
-      1;
+        (this->NumberOfFrames - 1) / (this->EndTime - this->StartTime) +
+      0.5);
 
     // Let's compute the upper bounds in Frame unit
     this->MaxFrameWindow = static_cast<int>((playbackWindow[1] - this->StartTime) *
@@ -67,9 +66,8 @@ double vtkSequenceAnimationPlayer::GetNextTime(double curtime)
   {
     // Invalid Frame No, compute it correctly
     this->FrameNo = static_cast<int>((curtime - this->StartTime) * (this->NumberOfFrames - 1) /
-                        (this->EndTime - this->StartTime) +
-                      0.5) +
-      1;
+        (this->EndTime - this->StartTime) +
+      0.5);
   }
   this->FrameNo++;
   if (this->StartTime >= this->EndTime && this->FrameNo >= this->MaxFrameWindow)
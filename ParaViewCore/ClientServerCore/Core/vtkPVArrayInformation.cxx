@@ -15,20 +15,26 @@
 #include "vtkPVArrayInformation.h"
 
 #include "vtkAbstractArray.h"
+#include "vtkArrayDispatch.h"
 #include "vtkClientServerStream.h"
 #include "vtkDataArray.h"
+#include "vtkDataArrayAccessor.h"
 #include "vtkInformation.h"
 #include "vtkInformationIterator.h"
 #include "vtkInformationKey.h"
+#include "vtkMath.h"
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPVPostFilter.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
 #include "vtkStdString.h"
 #include "vtkStringArray.h"
 #include "vtkVariant.h"
 #include "vtkVariantArray.h"
 
 #include <algorithm>
+#include <cmath>
 #include <map>
 #include <set>
 #include <sstream>
@@ -45,6 +51,126 @@ struct vtkPVArrayInformationInformationKey
 };
 
 typedef std::vector<vtkPVArrayInformationInformationKey> vtkInternalInformationKeysBase;
+
+//----------------------------------------------------------------------------
+// Computes, in a single pass over the tuples, the range of each component and
+// of the L2 norm of the tuples, and the same ranges restricted to finite
+// values. NaNs are skipped as vtkDataArray::GetRange() and
+// vtkDataArray::GetFiniteRange() do. Ranges are laid out as in
+// vtkPVArrayInformation: the norm first when there are several components,
+// then each component, and all the finite ranges after the regular ones.
+template <typename ArrayT>
+class vtkPVArrayInformationRangeFunctor
+{
+public:
+  vtkPVArrayInformationRangeFunctor(ArrayT* array)
+    : Array(array)
+    , NumberOfComponents(array->GetNumberOfComponents())
+    , NumberOfRanges(array->GetNumberOfComponents() > 1 ? array->GetNumberOfComponents() + 1 : 1)
+  {
+    this->Ranges.resize(4 * this->NumberOfRanges);
+    this->InitializeRanges(this->Ranges);
+  }
+
+  void Initialize() { this->InitializeRanges(this->LocalRanges.Local()); }
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    vtkDataArrayAccessor<ArrayT> accessor(this->Array);
+    std::vector<double>& local = this->LocalRanges.Local();
+    double* ranges = &local[0];
+    double* finiteRanges = ranges + 2 * this->NumberOfRanges;
+    // the norm, when present, is stored before the components.
+    const int offset = this->NumberOfRanges - this->NumberOfComponents;
+    for (vtkIdType tuple = begin; tuple < end; ++tuple)
+    {
+      double squaredSum = 0.0;
+      for (int comp = 0; comp < this->NumberOfComponents; ++comp)
+      {
+        const double value = static_cast<double>(accessor.Get(tuple, comp));
+        squaredSum += value * value;
+        UpdateRange(ranges, finiteRanges, comp + offset, value);
+      }
+      if (offset > 0)
+      {
+        // the norm range is computed from the squared sums, as VTK does.
+        UpdateRange(ranges, finiteRanges, 0, squaredSum);
+      }
+    }
+  }
+
+  void Reduce()
+  {
+    typedef vtkSMPThreadLocal<std::vector<double> >::iterator LocalIterator;
+    for (LocalIterator iter = this->LocalRanges.begin(); iter != this->LocalRanges.end(); ++iter)
+    {
+      const std::vector<double>& local = *iter;
+      for (size_t cc = 0; cc < this->Ranges.size(); cc += 2)
+      {
+        this->Ranges[cc] = std::min(this->Ranges[cc], local[cc]);
+        this->Ranges[cc + 1] = std::max(this->Ranges[cc + 1], local[cc + 1]);
+      }
+    }
+    if (this->NumberOfRanges > this->NumberOfComponents)
+    {
+      const int finiteOffset = 2 * this->NumberOfRanges;
+      for (int cc : { 0, 1, finiteOffset, finiteOffset + 1 })
+      {
+        if (this->Ranges[cc] != VTK_DOUBLE_MAX && this->Ranges[cc] != VTK_DOUBLE_MIN)
+        {
+          this->Ranges[cc] = std::sqrt(this->Ranges[cc]);
+        }
+      }
+    }
+  }
+
+  std::vector<double> Ranges;
+
+private:
+  static void UpdateRange(
+    double* ranges, double* finiteRanges, int index, double value)
+  {
+    if (vtkMath::IsNan(value))
+    {
+      return;
+    }
+    ranges[2 * index] = std::min(ranges[2 * index], value);
+    ranges[2 * index + 1] = std::max(ranges[2 * index + 1], value);
+    if (!vtkMath::IsInf(value))
+    {
+      finiteRanges[2 * index] = std::min(finiteRanges[2 * index], value);
+      finiteRanges[2 * index + 1] = std::max(finiteRanges[2 * index + 1], value);
+    }
+  }
+
+  void InitializeRanges(std::vector<double>& ranges) const
+  {
+    ranges.resize(4 * this->NumberOfRanges);
+    for (size_t cc = 0; cc < ranges.size(); cc += 2)
+    {
+      ranges[cc] = VTK_DOUBLE_MAX;
+      ranges[cc + 1] = VTK_DOUBLE_MIN;
+    }
+  }
+
+  ArrayT* Array;
+  int NumberOfComponents;
+  int NumberOfRanges;
+  vtkSMPThreadLocal<std::vector<double> > LocalRanges;
+};
+
+struct vtkPVArrayInformationRangeWorker
+{
+  std::vector<double> Ranges;
+
+  template <typename ArrayT>
+  void operator()(ArrayT* array)
+  {
+    vtkPVArrayInformationRangeFunctor<ArrayT> functor(array);
+    vtkSMPTools::For(0, array->GetNumberOfTuples(), functor);
+    this->Ranges.swap(functor.Ranges);
+  }
+};
 }
 
 class vtkPVArrayInformation::vtkInternalComponentNames : public vtkInternalComponentNameBase
@@ -633,40 +759,20 @@ void vtkPVArrayInformation::CopyFromObject(vtkObject* obj)
     }
   }
 
-  if (vtkDataArray* const data_array = vtkDataArray::SafeDownCast(obj))
+  vtkDataArray* const data_array = vtkDataArray::SafeDownCast(obj);
+  if (data_array && this->NumberOfComponents > 0)
   {
-    double range[2];
-    double* ptr;
-    int idx;
+    const int numRanges =
+      (this->NumberOfComponents > 1) ? this->NumberOfComponents + 1 : this->NumberOfComponents;
+    const int numValues = 2 * numRanges;
 
-    ptr = this->Ranges;
-    if (this->NumberOfComponents > 1)
-    {
-      // First store range of vector magnitude.
-      data_array->GetRange(range, -1);
-      *ptr++ = range[0];
-      *ptr++ = range[1];
-    }
-    for (idx = 0; idx < this->NumberOfComponents; ++idx)
-    {
-      data_array->GetRange(range, idx);
-      *ptr++ = range[0];
-      *ptr++ = range[1];
-    }
-    ptr = this->FiniteRanges;
-    if (this->NumberOfComponents > 1)
-    {
-      // First store range of vector magnitude.
-      data_array->GetFiniteRange(range, -1);
-      *ptr++ = range[0];
-      *ptr++ = range[1];
-    }
-    for (idx = 0; idx < this->NumberOfComponents; ++idx)
+    vtkPVArrayInformationRangeWorker worker;
+    if (!vtkArrayDispatch::Dispatch::Execute(data_array, worker))
     {
-      data_array->GetFiniteRange(range, idx);
-      *ptr++ = range[0];
-      *ptr++ = range[1];
+      worker(data_array);
     }
+    std::copy(worker.Ranges.begin(), worker.Ranges.begin() + numValues, this->Ranges);
+    std::copy(worker.Ranges.begin() + numValues, worker.Ranges.end(), this->FiniteRanges);
   }
 
   if (this->InformationKeys)
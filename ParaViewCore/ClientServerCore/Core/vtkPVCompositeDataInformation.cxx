@@ -219,7 +219,16 @@ void vtkPVCompositeDataInformation::CopyFromObject(vtkObject* object)
     if (curDO)
     {
       childInfo = vtkSmartPointer<vtkPVDataInformation>::New();
-      childInfo->CopyFromObject(curDO);
+      if (curDO->IsA("vtkCompositeDataSet"))
+      {
+        childInfo->CopyFromObject(curDO);
+      }
+      else
+      {
+        // the cached leaf information is shared, so work on a copy since
+        // AddInformation() merges into the children in place.
+        childInfo->DeepCopy(vtkPVDataInformation::GetLeafInformation(curDO));
+      }
     }
     this->Internal->ChildrenInformation.resize(index + 1);
     this->Internal->ChildrenInformation[index].Info = childInfo;
@@ -255,7 +264,6 @@ void vtkPVCompositeDataInformation::CopyFromAMR(vtkUniformGridAMR* amr)
 
   // we use this to "simulate" a composite tree from AMR
   vtkNew<vtkMultiPieceDataSet> tempMultiPiece;
-  vtkNew<vtkPVDataInformation> tempDSInfo;
 
   for (unsigned int level = 0; level < this->NumberOfAMRLevels; level++)
   {
@@ -271,8 +279,7 @@ void vtkPVCompositeDataInformation::CopyFromAMR(vtkUniformGridAMR* amr)
       vtkUniformGrid* dataset = amr->GetDataSet(level, idx);
       if (dataset)
       {
-        tempDSInfo->CopyFromObject(dataset);
-        levelInfo->AddInformation(tempDSInfo.GetPointer(), 1);
+        levelInfo->AddInformation(vtkPVDataInformation::GetLeafInformation(dataset), 1);
       }
     }
     levelInfo->CopyFromCompositeDataSetFinalize(tempMultiPiece.GetPointer());
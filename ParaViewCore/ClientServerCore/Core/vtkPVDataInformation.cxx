@@ -24,6 +24,7 @@
 #include "vtkCompositeDataIterator.h"
 #include "vtkCompositeDataSet.h"
 #include "vtkDataArray.h"
+#include "vtkDataObjectTreeIterator.h"
 #include "vtkDataObjectTypes.h"
 #include "vtkDataSet.h"
 #include "vtkExecutive.h"
@@ -33,6 +34,8 @@
 #include "vtkHyperTreeGrid.h"
 #include "vtkImageData.h"
 #include "vtkInformation.h"
+#include "vtkInformationIdTypeKey.h"
+#include "vtkInformationObjectBaseKey.h"
 #include "vtkMath.h"
 #include "vtkMultiProcessController.h"
 #include "vtkMultiProcessStream.h"
@@ -48,6 +51,7 @@
 #include "vtkPointData.h"
 #include "vtkRectilinearGrid.h"
 #include "vtkSelection.h"
+#include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkStructuredGrid.h"
 #include "vtkTable.h"
@@ -60,6 +64,8 @@
 #include <vector>
 
 vtkStandardNewMacro(vtkPVDataInformation);
+vtkInformationKeyMacro(vtkPVDataInformation, CACHED_INFORMATION, ObjectBase);
+vtkInformationKeyMacro(vtkPVDataInformation, CACHED_INFORMATION_MTIME, IdType);
 
 std::map<std::string, std::string> helpers;
 
@@ -114,14 +120,16 @@ vtkPVDataInformation::~vtkPVDataInformation()
 //----------------------------------------------------------------------------
 void vtkPVDataInformation::CopyParametersToStream(vtkMultiProcessStream& str)
 {
-  str << 828792 << this->PortNumber;
+  str << 828792 << this->PortNumber << (this->SummaryOnly ? 1 : 0) << this->CompositeIndex;
 }
 
 //----------------------------------------------------------------------------
 void vtkPVDataInformation::CopyParametersFromStream(vtkMultiProcessStream& str)
 {
   int magic_number;
-  str >> magic_number >> this->PortNumber;
+  int summaryOnly;
+  str >> magic_number >> this->PortNumber >> summaryOnly >> this->CompositeIndex;
+  this->SummaryOnly = (summaryOnly != 0);
   if (magic_number != 828792)
   {
     vtkErrorMacro("Magic number mismatch.");
@@ -135,6 +143,8 @@ void vtkPVDataInformation::PrintSelf(ostream& os, vtkIndent indent)
   this->Superclass::PrintSelf(os, indent);
 
   os << indent << "PortNumber: " << this->PortNumber << endl;
+  os << indent << "SummaryOnly: " << this->SummaryOnly << endl;
+  os << indent << "CompositeIndex: " << this->CompositeIndex << endl;
   os << indent << "DataSetType: " << this->DataSetType << endl;
   os << indent << "CompositeDataSetType: " << this->CompositeDataSetType << endl;
   os << indent << "NumberOfPoints: " << this->NumberOfPoints << endl;
@@ -330,6 +340,41 @@ void vtkPVDataInformation::DeepCopy(
   this->TimeSpan[1] = timespan[1];
   this->NumberOfTimeSteps = dataInfo->GetNumberOfTimeSteps();
   this->SetTimeLabel(dataInfo->GetTimeLabel());
+  this->HasTime = dataInfo->GetHasTime();
+  this->Time = dataInfo->GetTime();
+}
+
+//----------------------------------------------------------------------------
+vtkPVDataInformation* vtkPVDataInformation::GetLeafInformation(vtkDataObject* leaf)
+{
+  vtkMTimeType mtime = leaf->GetMTime();
+  if (vtkFieldData* fd = leaf->GetFieldData())
+  {
+    mtime = std::max(mtime, fd->GetMTime());
+  }
+
+  vtkInformation* info = leaf->GetInformation();
+  vtkPVDataInformation* cached =
+    vtkPVDataInformation::SafeDownCast(info->Get(vtkPVDataInformation::CACHED_INFORMATION()));
+  if (cached && info->Has(vtkPVDataInformation::CACHED_INFORMATION_MTIME()) &&
+    static_cast<vtkMTimeType>(info->Get(vtkPVDataInformation::CACHED_INFORMATION_MTIME())) ==
+      mtime)
+  {
+    // The data time is kept in the block's information and changing it does
+    // not modify the block, so always refresh it.
+    cached->HasTime = 0;
+    cached->Time = 0.0;
+    cached->CopyCommonMetaData(leaf, nullptr);
+    return cached;
+  }
+
+  vtkNew<vtkPVDataInformation> dinf;
+  dinf->CopyFromObject(leaf);
+  dinf->SetDataClassName(leaf->GetClassName());
+  dinf->DataSetType = leaf->GetDataObjectType();
+  info->Set(vtkPVDataInformation::CACHED_INFORMATION(), dinf.GetPointer());
+  info->Set(vtkPVDataInformation::CACHED_INFORMATION_MTIME(), static_cast<vtkIdType>(mtime));
+  return dinf.GetPointer();
 }
 
 //----------------------------------------------------------------------------
@@ -341,12 +386,7 @@ void vtkPVDataInformation::AddFromMultiPieceDataSet(vtkCompositeDataSet* data)
     vtkDataObject* dobj = iter->GetCurrentDataObject();
     if (dobj)
     {
-      vtkPVDataInformation* dinf = vtkPVDataInformation::New();
-      dinf->CopyFromObject(dobj);
-      dinf->SetDataClassName(dobj->GetClassName());
-      dinf->DataSetType = dobj->GetDataObjectType();
-      this->AddInformation(dinf, /*addingParts=*/1);
-      dinf->FastDelete();
+      this->AddInformation(vtkPVDataInformation::GetLeafInformation(dobj), /*addingParts=*/1);
     }
   }
   iter->Delete();
@@ -472,6 +512,75 @@ void vtkPVDataInformation::CopyCommonMetaData(vtkDataObject* data, vtkInformatio
   }
 }
 
+//----------------------------------------------------------------------------
+void vtkPVDataInformation::CopyFromCompositeIndex(vtkDataObject* data, vtkInformation* pinfo)
+{
+  vtkCompositeDataSet* cds = vtkCompositeDataSet::SafeDownCast(data);
+  if (!cds)
+  {
+    return;
+  }
+
+  vtkSmartPointer<vtkCompositeDataIterator> iter;
+  iter.TakeReference(cds->NewIterator());
+  if (vtkDataObjectTreeIterator* treeIter = vtkDataObjectTreeIterator::SafeDownCast(iter))
+  {
+    treeIter->VisitOnlyLeavesOff();
+  }
+  iter->SkipEmptyNodesOff();
+
+  vtkDataObject* node = nullptr;
+  std::string name;
+  for (iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextItem())
+  {
+    if (iter->GetCurrentFlatIndex() == this->CompositeIndex)
+    {
+      node = iter->GetCurrentDataObject();
+      if (iter->HasCurrentMetaData() &&
+        iter->GetCurrentMetaData()->Has(vtkCompositeDataSet::NAME()))
+      {
+        name = iter->GetCurrentMetaData()->Get(vtkCompositeDataSet::NAME());
+      }
+      break;
+    }
+  }
+
+  // the node may be empty on this process.
+  if (!node)
+  {
+    return;
+  }
+
+  const unsigned int compositeIndex = this->CompositeIndex;
+  this->CompositeIndex = 0;
+  this->CopyFromObject(node);
+  this->CompositeIndex = compositeIndex;
+  this->CopyCommonMetaData(node, pinfo);
+  if (!name.empty())
+  {
+    this->SetCompositeDataSetName(name.c_str());
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkPVDataInformation::ClearBlockAttributeInformation()
+{
+  vtkPVCompositeDataInformation* cinfo = this->CompositeDataInformation;
+  for (unsigned int cc = 0, max = cinfo->GetNumberOfChildren(); cc < max; ++cc)
+  {
+    if (vtkPVDataInformation* childInfo = cinfo->GetDataInformation(cc))
+    {
+      childInfo->PointDataInformation->Initialize();
+      childInfo->CellDataInformation->Initialize();
+      childInfo->VertexDataInformation->Initialize();
+      childInfo->EdgeDataInformation->Initialize();
+      childInfo->RowDataInformation->Initialize();
+      childInfo->PointArrayInformation->Initialize();
+      childInfo->ClearBlockAttributeInformation();
+    }
+  }
+}
+
 //----------------------------------------------------------------------------
 void vtkPVDataInformation::CopyFromDataSet(vtkDataSet* data)
 {
@@ -779,11 +888,21 @@ void vtkPVDataInformation::CopyFromObject(vtkObject* object)
     return;
   }
 
+  if (this->CompositeIndex != 0)
+  {
+    this->CopyFromCompositeIndex(dobj, info);
+    return;
+  }
+
   vtkCompositeDataSet* cds = vtkCompositeDataSet::SafeDownCast(dobj);
   if (cds)
   {
     this->CopyFromCompositeDataSet(cds);
     this->CopyCommonMetaData(dobj, info);
+    if (this->SummaryOnly)
+    {
+      this->ClearBlockAttributeInformation();
+    }
     return;
   }
 
@@ -41,6 +41,8 @@ class vtkGenericDataSet;
 class vtkGraph;
 class vtkHyperTreeGrid;
 class vtkInformation;
+class vtkInformationIdTypeKey;
+class vtkInformationObjectBaseKey;
 class vtkPVArrayInformation;
 class vtkPVCompositeDataInformation;
 class vtkPVDataSetAttributesInformation;
@@ -76,6 +78,31 @@ public:
   vtkGetMacro(PortNumber, int);
   //@}
 
+  //@{
+  /**
+   * When set, the information gathered for a composite dataset only keeps the
+   * hierarchy of its blocks with their counts, bounds and field data. The
+   * point, cell, vertex, edge and row array information of the individual
+   * blocks is dropped, which keeps the information small for datasets with
+   * many blocks. The summary of the whole dataset, including its array list,
+   * is unaffected. Use CompositeIndex to gather the details of a block on
+   * demand. Off by default.
+   */
+  vtkSetMacro(SummaryOnly, bool);
+  vtkGetMacro(SummaryOnly, bool);
+  vtkBooleanMacro(SummaryOnly, bool);
+  //@}
+
+  //@{
+  /**
+   * When non-zero, the information is only gathered for the node of the
+   * composite dataset with this flat index, including its subtree. 0 (default)
+   * gathers the information for the whole data object.
+   */
+  vtkSetMacro(CompositeIndex, unsigned int);
+  vtkGetMacro(CompositeIndex, unsigned int);
+  //@}
+
   /**
    * Transfer information about a single object into this object.
    */
@@ -295,12 +322,30 @@ public:
    */
   static void RegisterHelper(const char* classname, const char* helperclassname);
 
+  //@{
+  /**
+   * Keys used to cache the information of the leaf blocks of a composite
+   * dataset in the block's information, along with the MTime of the block it
+   * was computed for. When gathering information for a composite dataset,
+   * only the blocks that changed since the last gather are traversed again.
+   */
+  static vtkInformationObjectBaseKey* CACHED_INFORMATION();
+  static vtkInformationIdTypeKey* CACHED_INFORMATION_MTIME();
+  //@}
+
 protected:
   vtkPVDataInformation();
   ~vtkPVDataInformation() override;
 
   void DeepCopy(vtkPVDataInformation* dataInfo, bool copyCompositeInformation = true);
 
+  /**
+   * Returns the information for a leaf block of a composite dataset, reusing
+   * the one cached on the block if the block hasn't been modified since. The
+   * returned instance is owned by the block and must not be modified.
+   */
+  static vtkPVDataInformation* GetLeafInformation(vtkDataObject* leaf);
+
   void AddFromMultiPieceDataSet(vtkCompositeDataSet* data);
   void CopyFromCompositeDataSet(vtkCompositeDataSet* data);
   void CopyFromCompositeDataSetInitialize(vtkCompositeDataSet* data);
@@ -312,6 +357,13 @@ protected:
   void CopyFromHyperTreeGrid(vtkHyperTreeGrid* data);
   void CopyFromSelection(vtkSelection* selection);
   void CopyCommonMetaData(vtkDataObject*, vtkInformation*);
+  void CopyFromCompositeIndex(vtkDataObject* data, vtkInformation* pinfo);
+
+  /**
+   * Drops the array information of all the blocks in the composite hierarchy,
+   * except for field data. Used for SummaryOnly.
+   */
+  void ClearBlockAttributeInformation();
 
   static vtkPVDataInformationHelper* FindHelper(const char* classname);
 
@@ -367,6 +419,8 @@ private:
   void operator=(const vtkPVDataInformation&) = delete;
 
   int PortNumber = -1;
+  bool SummaryOnly = false;
+  unsigned int CompositeIndex = 0;
 };
 
 #endif
@@ -24,6 +24,7 @@
 #include <vtksys/SystemTools.hxx>
 
 vtkStandardNewMacro(vtkPVFileInformationHelper);
+vtkCxxSetObjectMacro(vtkPVFileInformationHelper, ListingCache, vtkObject);
 //-----------------------------------------------------------------------------
 vtkPVFileInformationHelper::vtkPVFileInformationHelper()
 {
@@ -34,6 +35,10 @@ vtkPVFileInformationHelper::vtkPVFileInformationHelper()
   this->SetPath(".");
   this->PathSeparator = 0;
   this->FastFileTypeDetection = 1;
+  this->ReadDetailedFileInformation = false;
+  this->ListingOffset = 0;
+  this->MaximumListingSize = 0;
+  this->ListingCache = 0;
 #if defined(_WIN32) && !defined(__CYGWIN__)
   this->SetPathSeparator("\\");
 #else
@@ -47,6 +52,7 @@ vtkPVFileInformationHelper::~vtkPVFileInformationHelper()
   this->SetPath(0);
   this->SetPathSeparator(0);
   this->SetWorkingDirectory(0);
+  this->SetListingCache(0);
 }
 
 //-----------------------------------------------------------------------------
@@ -75,6 +81,10 @@ void vtkPVFileInformationHelper::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "PathSeparator: " << (this->PathSeparator ? this->PathSeparator : "(null)")
      << endl;
   os << indent << "FastFileTypeDetection: " << this->FastFileTypeDetection << endl;
+  os << indent << "ReadDetailedFileInformation: " << this->ReadDetailedFileInformation << endl;
+  os << indent << "ListingOffset: " << this->ListingOffset << endl;
+  os << indent << "MaximumListingSize: " << this->MaximumListingSize << endl;
+  os << indent << "ListingCache: " << this->ListingCache << endl;
 }
 
 //-----------------------------------------------------------------------------
@@ -139,6 +139,31 @@ public:
   vtkSetMacro(ReadDetailedFileInformation, bool);
   //@}
 
+  //@{
+  /**
+   * Get/Set the page of a directory listing to return. The listing, sorted by
+   * name, is returned starting at entry ListingOffset and holding at most
+   * MaximumListingSize entries. When MaximumListingSize is 0 (default), the
+   * complete listing is returned. Pages that follow the first one are served
+   * from the listing computed for the first page, so a client can fetch a
+   * large directory in bounded messages without listing it again.
+   */
+  vtkGetMacro(ListingOffset, int);
+  vtkSetClampMacro(ListingOffset, int, 0, VTK_INT_MAX);
+  vtkGetMacro(MaximumListingSize, int);
+  vtkSetClampMacro(MaximumListingSize, int, 0, VTK_INT_MAX);
+  //@}
+
+  //@{
+  /**
+   * Get/Set the listing that vtkPVFileInformation keeps between the pages of
+   * a directory listing. Each helper, hence each file dialog, pages through
+   * its own listing. For internal use only.
+   */
+  void SetListingCache(vtkObject*);
+  vtkGetObjectMacro(ListingCache, vtkObject);
+  //@}
+
 protected:
   vtkPVFileInformationHelper();
   ~vtkPVFileInformationHelper() override;
@@ -150,6 +175,9 @@ protected:
   int FastFileTypeDetection;
 
   bool ReadDetailedFileInformation;
+  int ListingOffset;
+  int MaximumListingSize;
+  vtkObject* ListingCache;
   char* PathSeparator;
   vtkSetStringMacro(PathSeparator);
 
@@ -57,6 +57,7 @@ vtkPVOptions::vtkPVOptions()
   this->MultiServerMode = 0;
   this->RenderServerMode = 0;
   this->SymmetricMPIMode = 0;
+  this->TimeParallelGroups = 1;
   this->TellVersion = 0;
   this->EnableStreaming = 0;
   this->SatelliteMessageIds = 0;
@@ -247,6 +248,11 @@ void vtkPVOptions::Initialize()
     "When specified, the python script is processed symmetrically on all processes.",
     vtkPVOptions::PVBATCH);
 
+  this->AddArgument("--time-parallel-groups", 0, &this->TimeParallelGroups,
+    "Split the processes into the given number of groups. Each group processes "
+    "the python script independently and saves its own subset of the animation frames.",
+    vtkPVOptions::PVBATCH);
+
   this->AddBooleanArgument("--enable-streaming", 0, &this->EnableStreaming,
     "EXPERIMENTAL: When specified, view-based streaming is enabled for certain "
     "views and representation types.",
@@ -613,6 +619,7 @@ void vtkPVOptions::PrintSelf(ostream& os, vtkIndent indent)
      << endl;
   os << indent << "LogFileName: " << (this->LogFileName ? this->LogFileName : "(none)") << endl;
   os << indent << "SymmetricMPIMode: " << this->SymmetricMPIMode << endl;
+  os << indent << "TimeParallelGroups: " << this->TimeParallelGroups << endl;
   os << indent << "ServerURL: " << (this->ServerURL ? this->ServerURL : "(none)") << endl;
   os << indent << "EnableStreaming:" << (this->EnableStreaming ? "yes" : "no") << endl;
 
@@ -152,6 +152,17 @@ public:
   vtkSetMacro(SymmetricMPIMode, int);
   //@}
 
+  //@{
+  /**
+   * Number of groups the ranks are split into to save animations
+   * time-parallel. Each group processes the script with its own subset of the
+   * animation frames. This is applicable only to PVBATCH type of processes.
+   * Default is 1.
+   */
+  vtkGetMacro(TimeParallelGroups, int);
+  vtkSetMacro(TimeParallelGroups, int);
+  //@}
+
   //@{
   /**
    * Should this run print the version numbers and exit.
@@ -327,6 +338,7 @@ protected:
   int MultiClientModeWithErrorMacro;
   int MultiServerMode;
   int SymmetricMPIMode;
+  int TimeParallelGroups;
   char* ServersFileName;
   char* TestPlugin; // to load plugins from command line for tests
   char* TestPluginPath;
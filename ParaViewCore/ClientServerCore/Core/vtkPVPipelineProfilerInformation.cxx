@@ -0,0 +1,328 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    vtkPVPipelineProfilerInformation.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkPVPipelineProfilerInformation.h"
+
+#include "vtkClientServerStream.h"
+#include "vtkObjectFactory.h"
+#include "vtkPVPipelineProfiler.h"
+
+#include <algorithm>
+#include <functional>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <vector>
+
+#define vtkVerifyParseMacro(_call, _field)                                                         \
+  if (!(_call))                                                                                    \
+  {                                                                                                \
+    vtkErrorMacro("Error parsing " _field ".");                                                    \
+    return;                                                                                        \
+  }
+
+class vtkPVPipelineProfilerInformation::vtkInternals
+{
+public:
+  struct Record
+  {
+    std::string Stack;
+    int Calls;
+    double MinTime;
+    double MaxTime;
+    double TotalTime;
+    vtkTypeInt64 Memory;
+  };
+
+  int NumberOfProcesses = 0;
+  std::vector<Record> Records;
+
+  const Record* GetRecord(int idx) const
+  {
+    return (idx >= 0 && idx < static_cast<int>(this->Records.size())) ? &this->Records[idx]
+                                                                       : nullptr;
+  }
+
+  double GetMeanTime(const Record& record) const
+  {
+    return this->NumberOfProcesses > 0 ? record.TotalTime / this->NumberOfProcesses : 0.0;
+  }
+
+  double GetImbalance(const Record& record) const
+  {
+    const double mean = this->GetMeanTime(record);
+    return mean > 0.0 ? record.MaxTime / mean : 1.0;
+  }
+};
+
+vtkStandardNewMacro(vtkPVPipelineProfilerInformation);
+//-----------------------------------------------------------------------------
+vtkPVPipelineProfilerInformation::vtkPVPipelineProfilerInformation()
+  : Internals(new vtkPVPipelineProfilerInformation::vtkInternals())
+{
+}
+
+//-----------------------------------------------------------------------------
+vtkPVPipelineProfilerInformation::~vtkPVPipelineProfilerInformation()
+{
+  delete this->Internals;
+}
+
+//-----------------------------------------------------------------------------
+void vtkPVPipelineProfilerInformation::CopyFromObject(vtkObject*)
+{
+  vtkInternals& internals = *this->Internals;
+  internals.NumberOfProcesses = 1;
+  internals.Records.clear();
+  for (int cc = 0, max = vtkPVPipelineProfiler::GetNumberOfRecords(); cc < max; ++cc)
+  {
+    const double time = vtkPVPipelineProfiler::GetRecordTime(cc);
+    internals.Records.push_back(vtkInternals::Record{ vtkPVPipelineProfiler::GetRecordStack(cc),
+      vtkPVPipelineProfiler::GetRecordCalls(cc), time, time, time,
+      vtkPVPipelineProfiler::GetRecordMemory(cc) });
+  }
+}
+
+//-----------------------------------------------------------------------------
+void vtkPVPipelineProfilerInformation::AddInformation(vtkPVInformation* info)
+{
+  vtkPVPipelineProfilerInformation* other = vtkPVPipelineProfilerInformation::SafeDownCast(info);
+  if (!other)
+  {
+    vtkErrorMacro("AddInformation needs vtkPVPipelineProfilerInformation.");
+    return;
+  }
+
+  vtkInternals& internals = *this->Internals;
+  const vtkInternals& otherInternals = *other->Internals;
+
+  std::map<std::string, size_t> index;
+  for (size_t cc = 0; cc < internals.Records.size(); ++cc)
+  {
+    index[internals.Records[cc].Stack] = cc;
+  }
+
+  std::vector<bool> merged(internals.Records.size(), false);
+  for (const auto& record : otherInternals.Records)
+  {
+    auto iter = index.find(record.Stack);
+    if (iter == index.end())
+    {
+      // none of the processes gathered so far executed this algorithm.
+      internals.Records.push_back(record);
+      if (internals.NumberOfProcesses > 0)
+      {
+        internals.Records.back().MinTime = 0.0;
+      }
+      continue;
+    }
+
+    auto& mine = internals.Records[iter->second];
+    mine.Calls += record.Calls;
+    mine.MinTime = std::min(mine.MinTime, record.MinTime);
+    mine.MaxTime = std::max(mine.MaxTime, record.MaxTime);
+    mine.TotalTime += record.TotalTime;
+    mine.Memory += record.Memory;
+    merged[iter->second] = true;
+  }
+
+  if (otherInternals.NumberOfProcesses > 0)
+  {
+    for (size_t cc = 0; cc < merged.size(); ++cc)
+    {
+      // none of the other processes executed this algorithm.
+      internals.Records[cc].MinTime = merged[cc] ? internals.Records[cc].MinTime : 0.0;
+    }
+  }
+  internals.NumberOfProcesses += otherInternals.NumberOfProcesses;
+}
+
+//-----------------------------------------------------------------------------
+void vtkPVPipelineProfilerInformation::CopyToStream(vtkClientServerStream* css)
+{
+  const vtkInternals& internals = *this->Internals;
+  css->Reset();
+  *css << vtkClientServerStream::Reply << internals.NumberOfProcesses
+       << static_cast<int>(internals.Records.size());
+  for (const auto& record : internals.Records)
+  {
+    *css << record.Stack.c_str() << record.Calls << record.MinTime << record.MaxTime
+         << record.TotalTime << record.Memory;
+  }
+  *css << vtkClientServerStream::End;
+}
+
+//-----------------------------------------------------------------------------
+void vtkPVPipelineProfilerInformation::CopyFromStream(const vtkClientServerStream* css)
+{
+  vtkInternals& internals = *this->Internals;
+  internals.NumberOfProcesses = 0;
+  internals.Records.clear();
+
+  int offset = 0;
+  int numRecords = 0;
+  vtkVerifyParseMacro(
+    css->GetArgument(0, offset++, &internals.NumberOfProcesses), "number of processes");
+  vtkVerifyParseMacro(css->GetArgument(0, offset++, &numRecords), "number of records");
+  internals.Records.resize(numRecords);
+  for (auto& record : internals.Records)
+  {
+    vtkVerifyParseMacro(css->GetArgument(0, offset++, &record.Stack), "stack");
+    vtkVerifyParseMacro(css->GetArgument(0, offset++, &record.Calls), "calls");
+    vtkVerifyParseMacro(css->GetArgument(0, offset++, &record.MinTime), "min time");
+    vtkVerifyParseMacro(css->GetArgument(0, offset++, &record.MaxTime), "max time");
+    vtkVerifyParseMacro(css->GetArgument(0, offset++, &record.TotalTime), "total time");
+    vtkVerifyParseMacro(css->GetArgument(0, offset++, &record.Memory), "memory");
+  }
+}
+
+//-----------------------------------------------------------------------------
+int vtkPVPipelineProfilerInformation::GetNumberOfProcesses()
+{
+  return this->Internals->NumberOfProcesses;
+}
+
+//-----------------------------------------------------------------------------
+int vtkPVPipelineProfilerInformation::GetNumberOfRecords()
+{
+  return static_cast<int>(this->Internals->Records.size());
+}
+
+//-----------------------------------------------------------------------------
+const char* vtkPVPipelineProfilerInformation::GetRecordStack(int idx)
+{
+  const auto record = this->Internals->GetRecord(idx);
+  return record ? record->Stack.c_str() : nullptr;
+}
+
+//-----------------------------------------------------------------------------
+int vtkPVPipelineProfilerInformation::GetRecordCalls(int idx)
+{
+  const auto record = this->Internals->GetRecord(idx);
+  return record ? record->Calls : 0;
+}
+
+//-----------------------------------------------------------------------------
+double vtkPVPipelineProfilerInformation::GetRecordMinTime(int idx)
+{
+  const auto record = this->Internals->GetRecord(idx);
+  return record ? record->MinTime : 0.0;
+}
+
+//-----------------------------------------------------------------------------
+double vtkPVPipelineProfilerInformation::GetRecordMeanTime(int idx)
+{
+  const auto record = this->Internals->GetRecord(idx);
+  return record ? this->Internals->GetMeanTime(*record) : 0.0;
+}
+
+//-----------------------------------------------------------------------------
+double vtkPVPipelineProfilerInformation::GetRecordMaxTime(int idx)
+{
+  const auto record = this->Internals->GetRecord(idx);
+  return record ? record->MaxTime : 0.0;
+}
+
+//-----------------------------------------------------------------------------
+double vtkPVPipelineProfilerInformation::GetRecordImbalance(int idx)
+{
+  const auto record = this->Internals->GetRecord(idx);
+  return record ? this->Internals->GetImbalance(*record) : 0.0;
+}
+
+//-----------------------------------------------------------------------------
+vtkTypeInt64 vtkPVPipelineProfilerInformation::GetRecordMemory(int idx)
+{
+  const auto record = this->Internals->GetRecord(idx);
+  return record ? record->Memory : 0;
+}
+
+//-----------------------------------------------------------------------------
+void vtkPVPipelineProfilerInformation::SortRecords(int column)
+{
+  const vtkInternals& internals = *this->Internals;
+  using Record = vtkInternals::Record;
+  std::function<bool(const Record&, const Record&)> compare;
+  switch (column)
+  {
+    case STACK:
+      compare = [](const Record& a, const Record& b) { return a.Stack < b.Stack; };
+      break;
+    case CALLS:
+      compare = [](const Record& a, const Record& b) { return a.Calls > b.Calls; };
+      break;
+    case MIN_TIME:
+      compare = [](const Record& a, const Record& b) { return a.MinTime > b.MinTime; };
+      break;
+    case MEAN_TIME:
+      // the mean is proportional to the total time.
+      compare = [](const Record& a, const Record& b) { return a.TotalTime > b.TotalTime; };
+      break;
+    case MAX_TIME:
+      compare = [](const Record& a, const Record& b) { return a.MaxTime > b.MaxTime; };
+      break;
+    case IMBALANCE:
+      compare = [&internals](const Record& a, const Record& b) {
+        return internals.GetImbalance(a) > internals.GetImbalance(b);
+      };
+      break;
+    case MEMORY:
+      compare = [](const Record& a, const Record& b) { return a.Memory > b.Memory; };
+      break;
+    default:
+      vtkErrorMacro("Invalid column " << column);
+      return;
+  }
+  std::stable_sort(this->Internals->Records.begin(), this->Internals->Records.end(), compare);
+}
+
+//-----------------------------------------------------------------------------
+std::string vtkPVPipelineProfilerInformation::GetReport()
+{
+  const vtkInternals& internals = *this->Internals;
+  std::ostringstream stream;
+  stream << std::setw(8) << "Calls" << std::setw(12) << "Min (s)" << std::setw(12) << "Mean (s)"
+         << std::setw(12) << "Max (s)" << std::setw(10) << "Max/Mean" << std::setw(14)
+         << "Memory (KiB)"
+         << "  Algorithm\n";
+  stream << std::fixed;
+  for (const auto& record : internals.Records)
+  {
+    stream << std::setw(8) << record.Calls << std::setprecision(4) << std::setw(12)
+           << record.MinTime << std::setw(12) << internals.GetMeanTime(record) << std::setw(12)
+           << record.MaxTime << std::setprecision(2) << std::setw(10)
+           << internals.GetImbalance(record) << std::setw(14) << record.Memory << "  "
+           << record.Stack << "\n";
+  }
+  return stream.str();
+}
+
+//-----------------------------------------------------------------------------
+std::string vtkPVPipelineProfilerInformation::GetFoldedStacks()
+{
+  std::ostringstream stream;
+  for (const auto& record : this->Internals->Records)
+  {
+    stream << record.Stack << " " << static_cast<vtkTypeInt64>(record.MaxTime * 1e6) << "\n";
+  }
+  return stream.str();
+}
+
+//-----------------------------------------------------------------------------
+void vtkPVPipelineProfilerInformation::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "NumberOfProcesses: " << this->GetNumberOfProcesses() << endl;
+  os << indent << "NumberOfRecords: " << this->GetNumberOfRecords() << endl;
+}
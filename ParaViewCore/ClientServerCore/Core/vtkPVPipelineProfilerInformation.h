@@ -0,0 +1,137 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    vtkPVPipelineProfilerInformation.h
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkPVPipelineProfilerInformation
+ * @brief   gathers the vtkPVPipelineProfiler records of all processes.
+ *
+ * vtkPVPipelineProfilerInformation reduces the records of vtkPVPipelineProfiler
+ * over all the processes it is gathered from. For each algorithm (or stack of
+ * nested algorithms) it keeps the total number of executions, the minimum,
+ * mean and maximum time spent per process, and the total output memory size.
+ * Processes that never executed an algorithm count as having spent no time in
+ * it. The object passed to GatherInformation() is ignored.
+ *
+ * The records can be sorted on any column and formatted as a text table, or
+ * exported in the folded stacks format used by flame graph tools, using the
+ * maximum time over the processes.
+ *
+ * In Python:
+ * @code{.py}
+ * profiler = servermanager.misc.PipelineProfiler(Enable=1)
+ * ...
+ * info = servermanager.vtkPVPipelineProfilerInformation()
+ * session = servermanager.ActiveConnection.Session
+ * session.GatherInformation(servermanager.vtkPVSession.DATA_SERVER, info, 0)
+ * info.SortRecords(info.MAX_TIME)
+ * print(info.GetReport())
+ * @endcode
+ *
+ * @sa vtkPVPipelineProfiler
+ */
+
+#ifndef vtkPVPipelineProfilerInformation_h
+#define vtkPVPipelineProfilerInformation_h
+
+#include "vtkPVClientServerCoreCoreModule.h" //needed for exports
+#include "vtkPVInformation.h"
+
+#include <string> // for std::string
+
+class VTKPVCLIENTSERVERCORECORE_EXPORT vtkPVPipelineProfilerInformation : public vtkPVInformation
+{
+public:
+  static vtkPVPipelineProfilerInformation* New();
+  vtkTypeMacro(vtkPVPipelineProfilerInformation, vtkPVInformation);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * Transfer information about a single object into this object.
+   */
+  void CopyFromObject(vtkObject*) override;
+
+  /**
+   * Merge another information object.
+   */
+  void AddInformation(vtkPVInformation*) override;
+
+  //@{
+  /**
+   * Manage a serialized version of the information.
+   */
+  void CopyToStream(vtkClientServerStream*) override;
+  void CopyFromStream(const vtkClientServerStream*) override;
+  //@}
+
+  /**
+   * Returns the number of processes the records were gathered from.
+   */
+  int GetNumberOfProcesses();
+
+  //@{
+  /**
+   * Access the records. Times are in seconds, memory in kibibytes. The
+   * imbalance is the ratio of the maximum to the mean time.
+   */
+  int GetNumberOfRecords();
+  const char* GetRecordStack(int idx);
+  int GetRecordCalls(int idx);
+  double GetRecordMinTime(int idx);
+  double GetRecordMeanTime(int idx);
+  double GetRecordMaxTime(int idx);
+  double GetRecordImbalance(int idx);
+  vtkTypeInt64 GetRecordMemory(int idx);
+  //@}
+
+  enum Columns
+  {
+    STACK,
+    CALLS,
+    MIN_TIME,
+    MEAN_TIME,
+    MAX_TIME,
+    IMBALANCE,
+    MEMORY
+  };
+
+  /**
+   * Sorts the records on a column, in decreasing order except for STACK.
+   */
+  void SortRecords(int column);
+
+  /**
+   * Returns the records formatted as a text table.
+   */
+  std::string GetReport();
+
+  /**
+   * Returns the records in the folded stacks format, one line per record with
+   * the maximum time in microseconds. This can be loaded by flame graph tools
+   * such as flamegraph.pl or https://www.speedscope.app.
+   */
+  std::string GetFoldedStacks();
+
+protected:
+  vtkPVPipelineProfilerInformation();
+  ~vtkPVPipelineProfilerInformation() override;
+
+private:
+  vtkPVPipelineProfilerInformation(const vtkPVPipelineProfilerInformation&) = delete;
+  void operator=(const vtkPVPipelineProfilerInformation&) = delete;
+
+  class vtkInternals;
+  vtkInternals* Internals;
+};
+
+#endif
@@ -104,6 +104,7 @@ bool vtkProcessModule::FinalizePython = false;
 
 vtkSmartPointer<vtkProcessModule> vtkProcessModule::Singleton;
 vtkSmartPointer<vtkMultiProcessController> vtkProcessModule::GlobalController;
+vtkSmartPointer<vtkMultiProcessController> vtkProcessModule::WorldController;
 
 int vtkProcessModule::DefaultMinimumGhostLevelsToRequestForUnstructuredPipelines = 1;
 int vtkProcessModule::DefaultMinimumGhostLevelsToRequestForStructuredPipelines = 0;
@@ -308,6 +309,7 @@ bool vtkProcessModule::Finalize()
   vtkMultiProcessController::SetGlobalController(NULL);
   vtkProcessModule::GlobalController->Finalize(/*finalizedExternally*/ 1);
   vtkProcessModule::GlobalController = NULL;
+  vtkProcessModule::WorldController = NULL;
 
 #if VTK_MODULE_ENABLE_VTK_ParallelMPI
   if (vtkProcessModule::FinalizeMPI)
@@ -359,6 +361,8 @@ vtkProcessModule::vtkProcessModule()
   this->MaxSessionId = 0;
   this->ReportInterpreterErrors = true;
   this->SymmetricMPIMode = false;
+  this->TimeParallelGroup = 0;
+  this->NumberOfTimeParallelGroups = 1;
   this->MultipleSessionsSupport = false; // Set MULTI-SERVER to false as DEFAULT
   this->EventCallDataSessionId = 0;
 
@@ -538,7 +542,52 @@ void vtkProcessModule::SetOptions(vtkPVOptions* options)
   if (options)
   {
     this->SetSymmetricMPIMode(options->GetSymmetricMPIMode() != 0);
+    if (options->GetTimeParallelGroups() > 1 && this->NumberOfTimeParallelGroups == 1 &&
+      vtkProcessModule::ProcessType == PROCESS_BATCH)
+    {
+      this->SplitIntoTimeParallelGroups(options->GetTimeParallelGroups());
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+bool vtkProcessModule::SplitIntoTimeParallelGroups(int numberOfGroups)
+{
+  // this must happen before any session is created since sessions use the
+  // global controller.
+  assert(this->Internals->Sessions.empty());
+
+  vtkMultiProcessController* world = vtkProcessModule::GlobalController;
+  const int numRanks = world->GetNumberOfProcesses();
+  if (numberOfGroups > numRanks)
+  {
+    vtkWarningMacro("Cannot split " << numRanks << " ranks into " << numberOfGroups
+                                    << " time-parallel groups. Using " << numRanks
+                                    << " groups instead.");
+    numberOfGroups = numRanks;
   }
+  if (numberOfGroups <= 1)
+  {
+    return false;
+  }
+
+  // groups are made of contiguous ranks, which are typically on the same node.
+  const int rank = world->GetLocalProcessId();
+  const int group = static_cast<int>((static_cast<vtkTypeInt64>(rank) * numberOfGroups) / numRanks);
+  vtkMultiProcessController* groupController = world->PartitionController(group, rank);
+  if (!groupController)
+  {
+    vtkErrorMacro("Failed to split ranks into time-parallel groups.");
+    return false;
+  }
+
+  vtkProcessModule::WorldController = world;
+  vtkProcessModule::GlobalController.TakeReference(groupController);
+  vtkProcessModule::GlobalController->BroadcastTriggerRMIOn();
+  vtkMultiProcessController::SetGlobalController(vtkProcessModule::GlobalController);
+  this->TimeParallelGroup = group;
+  this->NumberOfTimeParallelGroups = numberOfGroups;
+  return true;
 }
 
 //----------------------------------------------------------------------------
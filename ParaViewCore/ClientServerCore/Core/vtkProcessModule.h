@@ -246,6 +246,17 @@ public:
   vtkBooleanMacro(ReportInterpreterErrors, bool);
   //@}
 
+  //@{
+  /**
+   * When running time-parallel, the ranks are split into groups that each
+   * process their own subset of the animation frames. The global controller
+   * then only includes the ranks of the local group. Returns 0 and 1 when not
+   * running time-parallel.
+   */
+  vtkGetMacro(TimeParallelGroup, int);
+  vtkGetMacro(NumberOfTimeParallelGroups, int);
+  //@}
+
   //@{
   /**
    * Returns true if ParaView is to be run in symmetric mode. Symmetric mode
@@ -342,6 +353,10 @@ private:
 
   void DetermineExecutablePath(int argc, char** argv);
 
+  // Splits the global controller into groups of contiguous ranks for
+  // time-parallel processing.
+  bool SplitIntoTimeParallelGroups(int numberOfGroups);
+
   // Helper to initialize Python environment. This doesn't initialize Python
   // but simply sets up the environment so when Python is initialized, it can
   // find ParaView modules. This does nothing if not build with Python support.
@@ -359,8 +374,15 @@ private:
   static vtkSmartPointer<vtkProcessModule> Singleton;
   static vtkSmartPointer<vtkMultiProcessController> GlobalController;
 
+  // The controller for all ranks, when GlobalController only has the ranks of
+  // a time-parallel group.
+  static vtkSmartPointer<vtkMultiProcessController> WorldController;
+
   bool SymmetricMPIMode;
 
+  int TimeParallelGroup;
+  int NumberOfTimeParallelGroups;
+
   bool MultipleSessionsSupport;
 
   vtkIdType EventCallDataSessionId;
@@ -40,13 +40,17 @@
 #include "vtkPVExtractSelection.h"
 #include "vtkPVFileInformation.h"
 #include "vtkPVFileInformationHelper.h"
+#include "vtkPVFrameTimerLog.h"
+#include "vtkPVFrameTimerLogInformation.h"
 #include "vtkPVGenericAttributeInformation.h"
 #include "vtkPVImplicitPlaneRepresentation.h"
 #include "vtkPVInformation.h"
+#include "vtkPVLODPyramid.h"
 #include "vtkPVLastSelectionInformation.h"
 #include "vtkPVOptions.h"
 #include "vtkPVOptionsXMLParser.h"
 #include "vtkPVParallelCoordinatesRepresentation.h"
+#include "vtkPVPipelineProfilerInformation.h"
 #include "vtkPVPlugin.h"
 #include "vtkPVPluginLoader.h"
 #include "vtkPVPluginTracker.h"
@@ -56,6 +60,7 @@
 #include "vtkPVPythonPluginInterface.h"
 #include "vtkPVRenderView.h"
 #include "vtkPVRenderingCapabilitiesInformation.h"
+#include "vtkPVRenderingCostModel.h"
 #include "vtkPVRepresentedDataInformation.h"
 #include "vtkPVSILInformation.h"
 #include "vtkPVSelectionInformation.h"
@@ -136,13 +141,17 @@ int ParaViewCoreClientServerCorePrintSelf(int, char* [])
   PRINT_SELF(vtkPVExtractSelection);
   PRINT_SELF(vtkPVFileInformation);
   PRINT_SELF(vtkPVFileInformationHelper);
+  PRINT_SELF(vtkPVFrameTimerLog);
+  PRINT_SELF(vtkPVFrameTimerLogInformation);
   PRINT_SELF(vtkPVGenericAttributeInformation);
   PRINT_SELF(vtkPVImplicitPlaneRepresentation);
   PRINT_SELF(vtkPVInformation);
+  PRINT_SELF(vtkPVLODPyramid);
   PRINT_SELF(vtkPVLastSelectionInformation);
   PRINT_SELF(vtkPVOptions);
   PRINT_SELF(vtkPVOptionsXMLParser);
   PRINT_SELF(vtkPVParallelCoordinatesRepresentation);
+  PRINT_SELF(vtkPVPipelineProfilerInformation);
   // PRINT_SELF(vtkPVPlugin);
   PRINT_SELF(vtkPVPluginLoader);
   PRINT_SELF(vtkPVPluginTracker);
@@ -151,6 +160,7 @@ int ParaViewCoreClientServerCorePrintSelf(int, char* [])
   // PRINT_SELF(vtkPVPythonModule);
   // PRINT_SELF(vtkPVPythonPluginInterface);
   // PRINT_SELF(vtkPVRenderView);
+  PRINT_SELF(vtkPVRenderingCostModel);
   PRINT_SELF(vtkPVRepresentedDataInformation);
   PRINT_SELF(vtkPVSILInformation);
   PRINT_SELF(vtkPVSelectionInformation);
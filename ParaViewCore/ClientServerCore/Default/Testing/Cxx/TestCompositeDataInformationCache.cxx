@@ -0,0 +1,94 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    TestCompositeDataInformationCache.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkDoubleArray.h"
+#include "vtkInformation.h"
+#include "vtkInformationObjectBaseKey.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkPVCompositeDataInformation.h"
+#include "vtkPVDataInformation.h"
+#include "vtkPointData.h"
+#include "vtkPolyData.h"
+#include "vtkSmartPointer.h"
+#include "vtkSphereSource.h"
+
+#include <iostream>
+
+#define TEST_ASSERT(cond)                                                                          \
+  if (!(cond))                                                                                     \
+  {                                                                                                \
+    std::cerr << "ERROR: failed at line " << __LINE__ << ": " #cond << std::endl;                  \
+    return EXIT_FAILURE;                                                                           \
+  }
+
+namespace
+{
+vtkSmartPointer<vtkPolyData> GetSphere(int resolution)
+{
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetThetaResolution(resolution);
+  sphere->SetPhiResolution(resolution);
+  sphere->Update();
+  return sphere->GetOutput();
+}
+
+vtkObjectBase* GetCachedInformation(vtkDataObject* block)
+{
+  return block->GetInformation()->Get(vtkPVDataInformation::CACHED_INFORMATION());
+}
+}
+
+int TestCompositeDataInformationCache(int, char* [])
+{
+  vtkSmartPointer<vtkPolyData> block0 = GetSphere(8);
+  vtkSmartPointer<vtkPolyData> block1 = GetSphere(16);
+
+  vtkNew<vtkMultiBlockDataSet> data;
+  data->SetBlock(0, block0);
+  data->SetBlock(1, block1);
+
+  vtkNew<vtkPVDataInformation> info;
+  info->CopyFromObject(data.Get());
+  const vtkTypeInt64 numberOfPoints = info->GetNumberOfPoints();
+  TEST_ASSERT(numberOfPoints == block0->GetNumberOfPoints() + block1->GetNumberOfPoints());
+
+  // hold on to the cached instances so that their addresses stay unique.
+  vtkSmartPointer<vtkObjectBase> cached0 = GetCachedInformation(block0);
+  vtkSmartPointer<vtkObjectBase> cached1 = GetCachedInformation(block1);
+  TEST_ASSERT(cached0 && cached1);
+
+  // Gathering again must reuse the cached information and not accumulate
+  // into it.
+  info->CopyFromObject(data.Get());
+  TEST_ASSERT(info->GetNumberOfPoints() == numberOfPoints);
+  TEST_ASSERT(GetCachedInformation(block0) == cached0);
+  TEST_ASSERT(GetCachedInformation(block1) == cached1);
+  TEST_ASSERT(info->GetCompositeDataInformation()->GetDataInformation(1)->GetNumberOfPoints() ==
+    block1->GetNumberOfPoints());
+
+  // Only the modified block is traversed again.
+  vtkNew<vtkDoubleArray> array;
+  array->SetName("Temperature");
+  array->SetNumberOfTuples(block1->GetNumberOfPoints());
+  array->FillComponent(0, 1.0);
+  block1->GetPointData()->AddArray(array.Get());
+
+  info->CopyFromObject(data.Get());
+  TEST_ASSERT(GetCachedInformation(block0) == cached0);
+  TEST_ASSERT(GetCachedInformation(block1) != cached1);
+  TEST_ASSERT(info->GetArrayInformation("Temperature", vtkDataObject::POINT) != nullptr);
+  TEST_ASSERT(info->GetNumberOfPoints() == numberOfPoints);
+  return EXIT_SUCCESS;
+}
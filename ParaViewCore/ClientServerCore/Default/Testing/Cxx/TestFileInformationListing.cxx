@@ -0,0 +1,152 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    TestFileInformationListing.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkClientServerStream.h"
+#include "vtkCollection.h"
+#include "vtkNew.h"
+#include "vtkPVFileInformation.h"
+#include "vtkPVFileInformationHelper.h"
+
+#include <vtksys/SystemTools.hxx>
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#if !defined(_WIN32)
+#include <utime.h>
+#endif
+
+#define TEST_ASSERT(cond)                                                                          \
+  if (!(cond))                                                                                     \
+  {                                                                                                \
+    cerr << "ERROR: Condition FAILED!! : " << #cond << endl;                                      \
+    return EXIT_FAILURE;                                                                           \
+  }
+
+namespace
+{
+vtkPVFileInformation* GetItem(vtkPVFileInformation* info, int index)
+{
+  return vtkPVFileInformation::SafeDownCast(info->GetContents()->GetItemAsObject(index));
+}
+}
+
+int TestFileInformationListing(int, char* [])
+{
+  const std::string dir =
+    vtksys::SystemTools::GetCurrentWorkingDirectory() + "/TestFileInformationListing";
+  vtksys::SystemTools::RemoveADirectory(dir);
+  vtksys::SystemTools::MakeDirectory(dir);
+  vtksys::SystemTools::MakeDirectory(dir + "/sub");
+  vtksys::SystemTools::Touch(dir + "/readme.txt", true);
+  for (int cc = 9; cc <= 120; cc++)
+  {
+    char name[32];
+    snprintf(name, sizeof(name), "/can_%04d.vtk", cc);
+    vtksys::SystemTools::Touch(dir + name, true);
+  }
+
+  vtkNew<vtkPVFileInformationHelper> helper;
+  helper->SetPath(dir.c_str());
+  helper->SetDirectoryListing(1);
+
+  // Complete listing, sent through a stream as the server does.
+  vtkNew<vtkPVFileInformation> serverInfo;
+  serverInfo->CopyFromObject(helper.GetPointer());
+  TEST_ASSERT(serverInfo->GetContents()->GetNumberOfItems() == 3);
+  TEST_ASSERT(serverInfo->GetTotalNumberOfEntries() == 3);
+  TEST_ASSERT(helper->GetListingCache() == nullptr);
+
+  // Complete listings are sorted by name, as pages are.
+  TEST_ASSERT(std::string(GetItem(serverInfo.GetPointer(), 0)->GetName()) == "can_..vtk");
+  TEST_ASSERT(std::string(GetItem(serverInfo.GetPointer(), 1)->GetName()) == "readme.txt");
+  TEST_ASSERT(std::string(GetItem(serverInfo.GetPointer(), 2)->GetName()) == "sub");
+
+  vtkClientServerStream stream;
+  serverInfo->CopyToStream(&stream);
+  vtkNew<vtkPVFileInformation> info;
+  info->CopyFromStream(&stream);
+  TEST_ASSERT(info->GetContents()->GetNumberOfItems() == 3);
+
+  vtkPVFileInformation* group = nullptr;
+  for (int cc = 0; cc < 3; cc++)
+  {
+    vtkPVFileInformation* item = GetItem(info.GetPointer(), cc);
+    if (item->GetType() == vtkPVFileInformation::FILE_GROUP)
+    {
+      group = item;
+    }
+  }
+  TEST_ASSERT(group != nullptr);
+  TEST_ASSERT(group->GetContents()->GetNumberOfItems() == 112);
+
+  const std::string prefix = std::string(serverInfo->GetFullPath()) + "/";
+  vtkPVFileInformation* first = GetItem(group, 0);
+  vtkPVFileInformation* last = GetItem(group, 111);
+  TEST_ASSERT(std::string(first->GetName()) == "can_0009.vtk");
+  TEST_ASSERT(std::string(first->GetFullPath()) == prefix + "can_0009.vtk");
+  TEST_ASSERT(first->GetType() == vtkPVFileInformation::SINGLE_FILE);
+  TEST_ASSERT(std::string(last->GetName()) == "can_0120.vtk");
+  TEST_ASSERT(std::string(last->GetFullPath()) == prefix + "can_0120.vtk");
+
+  // The same listing, one page of two entries at a time.
+  helper->SetMaximumListingSize(2);
+  vtkNew<vtkPVFileInformation> page;
+  page->CopyFromObject(helper.GetPointer());
+  TEST_ASSERT(page->GetTotalNumberOfEntries() == 3);
+  TEST_ASSERT(page->GetContents()->GetNumberOfItems() == 2);
+  TEST_ASSERT(std::string(GetItem(page.GetPointer(), 0)->GetName()) == "can_..vtk");
+  TEST_ASSERT(std::string(GetItem(page.GetPointer(), 1)->GetName()) == "readme.txt");
+  TEST_ASSERT(helper->GetListingCache() != nullptr);
+
+  // Another helper pages through its own listing meanwhile.
+  vtkNew<vtkPVFileInformationHelper> otherHelper;
+  otherHelper->SetPath((dir + "/sub").c_str());
+  otherHelper->SetDirectoryListing(1);
+  otherHelper->SetMaximumListingSize(2);
+  vtkNew<vtkPVFileInformation> otherPage;
+  otherPage->CopyFromObject(otherHelper.GetPointer());
+  TEST_ASSERT(otherPage->GetTotalNumberOfEntries() == 0);
+  TEST_ASSERT(helper->GetListingCache() != nullptr);
+
+  helper->SetListingOffset(2);
+  page->CopyFromObject(helper.GetPointer());
+  TEST_ASSERT(page->GetTotalNumberOfEntries() == 3);
+  TEST_ASSERT(page->GetContents()->GetNumberOfItems() == 1);
+  TEST_ASSERT(std::string(GetItem(page.GetPointer(), 0)->GetName()) == "sub");
+  TEST_ASSERT(GetItem(page.GetPointer(), 0)->GetType() == vtkPVFileInformation::DIRECTORY);
+  TEST_ASSERT(helper->GetListingCache() == nullptr);
+
+#if !defined(_WIN32)
+  // A directory modified between two pages is listed again.
+  helper->SetListingOffset(0);
+  page->CopyFromObject(helper.GetPointer());
+  TEST_ASSERT(page->GetTotalNumberOfEntries() == 3);
+  TEST_ASSERT(helper->GetListingCache() != nullptr);
+  vtksys::SystemTools::Touch(dir + "/notes.txt", true);
+  struct utimbuf times;
+  times.actime = times.modtime = 1000000;
+  TEST_ASSERT(utime(dir.c_str(), &times) == 0);
+  helper->SetListingOffset(2);
+  page->CopyFromObject(helper.GetPointer());
+  TEST_ASSERT(page->GetTotalNumberOfEntries() == 4);
+  TEST_ASSERT(page->GetContents()->GetNumberOfItems() == 2);
+  TEST_ASSERT(std::string(GetItem(page.GetPointer(), 0)->GetName()) == "readme.txt");
+  TEST_ASSERT(std::string(GetItem(page.GetPointer(), 1)->GetName()) == "sub");
+#endif
+
+  vtksys::SystemTools::RemoveADirectory(dir);
+  return EXIT_SUCCESS;
+}
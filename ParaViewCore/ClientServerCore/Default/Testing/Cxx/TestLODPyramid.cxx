@@ -0,0 +1,193 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    TestLODPyramid.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
+#include "vtkFloatArray.h"
+#include "vtkIdTypeArray.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPVLODPyramid.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSmartPointer.h"
+
+namespace
+{
+// Returns a multiblock with a single n x n grid of quads, with the x coordinate
+// of the points as point data and the cell index as cell data.
+vtkSmartPointer<vtkMultiBlockDataSet> GetGrid(int n)
+{
+  vtkNew<vtkPoints> points;
+  vtkNew<vtkFloatArray> x;
+  x->SetName("X");
+  for (int j = 0; j < n; ++j)
+  {
+    for (int i = 0; i < n; ++i)
+    {
+      points->InsertNextPoint(i, j, 0.0);
+      x->InsertNextValue(static_cast<float>(i));
+    }
+  }
+
+  vtkNew<vtkCellArray> polys;
+  vtkNew<vtkIdTypeArray> cellIndex;
+  cellIndex->SetName("CellIndex");
+  for (int j = 0; j + 1 < n; ++j)
+  {
+    for (int i = 0; i + 1 < n; ++i)
+    {
+      const vtkIdType quad[4] = { j * n + i, j * n + i + 1, (j + 1) * n + i + 1, (j + 1) * n + i };
+      cellIndex->InsertNextValue(polys->InsertNextCell(4, quad));
+    }
+  }
+
+  vtkNew<vtkPolyData> pd;
+  pd->SetPoints(points.GetPointer());
+  pd->SetPolys(polys.GetPointer());
+  pd->GetPointData()->AddArray(x.GetPointer());
+  pd->GetCellData()->AddArray(cellIndex.GetPointer());
+
+  vtkSmartPointer<vtkMultiBlockDataSet> mb = vtkSmartPointer<vtkMultiBlockDataSet>::New();
+  mb->SetBlock(0, pd.GetPointer());
+  return mb;
+}
+
+vtkPolyData* GetBlock(vtkDataObject* level)
+{
+  vtkMultiBlockDataSet* mb = vtkMultiBlockDataSet::SafeDownCast(level);
+  return mb ? vtkPolyData::SafeDownCast(mb->GetBlock(0)) : nullptr;
+}
+
+// Cancels the decimation as soon as the coarsest level is built.
+class vtkAbortedLODPyramid : public vtkPVLODPyramid
+{
+public:
+  static vtkAbortedLODPyramid* New();
+  vtkTypeMacro(vtkAbortedLODPyramid, vtkPVLODPyramid);
+
+protected:
+  void LevelBuilt(int level) override
+  {
+    if (level == 0)
+    {
+      this->Abort();
+    }
+  }
+};
+vtkStandardNewMacro(vtkAbortedLODPyramid);
+}
+
+int TestLODPyramid(int, char* [])
+{
+  vtkNew<vtkPVLODPyramid> pyramid;
+
+  // Levels are built coarsest first and keep the attributes of the points
+  // and cells they come from.
+  vtkSmartPointer<vtkMultiBlockDataSet> grid = GetGrid(400);
+  vtkPolyData* input = vtkPolyData::SafeDownCast(grid->GetBlock(0));
+  pyramid->Start(grid.GetPointer(), 0.5);
+  if (pyramid->GetResolution() != 0.5)
+  {
+    cerr << "ERROR: unexpected resolution: " << pyramid->GetResolution() << endl;
+    return EXIT_FAILURE;
+  }
+
+  vtkPolyData* first = GetBlock(pyramid->GetFinestLevel());
+  if (!first || first->GetNumberOfPoints() == 0 ||
+    first->GetNumberOfPoints() >= input->GetNumberOfPoints())
+  {
+    cerr << "ERROR: first level was not decimated." << endl;
+    return EXIT_FAILURE;
+  }
+  const vtkIdType firstNumberOfPoints = first->GetNumberOfPoints();
+
+  pyramid->Wait();
+  if (pyramid->GetNumberOfLevels() != 3)
+  {
+    cerr << "ERROR: unexpected number of levels: " << pyramid->GetNumberOfLevels() << endl;
+    return EXIT_FAILURE;
+  }
+
+  vtkPolyData* finest = GetBlock(pyramid->GetFinestLevel());
+  const int divs = vtkPVLODPyramid::GetNumberOfDivisions(0.5);
+  if (!finest || finest->GetNumberOfPoints() < firstNumberOfPoints ||
+    finest->GetNumberOfPoints() > divs * divs)
+  {
+    cerr << "ERROR: unexpected number of points in the finest level." << endl;
+    return EXIT_FAILURE;
+  }
+
+  vtkFloatArray* x = vtkFloatArray::SafeDownCast(finest->GetPointData()->GetArray("X"));
+  if (!x || x->GetNumberOfTuples() != finest->GetNumberOfPoints())
+  {
+    cerr << "ERROR: point data was not copied." << endl;
+    return EXIT_FAILURE;
+  }
+  for (vtkIdType cc = 0; cc < finest->GetNumberOfPoints(); ++cc)
+  {
+    if (x->GetValue(cc) != finest->GetPoint(cc)[0])
+    {
+      cerr << "ERROR: point data does not match point " << cc << endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  vtkIdTypeArray* cellIndex =
+    vtkIdTypeArray::SafeDownCast(finest->GetCellData()->GetArray("CellIndex"));
+  if (finest->GetNumberOfPolys() == 0 || !cellIndex ||
+    cellIndex->GetNumberOfTuples() != finest->GetNumberOfCells())
+  {
+    cerr << "ERROR: cell data was not copied." << endl;
+    return EXIT_FAILURE;
+  }
+
+  // Aborting keeps the levels already built, and stopping releases them.
+  vtkNew<vtkAbortedLODPyramid> aborted;
+  aborted->Start(grid.GetPointer(), 1.0);
+  aborted->Wait();
+  if (aborted->GetNumberOfLevels() != 1 || aborted->GetResolution() != 1.0)
+  {
+    cerr << "ERROR: aborting did not stop after the first level." << endl;
+    return EXIT_FAILURE;
+  }
+  vtkPolyData* coarsest = GetBlock(aborted->GetFinestLevel());
+  const int coarsestDivs = vtkPVLODPyramid::GetNumberOfDivisions(0.0);
+  if (!coarsest || coarsest->GetNumberOfPoints() == 0 ||
+    coarsest->GetNumberOfPoints() > coarsestDivs * coarsestDivs)
+  {
+    cerr << "ERROR: the coarsest level was not kept." << endl;
+    return EXIT_FAILURE;
+  }
+
+  pyramid->Start(grid.GetPointer(), 1.0);
+  pyramid->Stop();
+  if (pyramid->GetResolution() != -1.0 || pyramid->GetFinestLevel() != nullptr)
+  {
+    cerr << "ERROR: levels were not released." << endl;
+    return EXIT_FAILURE;
+  }
+
+  // Only multiblocks of polydata are decimated.
+  pyramid->Start(input, 0.5);
+  if (pyramid->GetFinestLevel() != nullptr)
+  {
+    cerr << "ERROR: unexpected level for a polydata input." << endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -12,6 +12,7 @@
      PURPOSE.  See the above copyright notice for more information.
 
 =========================================================================*/
+#include "vtkDoubleArray.h"
 #include "vtkFloatArray.h"
 #include "vtkMathUtilities.h"
 #include "vtkNew.h"
@@ -138,5 +139,38 @@ int TestPVArrayInformation(int, char* [])
     return EXIT_FAILURE;
   }
 
+  // Ranges of a multi-component array computed in a single pass must match
+  // the ones computed by vtkDataArray, including the magnitude (-1).
+  vtkNew<vtkDoubleArray> vectors;
+  vectors->SetNumberOfComponents(3);
+  for (vtkIdType cc = 0; cc < 1000; ++cc)
+  {
+    vectors->InsertNextTuple3(cc * 0.5, -cc * 2.0, (cc % 7) - 3.0);
+  }
+  vectors->SetComponent(10, 1, vtkMath::Nan());
+  vectors->SetComponent(20, 2, -vtkMath::Inf());
+  info->CopyFromObject(vectors.Get());
+  for (int comp = -1; comp < 3; ++comp)
+  {
+    double expected[2], expectedFinite[2];
+    vectors->GetRange(expected, comp);
+    vectors->GetFiniteRange(expectedFinite, comp);
+    info->GetComponentRange(comp, rangeArray);
+    if (rangeArray[0] != expected[0] || rangeArray[1] != expected[1])
+    {
+      cerr << "ERROR: wrong range for component " << comp << ": " << rangeArray[0] << " "
+           << rangeArray[1] << endl;
+      return EXIT_FAILURE;
+    }
+    info->GetComponentFiniteRange(comp, rangeArray);
+    if (!vtkMathUtilities::FuzzyCompare(rangeArray[0], expectedFinite[0]) ||
+      !vtkMathUtilities::FuzzyCompare(rangeArray[1], expectedFinite[1]))
+    {
+      cerr << "ERROR: wrong finite range for component " << comp << ": " << rangeArray[0] << " "
+           << rangeArray[1] << endl;
+      return EXIT_FAILURE;
+    }
+  }
+
   return EXIT_SUCCESS;
 }
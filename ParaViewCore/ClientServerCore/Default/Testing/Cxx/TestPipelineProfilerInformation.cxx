@@ -0,0 +1,153 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    TestPipelineProfilerInformation.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkClientServerStream.h"
+#include "vtkNew.h"
+#include "vtkPVPipelineProfilerInformation.h"
+#include "vtkSmartPointer.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#define TEST_ASSERT(x)                                                                             \
+  if (!(x))                                                                                        \
+  {                                                                                                \
+    cerr << "ERROR: failed at " << __LINE__ << "!" << endl;                                        \
+    return EXIT_FAILURE;                                                                           \
+  }
+
+namespace
+{
+struct Record
+{
+  const char* Stack;
+  int Calls;
+  double Time;
+  vtkTypeInt64 Memory;
+};
+
+// Returns the information a single process with these records sends.
+vtkSmartPointer<vtkPVPipelineProfilerInformation> GetInformation(
+  const std::vector<Record>& records)
+{
+  vtkClientServerStream stream;
+  stream << vtkClientServerStream::Reply << 1 << static_cast<int>(records.size());
+  for (const Record& record : records)
+  {
+    stream << record.Stack << record.Calls << record.Time << record.Time << record.Time
+           << record.Memory;
+  }
+  stream << vtkClientServerStream::End;
+
+  auto info = vtkSmartPointer<vtkPVPipelineProfilerInformation>::New();
+  info->CopyFromStream(&stream);
+  return info;
+}
+
+int FindRecord(vtkPVPipelineProfilerInformation* info, const std::string& stack)
+{
+  for (int cc = 0; cc < info->GetNumberOfRecords(); ++cc)
+  {
+    if (stack == info->GetRecordStack(cc))
+    {
+      return cc;
+    }
+  }
+  return -1;
+}
+
+bool IsClose(double value, double expected)
+{
+  return std::abs(value - expected) < 1e-9;
+}
+
+bool HasOrder(vtkPVPipelineProfilerInformation* info, const std::vector<std::string>& stacks)
+{
+  for (int cc = 0; cc < static_cast<int>(stacks.size()); ++cc)
+  {
+    if (cc >= info->GetNumberOfRecords() || stacks[cc] != info->GetRecordStack(cc))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestPipelineProfilerInformation(int, char* [])
+{
+  // Only the first process clipped, only the second one contoured.
+  vtkSmartPointer<vtkPVPipelineProfilerInformation> info = GetInformation(
+    { { "Sphere", 1, 0.25, 100 }, { "Sphere;Clip", 2, 0.5, 50 } });
+  vtkSmartPointer<vtkPVPipelineProfilerInformation> other = GetInformation(
+    { { "Sphere", 1, 0.125, 100 }, { "Contour", 1, 0.75, 10 } });
+  info->AddInformation(other);
+  TEST_ASSERT(info->GetNumberOfProcesses() == 2);
+  TEST_ASSERT(info->GetNumberOfRecords() == 3);
+
+  const int sphere = FindRecord(info, "Sphere");
+  TEST_ASSERT(sphere != -1);
+  TEST_ASSERT(info->GetRecordCalls(sphere) == 2);
+  TEST_ASSERT(IsClose(info->GetRecordMinTime(sphere), 0.125));
+  TEST_ASSERT(IsClose(info->GetRecordMeanTime(sphere), 0.1875));
+  TEST_ASSERT(IsClose(info->GetRecordMaxTime(sphere), 0.25));
+  TEST_ASSERT(IsClose(info->GetRecordImbalance(sphere), 0.25 / 0.1875));
+  TEST_ASSERT(info->GetRecordMemory(sphere) == 200);
+
+  // Records missing on some processes have a minimum of 0 and are averaged
+  // over all processes.
+  const int clip = FindRecord(info, "Sphere;Clip");
+  TEST_ASSERT(clip != -1);
+  TEST_ASSERT(info->GetRecordCalls(clip) == 2);
+  TEST_ASSERT(IsClose(info->GetRecordMinTime(clip), 0.0));
+  TEST_ASSERT(IsClose(info->GetRecordMeanTime(clip), 0.25));
+  TEST_ASSERT(IsClose(info->GetRecordMaxTime(clip), 0.5));
+  TEST_ASSERT(IsClose(info->GetRecordImbalance(clip), 2.0));
+
+  const int contour = FindRecord(info, "Contour");
+  TEST_ASSERT(contour != -1);
+  TEST_ASSERT(IsClose(info->GetRecordMinTime(contour), 0.0));
+  TEST_ASSERT(IsClose(info->GetRecordMeanTime(contour), 0.375));
+  TEST_ASSERT(IsClose(info->GetRecordMaxTime(contour), 0.75));
+  TEST_ASSERT(IsClose(info->GetRecordImbalance(contour), 2.0));
+  TEST_ASSERT(info->GetRecordMemory(contour) == 10);
+
+  // A serialized copy has the same records.
+  vtkClientServerStream stream;
+  info->CopyToStream(&stream);
+  vtkNew<vtkPVPipelineProfilerInformation> copy;
+  copy->CopyFromStream(&stream);
+  TEST_ASSERT(copy->GetNumberOfProcesses() == 2);
+  TEST_ASSERT(copy->GetReport() == info->GetReport());
+
+  info->SortRecords(vtkPVPipelineProfilerInformation::MAX_TIME);
+  TEST_ASSERT(HasOrder(info, { "Contour", "Sphere;Clip", "Sphere" }));
+  info->SortRecords(vtkPVPipelineProfilerInformation::MIN_TIME);
+  TEST_ASSERT(HasOrder(info, { "Sphere" }));
+  info->SortRecords(vtkPVPipelineProfilerInformation::MEAN_TIME);
+  TEST_ASSERT(HasOrder(info, { "Contour", "Sphere;Clip", "Sphere" }));
+  info->SortRecords(vtkPVPipelineProfilerInformation::IMBALANCE);
+  TEST_ASSERT(FindRecord(info, "Sphere") == 2);
+  info->SortRecords(vtkPVPipelineProfilerInformation::CALLS);
+  TEST_ASSERT(FindRecord(info, "Contour") == 2);
+  info->SortRecords(vtkPVPipelineProfilerInformation::MEMORY);
+  TEST_ASSERT(HasOrder(info, { "Sphere", "Sphere;Clip", "Contour" }));
+  info->SortRecords(vtkPVPipelineProfilerInformation::STACK);
+  TEST_ASSERT(HasOrder(info, { "Contour", "Sphere", "Sphere;Clip" }));
+
+  TEST_ASSERT(info->GetFoldedStacks() == "Contour 750000\nSphere 250000\nSphere;Clip 500000\n");
+  return EXIT_SUCCESS;
+}
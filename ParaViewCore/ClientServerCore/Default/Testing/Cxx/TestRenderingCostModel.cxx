@@ -0,0 +1,137 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    TestRenderingCostModel.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkNew.h"
+#include "vtkPVRenderingCostModel.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+namespace
+{
+// A link and the render times measured over it, all linear in the size.
+struct Setup
+{
+  double Latency;          // seconds
+  double Bandwidth;        // megabytes per second
+  double LocalRender[2];   // seconds, seconds per megabyte of geometry
+  double RemoteRender[2];  // seconds, seconds per megabyte of geometry
+
+  double Transfer(double size) const { return this->Latency + size / this->Bandwidth; }
+  double Local(double size) const { return this->LocalRender[0] + this->LocalRender[1] * size; }
+  double Remote(double size) const { return this->RemoteRender[0] + this->RemoteRender[1] * size; }
+};
+
+void AddSamples(vtkPVRenderingCostModel* model, const Setup& setup, bool local, bool remote)
+{
+  const double sizes[] = { 1.0, 2.0, 5.0, 10.0, 20.0, 40.0 };
+  for (double size : sizes)
+  {
+    model->AddTransferSample(
+      static_cast<vtkTypeInt64>(size * 1024 * 1024), setup.Transfer(size));
+    if (local)
+    {
+      model->AddLocalRenderSample(size, setup.Local(size));
+    }
+    if (remote)
+    {
+      model->AddRemoteRenderSample(size, setup.Remote(size));
+    }
+  }
+}
+
+bool IsClose(double value, double expected)
+{
+  return std::abs(value - expected) <= 1e-6 * std::max(1.0, std::abs(expected));
+}
+}
+
+int TestRenderingCostModel(int, char* [])
+{
+  const double geometrySize = 20.0;
+  const int imageSize[2] = { 1000, 1000 };
+  const double imageMegabytes = imageSize[0] * imageSize[1] * 3 / (1024.0 * 1024.0);
+
+  vtkNew<vtkPVRenderingCostModel> model;
+  if (model->ChooseRemoteRendering(geometrySize, imageSize, false) != -1)
+  {
+    cerr << "ERROR: a decision was made without measurements." << endl;
+    return EXIT_FAILURE;
+  }
+
+  // Fast LAN: delivering the geometry is cheap, local rendering wins.
+  const Setup lan = { 0.0005, 1000.0, { 0.005, 0.0005 }, { 0.03, 0.0005 } };
+  AddSamples(model.GetPointer(), lan, true, true);
+  const double lanLocalCost =
+    lan.Local(geometrySize) + lan.Transfer(geometrySize) / model->GetDeliveryAmortization();
+  if (!IsClose(model->PredictLocalRenderingCost(geometrySize, imageSize), lanLocalCost) ||
+    !IsClose(model->PredictRemoteRenderingCost(geometrySize, imageSize), lan.Remote(geometrySize)))
+  {
+    cerr << "ERROR: unexpected costs on the LAN: "
+         << model->PredictLocalRenderingCost(geometrySize, imageSize) << " and "
+         << model->PredictRemoteRenderingCost(geometrySize, imageSize) << endl;
+    return EXIT_FAILURE;
+  }
+  if (model->ChooseRemoteRendering(geometrySize, imageSize, false) != 0 ||
+    model->ChooseRemoteRendering(geometrySize, imageSize, true) != 0)
+  {
+    cerr << "ERROR: remote rendering chosen on the LAN." << endl;
+    return EXIT_FAILURE;
+  }
+
+  // Slow VPN: delivering the geometry is expensive, remote rendering wins.
+  model->Reset();
+  const Setup vpn = { 0.05, 1.0, { 0.005, 0.0005 }, { 0.1, 0.0005 } };
+  AddSamples(model.GetPointer(), vpn, true, true);
+  if (model->ChooseRemoteRendering(geometrySize, imageSize, false) != 1 ||
+    model->ChooseRemoteRendering(geometrySize, imageSize, true) != 1)
+  {
+    cerr << "ERROR: local rendering chosen on the VPN." << endl;
+    return EXIT_FAILURE;
+  }
+
+  // Without remote measurements, the remote cost is estimated from the local
+  // render time and the transfer of the image.
+  model->Reset();
+  AddSamples(model.GetPointer(), vpn, true, false);
+  const double largeGeometrySize = 200.0;
+  const double vpnRemoteCost = vpn.Local(largeGeometrySize) + vpn.Transfer(imageMegabytes);
+  if (!IsClose(model->PredictRemoteRenderingCost(largeGeometrySize, imageSize), vpnRemoteCost) ||
+    model->ChooseRemoteRendering(largeGeometrySize, imageSize, false) != 1)
+  {
+    cerr << "ERROR: unexpected estimate of the remote cost on the VPN: "
+         << model->PredictRemoteRenderingCost(largeGeometrySize, imageSize) << endl;
+    return EXIT_FAILURE;
+  }
+
+  // Costs within the hysteresis keep the current mode.
+  model->Reset();
+  const Setup close = { 0.0005, 1000.0, { 0.005, 0.0005 }, { 0.009, 0.0005 } };
+  AddSamples(model.GetPointer(), close, true, true);
+  if (model->ChooseRemoteRendering(geometrySize, imageSize, false) != 0 ||
+    model->ChooseRemoteRendering(geometrySize, imageSize, true) != 1)
+  {
+    cerr << "ERROR: the hysteresis was not applied." << endl;
+    return EXIT_FAILURE;
+  }
+
+  model->Reset();
+  if (model->ChooseRemoteRendering(geometrySize, imageSize, true) != -1)
+  {
+    cerr << "ERROR: measurements were not forgotten." << endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
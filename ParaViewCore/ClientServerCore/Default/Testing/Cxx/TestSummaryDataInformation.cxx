@@ -0,0 +1,133 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    TestSummaryDataInformation.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkClientServerStream.h"
+#include "vtkCompositeDataSet.h"
+#include "vtkDoubleArray.h"
+#include "vtkFieldData.h"
+#include "vtkInformation.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkMultiProcessStream.h"
+#include "vtkNew.h"
+#include "vtkPVCompositeDataInformation.h"
+#include "vtkPVDataInformation.h"
+#include "vtkPointData.h"
+#include "vtkPolyData.h"
+#include "vtkSmartPointer.h"
+#include "vtkSphereSource.h"
+
+#include <cstring>
+#include <iostream>
+
+#define TEST_ASSERT(cond)                                                                          \
+  if (!(cond))                                                                                     \
+  {                                                                                                \
+    std::cerr << "ERROR: failed at line " << __LINE__ << ": " #cond << std::endl;                  \
+    return EXIT_FAILURE;                                                                           \
+  }
+
+namespace
+{
+vtkSmartPointer<vtkPolyData> GetSphere(const char* arrayName)
+{
+  vtkNew<vtkSphereSource> sphere;
+  sphere->Update();
+
+  vtkSmartPointer<vtkPolyData> pd = sphere->GetOutput();
+  vtkNew<vtkDoubleArray> array;
+  array->SetName(arrayName);
+  array->SetNumberOfTuples(pd->GetNumberOfPoints());
+  array->FillComponent(0, 1.0);
+  pd->GetPointData()->AddArray(array.Get());
+
+  vtkNew<vtkDoubleArray> fieldArray;
+  fieldArray->SetName("FieldValue");
+  fieldArray->InsertNextValue(1.0);
+  pd->GetFieldData()->AddArray(fieldArray.Get());
+  return pd;
+}
+
+// Streams the information the way it is sent from the server to the client.
+vtkSmartPointer<vtkPVDataInformation> RoundTrip(vtkPVDataInformation* info)
+{
+  vtkClientServerStream css;
+  info->CopyToStream(&css);
+  auto result = vtkSmartPointer<vtkPVDataInformation>::New();
+  result->CopyFromStream(&css);
+  return result;
+}
+}
+
+int TestSummaryDataInformation(int, char* [])
+{
+  vtkNew<vtkMultiBlockDataSet> data;
+  data->SetBlock(0, GetSphere("Pressure"));
+  data->SetBlock(1, GetSphere("Temperature"));
+  data->GetMetaData(1u)->Set(vtkCompositeDataSet::NAME(), "Second");
+
+  // parameters are forwarded to the server.
+  vtkNew<vtkPVDataInformation> request;
+  request->SetSummaryOnly(true);
+  request->SetCompositeIndex(2);
+  vtkMultiProcessStream parameters;
+  request->CopyParametersToStream(parameters);
+  vtkNew<vtkPVDataInformation> serverInfo;
+  serverInfo->CopyParametersFromStream(parameters);
+  TEST_ASSERT(serverInfo->GetSummaryOnly() && serverInfo->GetCompositeIndex() == 2);
+
+  vtkNew<vtkPVDataInformation> full;
+  full->CopyFromObject(data.Get());
+
+  vtkNew<vtkPVDataInformation> summaryInfo;
+  summaryInfo->SetSummaryOnly(true);
+  summaryInfo->CopyFromObject(data.Get());
+  vtkSmartPointer<vtkPVDataInformation> summary = RoundTrip(summaryInfo);
+
+  // global summaries are unchanged.
+  TEST_ASSERT(summary->GetNumberOfPoints() == full->GetNumberOfPoints());
+  TEST_ASSERT(summary->GetNumberOfCells() == full->GetNumberOfCells());
+  TEST_ASSERT(summary->GetArrayInformation("Pressure", vtkDataObject::POINT) != nullptr);
+  TEST_ASSERT(summary->GetArrayInformation("Temperature", vtkDataObject::POINT) != nullptr);
+
+  // the hierarchy is kept, without the arrays of the blocks.
+  vtkPVCompositeDataInformation* cinfo = summary->GetCompositeDataInformation();
+  TEST_ASSERT(cinfo->GetNumberOfChildren() == 2);
+  TEST_ASSERT(strcmp(cinfo->GetName(1), "Second") == 0);
+  vtkPVDataInformation* block = cinfo->GetDataInformation(1);
+  TEST_ASSERT(block && block->GetNumberOfPoints() ==
+      vtkPolyData::SafeDownCast(data->GetBlock(1))->GetNumberOfPoints());
+  TEST_ASSERT(block->GetArrayInformation("Temperature", vtkDataObject::POINT) == nullptr);
+  TEST_ASSERT(block->GetArrayInformation("FieldValue", vtkDataObject::FIELD) != nullptr);
+  TEST_ASSERT(full->GetCompositeDataInformation()->GetDataInformation(1)->GetArrayInformation(
+                "Temperature", vtkDataObject::POINT) != nullptr);
+
+  // details of a single block are gathered on demand.
+  vtkNew<vtkPVDataInformation> blockInfo;
+  blockInfo->SetSummaryOnly(true);
+  blockInfo->SetCompositeIndex(2);
+  blockInfo->CopyFromObject(data.Get());
+  vtkSmartPointer<vtkPVDataInformation> details = RoundTrip(blockInfo);
+  TEST_ASSERT(details->GetNumberOfPoints() == block->GetNumberOfPoints());
+  TEST_ASSERT(details->GetArrayInformation("Temperature", vtkDataObject::POINT) != nullptr);
+  TEST_ASSERT(details->GetArrayInformation("Pressure", vtkDataObject::POINT) == nullptr);
+  TEST_ASSERT(details->GetCompositeDataSetName() &&
+    strcmp(details->GetCompositeDataSetName(), "Second") == 0);
+
+  // unknown indices result in empty information.
+  vtkNew<vtkPVDataInformation> missing;
+  missing->SetCompositeIndex(10);
+  missing->CopyFromObject(data.Get());
+  TEST_ASSERT(missing->GetNumberOfPoints() == 0);
+  return EXIT_SUCCESS;
+}
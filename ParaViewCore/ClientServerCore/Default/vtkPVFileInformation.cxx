@@ -50,9 +50,11 @@
 #endif
 
 #include <algorithm>
-#include <set>
 #include <string>
 #include <time.h>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 #include <vtksys/RegularExpression.hxx>
 #include <vtksys/SystemTools.hxx>
 
@@ -347,10 +349,77 @@ std::string MakeAbsolutePath(const std::string& path, const std::string& working
 }
 
 //-----------------------------------------------------------------------------
-class vtkPVFileInformationSet : public std::set<vtkSmartPointer<vtkPVFileInformation> >
+class vtkPVFileInformationSet : public std::vector<vtkSmartPointer<vtkPVFileInformation> >
 {
 };
 
+namespace
+{
+//-----------------------------------------------------------------------------
+// Sorts the items of a collection of vtkPVFileInformation by name.
+void vtkPVFileInformationSortByName(vtkCollection* contents)
+{
+  std::vector<vtkSmartPointer<vtkPVFileInformation> > entries;
+  entries.reserve(contents->GetNumberOfItems());
+  for (int cc = 0, max = contents->GetNumberOfItems(); cc < max; cc++)
+  {
+    entries.push_back(vtkPVFileInformation::SafeDownCast(contents->GetItemAsObject(cc)));
+  }
+  std::sort(entries.begin(), entries.end(), [](const vtkSmartPointer<vtkPVFileInformation>& a,
+                                              const vtkSmartPointer<vtkPVFileInformation>& b) {
+    return strcmp(a->GetName(), b->GetName()) < 0;
+  });
+  contents->RemoveAllItems();
+  for (const auto& entry : entries)
+  {
+    contents->AddItem(entry);
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Splits a name around its last run of digits. Returns false if the name has
+// no such run or if it is too long to be held in an int.
+bool vtkPVFileInformationSplitName(
+  const std::string& name, std::string& head, int& value, int& width, std::string& tail)
+{
+  const std::string::size_type last = name.find_last_of("0123456789");
+  if (last == std::string::npos)
+  {
+    return false;
+  }
+  std::string::size_type first = last;
+  while (first > 0 && name[first - 1] >= '0' && name[first - 1] <= '9')
+  {
+    --first;
+  }
+  width = static_cast<int>(last - first + 1);
+  if (width > 9)
+  {
+    return false;
+  }
+  head = name.substr(0, first);
+  value = atoi(name.c_str() + first);
+  tail = name.substr(last + 1);
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+std::string vtkPVFileInformationFormatIndex(int value, int width)
+{
+  std::string digits = std::to_string(value);
+  if (static_cast<int>(digits.size()) < width)
+  {
+    digits.insert(0, width - digits.size(), '0');
+  }
+  return digits;
+}
+
+bool vtkPVFileInformationSameString(const char* a, const char* b)
+{
+  return (a == b) || (a && b && strcmp(a, b) == 0);
+}
+}
+
 //-----------------------------------------------------------------------------
 vtkPVFileInformation::vtkPVFileInformation()
 {
@@ -365,6 +434,7 @@ vtkPVFileInformation::vtkPVFileInformation()
   this->Hidden = false;
   this->Extension = NULL;
   this->Size = 0;
+  this->TotalNumberOfEntries = 0;
 #ifdef _WIN32
   this->ModificationTime = _time64(NULL);
 #else
@@ -466,6 +536,29 @@ void vtkPVFileInformation::CopyFromObject(vtkObject* object)
 
   if (this->IsDirectory(this->Type) && helper->GetDirectoryListing())
   {
+    this->ListDirectory(helper);
+  }
+}
+
+//-----------------------------------------------------------------------------
+void vtkPVFileInformation::ListDirectory(vtkPVFileInformationHelper* helper)
+{
+  const int offset = helper->GetListingOffset();
+  const int maximumSize = helper->GetMaximumListingSize();
+
+  // the listing of the previous page, if this is the next one and the
+  // directory was not modified since.
+  const time_t modificationTime =
+    this->FullPath ? static_cast<time_t>(vtksys::SystemTools::ModifiedTime(this->FullPath)) : 0;
+  vtkPVFileInformation* listing = vtkPVFileInformation::SafeDownCast(helper->GetListingCache());
+  if (offset == 0 || !listing || !listing->FullPath || !this->FullPath ||
+    strcmp(listing->FullPath, this->FullPath) != 0 ||
+    listing->ModificationTime != modificationTime ||
+    listing->ReadDetailedFileInformation != this->ReadDetailedFileInformation ||
+    listing->FastFileTypeDetection != this->FastFileTypeDetection)
+  {
+    helper->SetListingCache(nullptr);
+
 // Since we want a directory listing, we now to platform specific listing
 // with intelligent pattern matching hee-haa.
 #if defined(_WIN32)
@@ -473,6 +566,41 @@ void vtkPVFileInformation::CopyFromObject(vtkObject* object)
 #else
     this->GetDirectoryListing();
 #endif
+    // the listing is sorted by name so that it, and its pages, don't depend
+    // on the order in which the file system returned the entries.
+    vtkPVFileInformationSortByName(this->Contents);
+    this->TotalNumberOfEntries = this->Contents->GetNumberOfItems();
+    if (offset == 0 && (maximumSize == 0 || maximumSize >= this->TotalNumberOfEntries))
+    {
+      return;
+    }
+
+    // keep the complete listing on the helper for the next pages.
+    vtkNew<vtkPVFileInformation> cache;
+    cache->SetFullPath(this->FullPath);
+    cache->ModificationTime = modificationTime;
+    cache->ReadDetailedFileInformation = this->ReadDetailedFileInformation;
+    cache->FastFileTypeDetection = this->FastFileTypeDetection;
+    for (int cc = 0; cc < this->TotalNumberOfEntries; cc++)
+    {
+      cache->Contents->AddItem(this->Contents->GetItemAsObject(cc));
+    }
+    helper->SetListingCache(cache.GetPointer());
+    listing = cache.GetPointer();
+  }
+
+  const int total = listing->Contents->GetNumberOfItems();
+  const int end = (maximumSize > 0 && maximumSize < total - offset) ? offset + maximumSize : total;
+  this->TotalNumberOfEntries = total;
+  this->Contents->RemoveAllItems();
+  for (int cc = offset; cc < end; cc++)
+  {
+    this->Contents->AddItem(listing->Contents->GetItemAsObject(cc));
+  }
+  if (end >= total)
+  {
+    // the last page was served, don't hold on to the listing.
+    helper->SetListingCache(nullptr);
   }
 }
 
@@ -654,7 +782,7 @@ void vtkPVFileInformation::GetWindowsDirectoryListing()
         info->SetFullPath(vtkPVFileInformationHelper::LocalToUtf8Win32(fullpath).c_str());
         info->Type = type;
         info->FastFileTypeDetection = this->FastFileTypeDetection;
-        info_set.insert(info);
+        info_set.push_back(info);
         info->Delete();
       }
     }
@@ -687,7 +815,7 @@ void vtkPVFileInformation::GetWindowsDirectoryListing()
           info->SetFullPath(vtkPVFileInformationHelper::LocalToUtf8Win32(fullpath).c_str());
           info->Type = NETWORK_SHARE;
           info->FastFileTypeDetection = this->FastFileTypeDetection;
-          info_set.insert(info);
+          info_set.push_back(info);
           info->Delete();
         }
       }
@@ -787,7 +915,7 @@ void vtkPVFileInformation::GetWindowsDirectoryListing()
       modTime.HighPart = data.ftLastWriteTime.dwHighDateTime;
       infoD->ModificationTime = (modTime.QuadPart / 10000000ULL - 11644473600ULL);
 
-      info_set.insert(infoD);
+      info_set.push_back(infoD);
       infoD->Delete();
     }
 
@@ -867,7 +995,7 @@ void vtkPVFileInformation::GetDirectoryListing()
     info->SetHiddenFlag();
 
     vtksys::SystemTools::Stat_t status;
-    int res;
+    int res = -1;
     if (this->ReadDetailedFileInformation)
     {
       // Recover status info
@@ -899,14 +1027,25 @@ void vtkPVFileInformation::GetDirectoryListing()
       info->Type = DIRECTORY;
     }
 #else
-    if (d->d_type & DT_DIR)
+    // Use the type reported by readdir so that regular files and directories
+    // are never stat'ed. Links and entries of unknown type stay INVALID and
+    // are resolved by DetectType(), unless we already have their status.
+    if (d->d_type == DT_DIR)
     {
       info->Type = DIRECTORY;
     }
+    else if (d->d_type == DT_REG)
+    {
+      info->Type = SINGLE_FILE;
+    }
+    else if (res != -1)
+    {
+      info->Type = S_ISDIR(status.st_mode) ? DIRECTORY : SINGLE_FILE;
+    }
 #endif
 
     info->FastFileTypeDetection = this->FastFileTypeDetection;
-    info_set.insert(info);
+    info_set.push_back(info);
     info->Delete();
   }
   closedir(dir);
@@ -1005,7 +1144,7 @@ bool vtkPVFileInformation::DetectType()
 
 struct vtkPVFileInformation::vtkInfo
 {
-  typedef std::map<int, vtkSmartPointer<vtkPVFileInformation> > ChildrenType;
+  typedef std::vector<std::pair<int, vtkSmartPointer<vtkPVFileInformation> > > ChildrenType;
   vtkSmartPointer<vtkPVFileInformation> Group;
   ChildrenType Children;
 };
@@ -1013,15 +1152,21 @@ struct vtkPVFileInformation::vtkInfo
 //-----------------------------------------------------------------------------
 void vtkPVFileInformation::OrganizeCollection(vtkPVFileInformationSet& info_set)
 {
-  typedef std::map<std::string, vtkInfo> MapOfStringToInfo;
-  MapOfStringToInfo fileGroups;
+  // Groups are looked up by hashing their key and only the children of each
+  // group get sorted, so grouping a directory of long sequences is linear in
+  // the number of entries.
+  typedef std::unordered_map<std::string, size_t> MapOfStringToIndex;
+  MapOfStringToIndex groupIndices;
+  std::vector<vtkInfo> fileGroups;
 
   std::string prefix = this->FullPath;
   vtkPVFileInformationAddTerminatingSlash(prefix);
 
-  for (vtkPVFileInformationSet::iterator iter = info_set.begin(); iter != info_set.end();)
+  vtkPVFileInformationSet ungrouped;
+  ungrouped.reserve(info_set.size());
+  for (vtkPVFileInformationSet::iterator iter = info_set.begin(); iter != info_set.end(); ++iter)
   {
-    vtkSmartPointer<vtkPVFileInformation> obj = *iter;
+    vtkPVFileInformation* obj = *iter;
     // we're going to skip non-groupable file types. Note, we may get INVALID
     // here since when this->FastFileTypeDetection is true, the grouping
     // happens before the file types are detected.
@@ -1040,11 +1185,11 @@ void vtkPVFileInformation::OrganizeCollection(vtkPVFileInformationSet& info_set)
         const std::string key_prefix(vtkPVFileInformation::IsDirectory(obj->Type) ? "d." : "f.");
         const std::string key(key_prefix + groupName);
 
-        MapOfStringToInfo::iterator iter2 = fileGroups.find(key);
-        if (iter2 == fileGroups.end())
+        std::pair<MapOfStringToIndex::iterator, bool> inserted =
+          groupIndices.insert(MapOfStringToIndex::value_type(key, fileGroups.size()));
+        if (inserted.second)
         {
           vtkNew<vtkPVFileInformation> group;
-          ;
           group->SetName(groupName.c_str());
           group->SetFullPath((prefix + groupName).c_str());
           group->Type = vtkPVFileInformation::IsDirectory(obj->Type) ? DIRECTORY_GROUP : FILE_GROUP;
@@ -1054,42 +1199,43 @@ void vtkPVFileInformation::OrganizeCollection(vtkPVFileInformationSet& info_set)
 
           vtkInfo info;
           info.Group = group.GetPointer();
-          iter2 = fileGroups.insert(std::pair<std::string, vtkInfo>(key, info)).first;
+          fileGroups.push_back(info);
         }
 
-        iter2->second.Children[groupIndex] = obj;
-
-        iter = info_set.erase(iter);
-        continue; // needed to skip the ++iter, since we already incremented.
+        fileGroups[inserted.first->second].Children.push_back(
+          vtkInfo::ChildrenType::value_type(groupIndex, obj));
+        continue;
       }
     }
-    ++iter;
+    ungrouped.push_back(obj);
   }
+  info_set.swap(ungrouped);
 
   // Now scan through all created groups and dissolve trivial groups
   // i.e. groups with single entries. Add all other groups to the
   // results.
-  for (MapOfStringToInfo::iterator iter2 = fileGroups.begin(); iter2 != fileGroups.end(); ++iter2)
+  for (std::vector<vtkInfo>::iterator iter2 = fileGroups.begin(); iter2 != fileGroups.end();
+       ++iter2)
   {
-    vtkInfo& info = iter2->second;
+    vtkInfo& info = *iter2;
     vtkPVFileInformation* group = info.Group;
     if (info.Children.size() > 1)
     {
+      std::stable_sort(info.Children.begin(), info.Children.end(),
+        [](const vtkInfo::ChildrenType::value_type& a, const vtkInfo::ChildrenType::value_type& b) {
+          return a.first < b.first;
+        });
       vtkInfo::ChildrenType::iterator childIter = info.Children.begin();
       for (; childIter != info.Children.end(); ++childIter)
       {
         group->Contents->AddItem(childIter->second.GetPointer());
       }
       // Build group children.
-      info_set.insert(group);
+      info_set.push_back(group);
     }
     else
     {
-      vtkInfo::ChildrenType::iterator childIter = info.Children.begin();
-      for (; childIter != info.Children.end(); ++childIter)
-      {
-        info_set.insert(childIter->second.GetPointer());
-      }
+      info_set.push_back(info.Children.front().second);
     }
   }
 }
@@ -1099,20 +1245,103 @@ void vtkPVFileInformation::CopyToStream(vtkClientServerStream* stream)
 {
   *stream << vtkClientServerStream::Reply << this->Name << this->FullPath << this->Type
           << this->Hidden << this->Contents->GetNumberOfItems() << this->Extension << this->Size
-          << this->ModificationTime;
+          << this->ModificationTime << this->TotalNumberOfEntries;
 
-  vtkSmartPointer<vtkCollectionIterator> iter;
-  iter.TakeReference(this->Contents->NewIterator());
-  for (iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextItem())
+  if (this->Type == FILE_GROUP || this->Type == DIRECTORY_GROUP)
   {
-    vtkClientServerStream childStream;
-    vtkPVFileInformation* child = vtkPVFileInformation::SafeDownCast(iter->GetCurrentObject());
-    child->CopyToStream(&childStream);
-    *stream << childStream;
+    this->CopyGroupContentsToStream(stream);
+  }
+  else
+  {
+    vtkSmartPointer<vtkCollectionIterator> iter;
+    iter.TakeReference(this->Contents->NewIterator());
+    for (iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextItem())
+    {
+      vtkClientServerStream childStream;
+      vtkPVFileInformation* child = vtkPVFileInformation::SafeDownCast(iter->GetCurrentObject());
+      child->CopyToStream(&childStream);
+      *stream << childStream;
+    }
   }
   *stream << vtkClientServerStream::End;
 }
 
+//-----------------------------------------------------------------------------
+void vtkPVFileInformation::CopyGroupContentsToStream(vtkClientServerStream* stream)
+{
+  // The children of a group are written as runs of entries whose names only
+  // differ by a consecutive index, e.g. "can_0009.vtk" ... "can_0120.vtk" is
+  // sent as ("can_", 4, 9, 112, ".vtk"). Full paths are sent only when they
+  // are not the directory of the group followed by the name.
+  std::string prefix = this->FullPath ? this->FullPath : "";
+  const std::string::size_type slash = prefix.find_last_of("/\\");
+  prefix = (slash == std::string::npos) ? std::string() : prefix.substr(0, slash + 1);
+
+  std::vector<vtkClientServerStream> runs;
+  std::string runHead, runTail;
+  int runWidth = 0, runFirst = 0, runCount = 0;
+  std::string runFullPath;
+  std::vector<long long> runSizes, runTimes;
+  vtkPVFileInformation* runFirstChild = nullptr;
+
+  auto flush = [&]() {
+    if (runCount == 0)
+    {
+      return;
+    }
+    vtkClientServerStream run;
+    run << vtkClientServerStream::Reply << runHead.c_str() << runTail.c_str() << runWidth
+        << runFirst << runCount << runFirstChild->Type << runFirstChild->Hidden
+        << runFirstChild->Extension << runFullPath.c_str()
+        << vtkClientServerStream::InsertArray(&runSizes[0], runCount)
+        << vtkClientServerStream::InsertArray(&runTimes[0], runCount)
+        << vtkClientServerStream::End;
+    runs.push_back(run);
+    runCount = 0;
+    runSizes.clear();
+    runTimes.clear();
+  };
+
+  for (int cc = 0; cc < this->Contents->GetNumberOfItems(); cc++)
+  {
+    vtkPVFileInformation* child =
+      vtkPVFileInformation::SafeDownCast(this->Contents->GetItemAsObject(cc));
+    const std::string name = child->Name ? child->Name : "";
+    const bool implicitPath = child->FullPath && (prefix + name) == child->FullPath;
+
+    std::string head, tail;
+    int value = 0, width = 0;
+    const bool numbered =
+      implicitPath && vtkPVFileInformationSplitName(name, head, value, width, tail);
+
+    const bool extendsRun = numbered && runCount > 0 && runWidth > 0 && head == runHead &&
+      tail == runTail && value == runFirst + runCount &&
+      vtkPVFileInformationFormatIndex(value, runWidth).size() == static_cast<size_t>(width) &&
+      child->Type == runFirstChild->Type && child->Hidden == runFirstChild->Hidden &&
+      vtkPVFileInformationSameString(child->Extension, runFirstChild->Extension);
+    if (!extendsRun)
+    {
+      flush();
+      runFirstChild = child;
+      runHead = numbered ? head : name;
+      runTail = numbered ? tail : std::string();
+      runWidth = numbered ? width : 0;
+      runFirst = numbered ? value : 0;
+      runFullPath = (implicitPath || !child->FullPath) ? std::string() : child->FullPath;
+    }
+    runSizes.push_back(child->Size);
+    runTimes.push_back(static_cast<long long>(child->ModificationTime));
+    runCount++;
+  }
+  flush();
+
+  *stream << prefix.c_str() << static_cast<int>(runs.size());
+  for (const vtkClientServerStream& run : runs)
+  {
+    *stream << run;
+  }
+}
+
 //-----------------------------------------------------------------------------
 void vtkPVFileInformation::CopyFromStream(const vtkClientServerStream* css)
 {
@@ -1166,11 +1395,25 @@ void vtkPVFileInformation::CopyFromStream(const vtkClientServerStream* css)
     vtkErrorMacro("Error parsing File extension.");
     return;
   }
+  if (!css->GetArgument(0, 8, &this->TotalNumberOfEntries))
+  {
+    vtkErrorMacro("Error parsing TotalNumberOfEntries.");
+    return;
+  }
+  if (this->Type == FILE_GROUP || this->Type == DIRECTORY_GROUP)
+  {
+    if (!this->CopyGroupContentsFromStream(css, 9) ||
+      this->Contents->GetNumberOfItems() != num_of_children)
+    {
+      vtkErrorMacro("Error parsing group contents.");
+    }
+    return;
+  }
   for (int cc = 0; cc < num_of_children; cc++)
   {
     vtkPVFileInformation* child = vtkPVFileInformation::New();
     vtkClientServerStream childStream;
-    if (!css->GetArgument(0, 8 + cc, &childStream))
+    if (!css->GetArgument(0, 9 + cc, &childStream))
     {
       vtkErrorMacro("Error parsing child #" << cc);
       return;
@@ -1181,6 +1424,64 @@ void vtkPVFileInformation::CopyFromStream(const vtkClientServerStream* css)
   }
 }
 
+//-----------------------------------------------------------------------------
+bool vtkPVFileInformation::CopyGroupContentsFromStream(
+  const vtkClientServerStream* css, int firstArgument)
+{
+  const char* temp = 0;
+  int num_of_runs = 0;
+  if (!css->GetArgument(0, firstArgument, &temp) ||
+    !css->GetArgument(0, firstArgument + 1, &num_of_runs))
+  {
+    return false;
+  }
+  const std::string prefix = temp ? temp : "";
+
+  for (int cc = 0; cc < num_of_runs; cc++)
+  {
+    vtkClientServerStream run;
+    const char* head = 0;
+    const char* tail = 0;
+    const char* extension = 0;
+    const char* fullpath = 0;
+    int width = 0, first = 0, count = 0, type = INVALID;
+    bool hidden = false;
+    if (!css->GetArgument(0, firstArgument + 2 + cc, &run) || !run.GetArgument(0, 0, &head) ||
+      !run.GetArgument(0, 1, &tail) || !run.GetArgument(0, 2, &width) ||
+      !run.GetArgument(0, 3, &first) || !run.GetArgument(0, 4, &count) ||
+      !run.GetArgument(0, 5, &type) || !run.GetArgument(0, 6, &hidden) ||
+      !run.GetArgument(0, 7, &extension) || !run.GetArgument(0, 8, &fullpath) || count <= 0)
+    {
+      return false;
+    }
+    std::vector<long long> sizes(count), times(count);
+    if (!run.GetArgument(0, 9, &sizes[0], count) || !run.GetArgument(0, 10, &times[0], count))
+    {
+      return false;
+    }
+
+    for (int kk = 0; kk < count; kk++)
+    {
+      std::string name = head ? head : "";
+      if (width > 0)
+      {
+        name += vtkPVFileInformationFormatIndex(first + kk, width);
+        name += tail ? tail : "";
+      }
+      vtkNew<vtkPVFileInformation> child;
+      child->SetName(name.c_str());
+      child->SetFullPath((fullpath && fullpath[0]) ? fullpath : (prefix + name).c_str());
+      child->Type = type;
+      child->Hidden = hidden;
+      child->SetExtension(extension);
+      child->Size = sizes[kk];
+      child->ModificationTime = static_cast<time_t>(times[kk]);
+      this->Contents->AddItem(child.GetPointer());
+    }
+  }
+  return true;
+}
+
 //-----------------------------------------------------------------------------
 void vtkPVFileInformation::Initialize()
 {
@@ -1191,6 +1492,7 @@ void vtkPVFileInformation::Initialize()
   this->Contents->RemoveAllItems();
   this->SetExtension(0);
   this->Size = 0;
+  this->TotalNumberOfEntries = 0;
 #ifdef _WIN32
   this->ModificationTime = _time64(NULL);
 #else
@@ -1262,6 +1564,7 @@ void vtkPVFileInformation::PrintSelf(ostream& os, vtkIndent indent)
   }
   os << indent << "Hidden: " << this->Hidden << endl;
   os << indent << "FastFileTypeDetection: " << this->FastFileTypeDetection << endl;
+  os << indent << "TotalNumberOfEntries: " << this->TotalNumberOfEntries << endl;
 
   for (int cc = 0; cc < this->Contents->GetNumberOfItems(); cc++)
   {
@@ -35,6 +35,7 @@
 class vtkCollection;
 class vtkPVFileInformationSet;
 class vtkFileSequenceParser;
+class vtkPVFileInformationHelper;
 
 class VTKPVCLIENTSERVERCOREDEFAULT_EXPORT vtkPVFileInformation : public vtkPVInformation
 {
@@ -129,6 +130,13 @@ public:
   vtkGetMacro(ModificationTime, time_t);
   //@}
 
+  /**
+   * Returns the number of entries in the complete listing of this directory.
+   * When the vtkPVFileInformationHelper requested a page of the listing,
+   * Contents only holds the entries of that page.
+   */
+  vtkGetMacro(TotalNumberOfEntries, int);
+
   /**
   * Returns the path to the base data directory path holding various files
   * packaged with ParaView.
@@ -159,6 +167,7 @@ protected:
   char* Extension;         // File extension
   long long Size;          // File size
   time_t ModificationTime; // File modification time
+  int TotalNumberOfEntries; // Number of entries in the complete listing
 
   vtkSetStringMacro(Extension);
   vtkSetStringMacro(Name);
@@ -171,6 +180,18 @@ protected:
   // are creates file groups, if possible.
   void OrganizeCollection(vtkPVFileInformationSet& vector);
 
+  // Replaces Contents with the page of the listing requested by the helper,
+  // computing the listing only if it is not the continuation of the previous
+  // page requested through the same helper.
+  void ListDirectory(vtkPVFileInformationHelper* helper);
+
+  //@{
+  // Serialize the children of a FILE_GROUP or DIRECTORY_GROUP, collapsing
+  // consecutively numbered names into ranges.
+  void CopyGroupContentsToStream(vtkClientServerStream* stream);
+  bool CopyGroupContentsFromStream(const vtkClientServerStream* css, int firstArgument);
+  //@}
+
   bool DetectType();
   void GetSpecialDirectories();
   void SetHiddenFlag();
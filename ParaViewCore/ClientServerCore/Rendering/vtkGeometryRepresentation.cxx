@@ -36,6 +36,7 @@
 #include "vtkPVConfig.h"
 #include "vtkPVGeometryFilter.h"
 #include "vtkPVLODActor.h"
+#include "vtkPVLODPyramid.h"
 #include "vtkPVRenderView.h"
 #include "vtkPVTrivialProducer.h"
 #include "vtkPVUpdateSuppressor.h"
@@ -46,6 +47,7 @@
 #include "vtkSelection.h"
 #include "vtkSelectionConverter.h"
 #include "vtkSelectionNode.h"
+#include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkTransform.h"
 #include "vtkUnstructuredGrid.h"
@@ -150,6 +152,8 @@ vtkGeometryRepresentation::vtkGeometryRepresentation()
   this->MultiBlockMaker = vtkGeometryRepresentationMultiBlockMaker::New();
   this->Decimator = vtkGeometryRepresentation_detail::DecimationFilterType::New();
   this->LODOutlineFilter = vtkPVGeometryFilter::New();
+  this->LODPyramid = vtkPVLODPyramid::New();
+  this->LODPyramidLevel = nullptr;
 
   // connect progress bar
   this->GeometryFilter->AddObserver(vtkCommand::ProgressEvent, this,
@@ -191,6 +195,8 @@ vtkGeometryRepresentation::vtkGeometryRepresentation()
   this->Representation = SURFACE;
 
   this->SuppressLOD = false;
+  this->UseLODPyramid = false;
+  this->LODResolution = 0.5;
 
   vtkMath::UninitializeBounds(this->VisibleDataBounds);
 
@@ -207,6 +213,7 @@ vtkGeometryRepresentation::vtkGeometryRepresentation()
 //----------------------------------------------------------------------------
 vtkGeometryRepresentation::~vtkGeometryRepresentation()
 {
+  this->LODPyramid->Delete();
   this->CacheKeeper->Delete();
   this->GeometryFilter->Delete();
   this->MultiBlockMaker->Delete();
@@ -350,6 +357,7 @@ int vtkGeometryRepresentation::ProcessViewRequest(
         // HACK to ensure that when Decimator is next employed, it delivers a
         // new geometry.
         this->Decimator->Modified();
+        this->LODPyramidLevel = nullptr;
 
         this->LODOutlineFilter->Update();
         // Pass along the LOD geometry to the view so that it can deliver it to
@@ -363,23 +371,57 @@ int vtkGeometryRepresentation::ProcessViewRequest(
         this->LODOutlineFilter->Modified();
 
         if (inInfo->Has(vtkPVRenderView::LOD_RESOLUTION()))
+        {
+          this->LODResolution = inInfo->Get(vtkPVRenderView::LOD_RESOLUTION());
+        }
+
+        // Use the finest level decimated in the background if it was built for
+        // this resolution, otherwise decimate now.
+        vtkDataObject* lod = nullptr;
+        if (this->UseLODPyramid && this->LODPyramid->GetResolution() == this->LODResolution)
+        {
+          lod = this->LODPyramid->GetFinestLevel();
+        }
+        else
+        {
+          this->LODPyramid->Stop();
+        }
+        this->LODPyramidLevel = lod;
+        if (!lod)
         {
           // We handle this number differently depending on decimator
           // implementation.
-          const double factor = inInfo->Get(vtkPVRenderView::LOD_RESOLUTION());
-          this->Decimator->SetLODFactor(factor);
+          this->Decimator->SetLODFactor(this->LODResolution);
+          this->Decimator->Update();
+          lod = this->Decimator->GetOutputDataObject(0);
         }
 
-        this->Decimator->Update();
-
         // Pass along the LOD geometry to the view so that it can deliver it to
         // the rendering node as and when needed.
-        vtkPVRenderView::SetPieceLOD(inInfo, this, this->Decimator->GetOutputDataObject(0));
+        vtkPVRenderView::SetPieceLOD(inInfo, this, lod);
       }
     }
   }
   else if (request_type == vtkPVView::REQUEST_RENDER())
   {
+    // Give the view the finer levels decimated in the background since the LOD
+    // geometry was last updated. This is only done when the LOD geometry is not
+    // rendered, since the view discards it until it is delivered again, with
+    // the next interactive render. In client-server sessions, the client decides
+    // what to deliver and does not know about these levels: the servers keep the
+    // one they delivered until the LOD geometry is updated.
+    bool lod = this->SuppressLOD ? false : (inInfo->Has(vtkPVRenderView::USE_LOD()) == 1);
+    if (!lod && this->LODPyramidLevel &&
+      vtkProcessModule::GetProcessType() == vtkProcessModule::PROCESS_CLIENT)
+    {
+      vtkDataObject* finest = this->LODPyramid->GetFinestLevel();
+      if (finest && finest != this->LODPyramidLevel)
+      {
+        vtkPVRenderView::SetPieceLOD(inInfo, this, finest);
+        this->LODPyramidLevel = finest;
+      }
+    }
+
     vtkAlgorithmOutput* producerPort = vtkPVRenderView::GetPieceProducer(inInfo, this);
     vtkAlgorithmOutput* producerPortLOD = vtkPVRenderView::GetPieceProducerLOD(inInfo, this);
     this->Mapper->SetInputConnection(0, producerPort);
@@ -387,7 +429,6 @@ int vtkGeometryRepresentation::ProcessViewRequest(
 
     // This is called just before the vtk-level render. In this pass, we simply
     // pick the correct rendering mode and rendering parameters.
-    bool lod = this->SuppressLOD ? false : (inInfo->Has(vtkPVRenderView::USE_LOD()) == 1);
     this->Actor->SetEnableLOD(lod ? 1 : 0);
     this->UpdateColoringParameters();
 
@@ -472,6 +513,26 @@ int vtkGeometryRepresentation::RequestData(
   }
   this->CacheKeeper->Update();
 
+  // Start decimating the new geometry so that the LOD is ready by the time the
+  // user interacts. This is only worth it in interactive sessions, for
+  // geometry large enough for the view to render it with LOD.
+  vtkDataObject* geometry = this->CacheKeeper->GetOutputDataObject(0);
+  vtkPVRenderView* view = vtkPVRenderView::SafeDownCast(this->GetView());
+  const int processType = vtkProcessModule::GetProcessType();
+  if (this->UseLODPyramid && !this->SuppressLOD && view &&
+    (processType == vtkProcessModule::PROCESS_CLIENT ||
+        processType == vtkProcessModule::PROCESS_SERVER ||
+        processType == vtkProcessModule::PROCESS_RENDER_SERVER) &&
+    geometry->GetActualMemorySize() / 1024.0 >= view->GetLODRenderingThreshold())
+  {
+    this->LODPyramid->Start(geometry, this->LODResolution);
+  }
+  else
+  {
+    this->LODPyramid->Stop();
+  }
+  this->LODPyramidLevel = nullptr;
+
   // HACK: To overcome issue with PolyDataMapper (OpenGL2). It doesn't recreate
   // VBO/IBOs when using data from cache. I suspect it's because the blocks in
   // the MB dataset have older MTime.
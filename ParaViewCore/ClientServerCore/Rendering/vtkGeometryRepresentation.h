@@ -42,6 +42,7 @@ class vtkPiecewiseFunction;
 class vtkPVCacheKeeper;
 class vtkPVGeometryFilter;
 class vtkPVLODActor;
+class vtkPVLODPyramid;
 class vtkScalarsToColors;
 class vtkTexture;
 
@@ -98,6 +99,23 @@ public:
    */
   virtual void SetSuppressLOD(bool suppress) { this->SuppressLOD = suppress; }
 
+  //@{
+  /**
+   * When set, the LOD geometry is decimated on a background thread right after
+   * the full-resolution geometry is updated, at a few resolutions up to the
+   * LOD resolution last requested by the view. The first interaction then uses
+   * the finest level available instead of decimating the data synchronously,
+   * and the following ones a finer level if it was built meanwhile.
+   * This is only done in the client and the render servers, not in batch, and
+   * only if the geometry on this process exceeds the view's
+   * LODRenderingThreshold. Default is false.
+   * @sa vtkPVLODPyramid
+   */
+  vtkSetMacro(UseLODPyramid, bool);
+  vtkGetMacro(UseLODPyramid, bool);
+  vtkBooleanMacro(UseLODPyramid, bool);
+  //@}
+
   //@{
   /**
    * Set the lighting properties of the object. vtkGeometryRepresentation
@@ -387,6 +405,9 @@ protected:
   vtkPVCacheKeeper* CacheKeeper;
   vtkGeometryRepresentation_detail::DecimationFilterType* Decimator;
   vtkPVGeometryFilter* LODOutlineFilter;
+  vtkPVLODPyramid* LODPyramid;
+  // The level of LODPyramid last given to the view, if any.
+  vtkDataObject* LODPyramidLevel;
 
   vtkMapper* Mapper;
   vtkMapper* LODMapper;
@@ -398,6 +419,8 @@ protected:
   double Diffuse;
   int Representation;
   bool SuppressLOD;
+  bool UseLODPyramid;
+  double LODResolution;
   bool RequestGhostCellsIfNeeded;
   double VisibleDataBounds[6];
 
@@ -26,12 +26,14 @@
 #include "vtkOpenGLRenderer.h"
 #include "vtkOpenGLState.h"
 #include "vtkPVDefaultPass.h"
+#include "vtkPVFrameTimerLog.h"
 #include "vtkRenderState.h"
 #include "vtkRenderWindow.h"
 #include "vtkRenderer.h"
 #include "vtkSmartPointer.h"
 #include "vtkTileDisplayHelper.h"
 #include "vtkTilesHelper.h"
+#include "vtkTimerLog.h"
 
 #include <IceTGL.h>
 #include <assert.h>
@@ -227,8 +229,28 @@ public:
     vtkOpenGLCheckErrorMacro("failed after setup context");
   }
 
+  // Description:
+  // Records the time spent compositing in vtkPVFrameTimerLog i.e. the time
+  // spent in IceT excluding the time spent drawing the geometry.
+  void Render(const vtkRenderState* render_state) override
+  {
+    const double start = vtkTimerLog::GetUniversalTime();
+    this->DrawTime = 0.0;
+    this->Superclass::Render(render_state);
+    const double duration = vtkTimerLog::GetUniversalTime() - start;
+    vtkPVFrameTimerLog::AddSpan(vtkPVFrameTimerLog::COMPOSITE, start, duration - this->DrawTime);
+  }
+
+  void Draw(const vtkRenderState* render_state) override
+  {
+    const double start = vtkTimerLog::GetUniversalTime();
+    this->Superclass::Draw(render_state);
+    this->DrawTime += vtkTimerLog::GetUniversalTime() - start;
+  }
+
 protected:
   vtkPVIceTCompositePass()
+    : DrawTime(0.0)
   {
     vtkPVDefaultPass* defaultPass = vtkPVDefaultPass::New();
     this->SetRenderPass(defaultPass);
@@ -236,6 +258,8 @@ protected:
   }
 
   ~vtkPVIceTCompositePass() {}
+
+  double DrawTime;
 };
 vtkStandardNewMacro(vtkPVIceTCompositePass);
 };
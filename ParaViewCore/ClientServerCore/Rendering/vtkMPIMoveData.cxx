@@ -133,6 +133,7 @@ vtkMPIMoveData::vtkMPIMoveData()
   this->UpdatePiece = 0;
 
   this->SkipDataServerGatherToZero = false;
+  this->SkipClientDelivery = false;
 }
 
 //-----------------------------------------------------------------------------
@@ -917,7 +918,7 @@ void vtkMPIMoveData::RenderServerZeroReceiveFromDataServerZero(vtkDataObject* da
 //-----------------------------------------------------------------------------
 void vtkMPIMoveData::DataServerSendToClient(vtkDataObject* output)
 {
-  if (this->ClientDataServerSocketController == NULL)
+  if (this->ClientDataServerSocketController == NULL || this->SkipClientDelivery)
   {
     return;
   }
@@ -942,6 +943,12 @@ void vtkMPIMoveData::DataServerSendToClient(vtkDataObject* output)
 //-----------------------------------------------------------------------------
 void vtkMPIMoveData::ClientReceiveFromDataServer(vtkDataObject* output)
 {
+  if (this->SkipClientDelivery)
+  {
+    vtkVLogF(PARAVIEW_LOG_DATA_MOVEMENT_VERBOSITY(), "skip receive-from-dataserver");
+    return;
+  }
+
   vtkCommunicator* com = 0;
   com = this->ClientDataServerSocketController->GetCommunicator();
   if (com == 0)
@@ -1232,6 +1239,7 @@ void vtkMPIMoveData::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Server: " << this->Server << endl;
   os << indent << "MoveMode: " << this->MoveMode << endl;
   os << indent << "SkipDataServerGatherToZero: " << this->SkipDataServerGatherToZero << endl;
+  os << indent << "SkipClientDelivery: " << this->SkipClientDelivery << endl;
   os << indent << "OutputDataType: ";
   if (this->OutputDataType == VTK_POLY_DATA)
   {
@@ -131,6 +131,16 @@ public:
   vtkGetMacro(SkipDataServerGatherToZero, bool);
   //@}
 
+  //@{
+  /**
+   * When set, the data server does not send the data to the client and the
+   * client output is left empty. This is useful when the client already has
+   * the data, e.g. in a cache. Must be set identically on all processes.
+   */
+  vtkSetMacro(SkipClientDelivery, bool);
+  vtkGetMacro(SkipClientDelivery, bool);
+  //@}
+
   enum MoveModes
   {
     PASS_THROUGH = 0,
@@ -178,6 +188,7 @@ protected:
   int Server;
 
   bool SkipDataServerGatherToZero;
+  bool SkipClientDelivery;
 
   enum Servers
   {
@@ -20,6 +20,7 @@
 #include "vtkObjectFactory.h"
 #include "vtkOpenGLRenderer.h"
 #include "vtkPVConfig.h"
+#include "vtkPVFrameTimerLog.h"
 #include "vtkSquirtCompressor.h"
 #include "vtkUnsignedCharArray.h"
 #include "vtkZlibImageCompressor.h"
@@ -64,14 +65,23 @@ void vtkPVClientServerSynchronizedRenderers::MasterEndRender()
     if (this->Compressor)
     {
       vtkUnsignedCharArray* data = vtkUnsignedCharArray::New();
-      this->ParallelController->Receive(data, 1, 0x023430);
-      this->Compressor->SetImageResolution(header[1], header[2]);
-      this->Decompress(data, rawImage.GetRawPtr());
+      {
+        vtkPVFrameTimerLog::Scope frameTimerScope(vtkPVFrameTimerLog::TRANSFER);
+        this->ParallelController->Receive(data, 1, 0x023430);
+        frameTimerScope.SetBytes(data->GetDataSize());
+      }
+      {
+        vtkPVFrameTimerLog::Scope frameTimerScope(vtkPVFrameTimerLog::DECOMPRESS);
+        this->Compressor->SetImageResolution(header[1], header[2]);
+        this->Decompress(data, rawImage.GetRawPtr());
+      }
       data->Delete();
     }
     else
     {
+      vtkPVFrameTimerLog::Scope frameTimerScope(vtkPVFrameTimerLog::TRANSFER);
       this->ParallelController->Receive(rawImage.GetRawPtr(), 1, 0x023430);
+      frameTimerScope.SetBytes(rawImage.GetRawPtr()->GetDataSize());
     }
     rawImage.MarkValid();
   }
@@ -114,15 +124,18 @@ void vtkPVClientServerSynchronizedRenderers::SlaveEndRender()
 
   if (rawImage.IsValid())
   {
+    vtkUnsignedCharArray* data = rawImage.GetRawPtr();
     if (this->Compressor)
     {
+      vtkPVFrameTimerLog::Scope frameTimerScope(vtkPVFrameTimerLog::COMPRESS);
       this->Compressor->SetImageResolution(header[1], header[2]);
-      this->ParallelController->Send(this->Compress(rawImage.GetRawPtr()), 1, 0x023430);
-    }
-    else
-    {
-      this->ParallelController->Send(rawImage.GetRawPtr(), 1, 0x023430);
+      data = this->Compress(data);
+      frameTimerScope.SetBytes(data->GetDataSize());
     }
+
+    vtkPVFrameTimerLog::Scope frameTimerScope(vtkPVFrameTimerLog::TRANSFER);
+    this->ParallelController->Send(data, 1, 0x023430);
+    frameTimerScope.SetBytes(data->GetDataSize());
   }
 }
 
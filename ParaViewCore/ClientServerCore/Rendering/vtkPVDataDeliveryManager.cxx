@@ -25,18 +25,22 @@
 #include "vtkOrderedCompositeDistributor.h"
 #include "vtkPKdTree.h"
 #include "vtkPVDataRepresentation.h"
+#include "vtkPVFrameTimerLog.h"
 #include "vtkPVLogger.h"
 #include "vtkPVRenderView.h"
 #include "vtkPVStreamingMacros.h"
 #include "vtkPVTrivialProducer.h"
+#include "vtkProcessModule.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkWeakPointer.h"
 
 #include <cassert>
+#include <iterator>
 #include <map>
 #include <queue>
 #include <sstream>
+#include <tuple>
 #include <utility>
 
 //*****************************************************************************
@@ -182,8 +186,16 @@ public:
      * vtkMPIMoveData instance, if needed based on the requested
      * data_distribution_mode passed in. The item may override the
      * data_distribution_mode based on its attributes.
+     *
+     * When `from_client_cache` is true, the client already has the data
+     * cached: it is not sent to the client and `cached` (only non-null on the
+     * client) is used as the delivered data object instead.
+     *
+     * @returns the size in bytes of the delivered data object if data was
+     *          moved, 0 otherwise.
      */
-    void Deliver(int data_distribution_mode)
+    vtkTypeInt64 Deliver(
+      int data_distribution_mode, bool from_client_cache = false, vtkDataObject* cached = nullptr)
     {
       auto dataObj = this->GetDataObject();
       assert(dataObj != nullptr);
@@ -197,13 +209,26 @@ public:
       {
         dataMover->SetSkipDataServerGatherToZero(this->GatherBeforeDeliveringToClient == false);
       }
+      dataMover->SetSkipClientDelivery(from_client_cache);
       dataMover->SetInputData(dataObj);
       dataMover->Update();
 
       // Save the delivered data object. We store it in a map where key is the
       // delivery mode. This is essential to avoid clobbering data when in
       // collaboration mode and different clients have different delivery modes.
-      this->DeliveredDataObjects[real_mode] = dataMover->GetOutputDataObject(0);
+      vtkSmartPointer<vtkDataObject> delivered = dataMover->GetOutputDataObject(0);
+      if (cached)
+      {
+        // a shallow copy so that the delivered data object is newer than the
+        // data object, as NeedsDelivery() expects.
+        delivered.TakeReference(cached->NewInstance());
+        delivered->ShallowCopy(cached);
+      }
+      this->DeliveredDataObjects[real_mode] = delivered;
+      return (real_mode != vtkMPIMoveData::PASS_THROUGH && delivered.GetPointer() != nullptr &&
+               !from_client_cache)
+        ? static_cast<vtkTypeInt64>(delivered->GetActualMemorySize()) * 1024
+        : 0;
     }
 
     /**
@@ -263,6 +288,32 @@ public:
      */
     void ClearRedistributedData() { this->RedistributedDataObject = nullptr; }
 
+    /**
+     * Each item may have overrides to the data delivery mode. This method can
+     * be called to update the requested_mode based on the representation
+     * specific overrides specified.
+     */
+    int GetItemDataDistributionMode(int requested_mode) const
+    {
+      if (this->CloneDataToAllNodes)
+      {
+        return vtkMPIMoveData::CLONE;
+      }
+      else if (this->DeliverToClientAndRenderingProcesses)
+      {
+        if (requested_mode == vtkMPIMoveData::PASS_THROUGH)
+        {
+          return vtkMPIMoveData::COLLECT_AND_PASS_THROUGH;
+        }
+        else
+        {
+          // nothing to do, since the data is going to be delivered to the client
+          // anyways.
+        }
+      }
+      return requested_mode;
+    }
+
     vtkDataObject* GetDeliveredDataObject(int data_distribution_mode) const
     {
       try
@@ -316,33 +367,6 @@ public:
     }
     void SetNextStreamedPiece(vtkDataObject* data) { this->StreamedPiece = data; }
     vtkDataObject* GetStreamedPiece() { return this->StreamedPiece; }
-
-  private:
-    /**
-     * Each item may have overrides to the data delivery mode. This method can
-     * be called to update the requested_mode based on the representation
-     * specific overrides specified.
-     */
-    int GetItemDataDistributionMode(int requested_mode) const
-    {
-      if (this->CloneDataToAllNodes)
-      {
-        return vtkMPIMoveData::CLONE;
-      }
-      else if (this->DeliverToClientAndRenderingProcesses)
-      {
-        if (requested_mode == vtkMPIMoveData::PASS_THROUGH)
-        {
-          return vtkMPIMoveData::COLLECT_AND_PASS_THROUGH;
-        }
-        else
-        {
-          // nothing to do, since the data is going to be delivered to the client
-          // anyways.
-        }
-      }
-      return requested_mode;
-    }
   };
 
   // First is repr unique id, second is the input port.
@@ -408,11 +432,143 @@ public:
 
   ItemsMapType ItemsMap;
   RepresentationsMapType RepresentationsMap;
+
+  // Cache of the data objects delivered to the client, to avoid delivering
+  // them again e.g. when going back to a time step in an animation.
+  class vtkCacheKey
+  {
+  public:
+    unsigned int RepresentationId;
+    int Port;
+    int DataDistributionMode;
+    double Time;
+    vtkTypeUInt64 DataGeneration;
+
+    bool operator<(const vtkCacheKey& other) const
+    {
+      return std::tie(this->RepresentationId, this->Port, this->DataDistributionMode, this->Time,
+               this->DataGeneration) < std::tie(other.RepresentationId, other.Port,
+                                         other.DataDistributionMode, other.Time,
+                                         other.DataGeneration);
+    }
+  };
+
+  class vtkCacheEntry
+  {
+  public:
+    vtkSmartPointer<vtkDataObject> DataObject;
+    unsigned long ActualMemorySize; // in kibibytes.
+    vtkTypeUInt64 LastUse;
+  };
+
+  typedef std::map<vtkCacheKey, vtkCacheEntry> ClientCacheType;
+  ClientCacheType ClientCache;
+  unsigned long ClientCacheSize = 0; // in megabytes.
+  vtkTypeUInt64 ClientCacheClock = 0;
+
+  /**
+   * Returns false if the data delivered for the item cannot be cached, else
+   * fills up `key`. Only full resolution data delivered to the client is
+   * cached, and only on the client.
+   */
+  bool GetClientCacheKey(unsigned int id, int port, bool use_lod, const vtkItem& item,
+    int data_distribution_mode, vtkCacheKey& key) const
+  {
+    const int real_mode = item.GetItemDataDistributionMode(data_distribution_mode);
+    RepresentationsMapType::const_iterator riter = this->RepresentationsMap.find(id);
+    if (this->ClientCacheSize == 0 || use_lod || item.Streamable ||
+      real_mode == vtkMPIMoveData::PASS_THROUGH || riter == this->RepresentationsMap.end() ||
+      riter->second.GetPointer() == nullptr ||
+      vtkProcessModule::GetProcessType() != vtkProcessModule::PROCESS_CLIENT)
+    {
+      return false;
+    }
+
+    vtkPVDataRepresentation* repr = riter->second;
+    key.RepresentationId = id;
+    key.Port = port;
+    key.DataDistributionMode = real_mode;
+    key.Time = repr->GetUpdateTimeValid() ? repr->GetUpdateTime() : 0.0;
+    key.DataGeneration = repr->GetDataGeneration();
+    return true;
+  }
+
+  vtkDataObject* GetCachedDataObject(const vtkCacheKey& key)
+  {
+    ClientCacheType::iterator iter = this->ClientCache.find(key);
+    if (iter == this->ClientCache.end())
+    {
+      return nullptr;
+    }
+    iter->second.LastUse = ++this->ClientCacheClock;
+    return iter->second.DataObject;
+  }
+
+  void AddCachedDataObject(const vtkCacheKey& key, vtkDataObject* dobj)
+  {
+    // data of older generations will never be used again.
+    ClientCacheType::iterator iter = this->ClientCache.begin();
+    while (iter != this->ClientCache.end())
+    {
+      const vtkCacheKey& other = iter->first;
+      if (other.RepresentationId == key.RepresentationId && other.Port == key.Port &&
+        other.DataGeneration != key.DataGeneration)
+      {
+        iter = this->ClientCache.erase(iter);
+      }
+      else
+      {
+        ++iter;
+      }
+    }
+
+    if (dobj)
+    {
+      vtkCacheEntry& entry = this->ClientCache[key];
+      entry.DataObject = dobj;
+      entry.ActualMemorySize = dobj->GetActualMemorySize();
+      entry.LastUse = ++this->ClientCacheClock;
+    }
+  }
+
+  void RemoveCachedDataObjects(unsigned int id)
+  {
+    ClientCacheType::iterator iter = this->ClientCache.begin();
+    while (iter != this->ClientCache.end())
+    {
+      iter = iter->first.RepresentationId == id ? this->ClientCache.erase(iter) : std::next(iter);
+    }
+  }
+
+  // discards the least recently used data objects until the cache fits in
+  // ClientCacheSize.
+  void TrimClientCache()
+  {
+    unsigned long size = 0;
+    for (const auto& pair : this->ClientCache)
+    {
+      size += pair.second.ActualMemorySize;
+    }
+    while (!this->ClientCache.empty() && size > this->ClientCacheSize * 1024)
+    {
+      ClientCacheType::iterator oldest = this->ClientCache.begin();
+      for (auto iter = this->ClientCache.begin(); iter != this->ClientCache.end(); ++iter)
+      {
+        oldest = iter->second.LastUse < oldest->second.LastUse ? iter : oldest;
+      }
+      size -= oldest->second.ActualMemorySize;
+      this->ClientCache.erase(oldest);
+    }
+  }
 };
 
 //*****************************************************************************
 
 vtkStandardNewMacro(vtkPVDataDeliveryManager);
+
+int vtkPVDataDeliveryManager::ClientCacheHit = 0;
+int vtkPVDataDeliveryManager::ClientCacheMiss = 0;
+
 //----------------------------------------------------------------------------
 vtkPVDataDeliveryManager::vtkPVDataDeliveryManager()
   : Internals(new vtkInternals())
@@ -456,6 +612,7 @@ void vtkPVDataDeliveryManager::UnRegisterRepresentation(vtkPVDataRepresentation*
 {
   unsigned int rid = repr->GetUniqueIdentifier();
   this->Internals->RepresentationsMap.erase(rid);
+  this->Internals->RemoveCachedDataObjects(rid);
 
   vtkInternals::ItemsMapType::iterator iter = this->Internals->ItemsMap.begin();
   while (iter != this->Internals->ItemsMap.end())
@@ -707,11 +864,18 @@ bool vtkPVDataDeliveryManager::NeedsDelivery(
       if (item.GetTimeStamp() > timestamp ||
         item.GetDeliveryTimeStamp(data_distribution_mode) < item.GetTimeStamp())
       {
-        vtkVLogF(PARAVIEW_LOG_DATA_MOVEMENT_VERBOSITY(), "needs-delivery: %s",
-          this->GetRepresentation(iter->first.first)->GetLogName().c_str());
-        // FIXME: convert keys_to_deliver to a vector of pairs.
+        // tell the servers when the client has the data cached already.
+        vtkInternals::vtkCacheKey key;
+        const bool cached = this->Internals->GetClientCacheKey(iter->first.first,
+                              iter->first.second, use_lod, item, data_distribution_mode, key) &&
+          this->Internals->GetCachedDataObject(key) != nullptr;
+        vtkVLogF(PARAVIEW_LOG_DATA_MOVEMENT_VERBOSITY(), "needs-delivery: %s%s",
+          this->GetRepresentation(iter->first.first)->GetLogName().c_str(),
+          (cached ? " (cached on client)" : ""));
+        // FIXME: convert keys_to_deliver to a vector of tuples.
         keys_to_deliver.push_back(iter->first.first);
         keys_to_deliver.push_back(static_cast<unsigned int>(iter->first.second));
+        keys_to_deliver.push_back(cached ? 1 : 0);
       }
     }
   }
@@ -735,16 +899,19 @@ void vtkPVDataDeliveryManager::Deliver(int use_lod, unsigned int size, unsigned
   // This method will be implemented in "view-specific" subclasses since how the
   // data is delivered is very view specific.
 
-  assert(size % 2 == 0);
+  assert(size % 3 == 0);
 
   vtkVLogScopeF(PARAVIEW_LOG_DATA_MOVEMENT_VERBOSITY(), "%s data migration",
     (use_lod ? "low-resolution" : "full resolution"));
   const int mode = this->GetViewDataDistributionMode(use_lod != 0);
 
-  for (unsigned int cc = 0; cc < size; cc += 2)
+  vtkPVFrameTimerLog::Scope frameTimerScope(vtkPVFrameTimerLog::DELIVERY);
+  vtkTypeInt64 bytes = 0;
+  for (unsigned int cc = 0; cc < size; cc += 3)
   {
     const unsigned int id = values[cc];
     const int port = static_cast<int>(values[cc + 1]);
+    const bool from_client_cache = values[cc + 2] != 0;
 
     vtkInternals::vtkItem* item = this->Internals->GetItem(id, use_lod != 0, port);
     vtkDataObject* data = item ? item->GetDataObject() : NULL;
@@ -755,15 +922,43 @@ void vtkPVDataDeliveryManager::Deliver(int use_lod, unsigned int size, unsigned
       continue;
     }
 
-    vtkVLogScopeF(PARAVIEW_LOG_DATA_MOVEMENT_VERBOSITY(), "move-data: %s",
-      this->GetRepresentation(id)->GetLogName().c_str());
-    item->Deliver(mode);
+    vtkVLogScopeF(PARAVIEW_LOG_DATA_MOVEMENT_VERBOSITY(), "move-data: %s%s",
+      this->GetRepresentation(id)->GetLogName().c_str(),
+      (from_client_cache ? " (cached on client)" : ""));
+
+    // the cache only exists on the client, hence `cached` is null on the
+    // servers, which merely skip sending the data.
+    vtkInternals::vtkCacheKey key;
+    const bool cacheable =
+      this->Internals->GetClientCacheKey(id, port, use_lod != 0, *item, mode, key);
+    vtkDataObject* cached =
+      (from_client_cache && cacheable) ? this->Internals->GetCachedDataObject(key) : nullptr;
+    if (from_client_cache && cacheable && cached == nullptr)
+    {
+      vtkErrorMacro("Missing cached data for " << this->GetRepresentation(id)->GetLogName());
+    }
+
+    bytes += item->Deliver(mode, from_client_cache, cached);
+    if (cached)
+    {
+      vtkPVDataDeliveryManager::ClientCacheHit++;
+    }
+    else if (!from_client_cache && cacheable)
+    {
+      vtkPVDataDeliveryManager::ClientCacheMiss++;
+      this->Internals->AddCachedDataObject(key, item->GetDeliveredDataObject(mode));
+    }
   }
+  // only trim now, so that no data found in the cache by NeedsDelivery() was
+  // discarded before being used.
+  this->Internals->TrimClientCache();
+  frameTimerScope.SetBytes(bytes);
 }
 
 //----------------------------------------------------------------------------
 void vtkPVDataDeliveryManager::RedistributeDataForOrderedCompositing(bool use_lod)
 {
+  vtkPVFrameTimerLog::Scope frameTimerScope(vtkPVFrameTimerLog::REDISTRIBUTION);
   const int mode = this->GetViewDataDistributionMode(use_lod);
   if (this->RenderView->GetUpdateTimeStamp() > this->RedistributionTimeStamp)
   {
@@ -980,10 +1175,47 @@ void vtkPVDataDeliveryManager::DeliverStreamedPieces(unsigned int size, unsigned
   }
 }
 
+//----------------------------------------------------------------------------
+void vtkPVDataDeliveryManager::SetClientCacheSize(unsigned long size)
+{
+  if (this->Internals->ClientCacheSize != size)
+  {
+    this->Internals->ClientCacheSize = size;
+    this->Internals->TrimClientCache();
+    this->Modified();
+  }
+}
+
+//----------------------------------------------------------------------------
+unsigned long vtkPVDataDeliveryManager::GetClientCacheSize()
+{
+  return this->Internals->ClientCacheSize;
+}
+
+//----------------------------------------------------------------------------
+void vtkPVDataDeliveryManager::ClearClientCacheStateFlags()
+{
+  vtkPVDataDeliveryManager::ClientCacheHit = 0;
+  vtkPVDataDeliveryManager::ClientCacheMiss = 0;
+}
+
+//----------------------------------------------------------------------------
+int vtkPVDataDeliveryManager::GetClientCacheHits()
+{
+  return vtkPVDataDeliveryManager::ClientCacheHit;
+}
+
+//----------------------------------------------------------------------------
+int vtkPVDataDeliveryManager::GetClientCacheMisses()
+{
+  return vtkPVDataDeliveryManager::ClientCacheMiss;
+}
+
 //----------------------------------------------------------------------------
 void vtkPVDataDeliveryManager::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "ClientCacheSize: " << this->GetClientCacheSize() << endl;
 }
 
 //----------------------------------------------------------------------------
@@ -182,7 +182,9 @@ public:
    * Internal method used to determine the list of representations that need
    * their geometry delivered. This is done on the "client" side, with the
    * client decide what geometries it needs and then requests those from the
-   * server-sides using Deliver().
+   * server-sides using Deliver(). Each representation adds 3 values to
+   * `keys_to_deliver`: its identifier, the port, and 1 if the client already
+   * has the geometry in its cache (see SetClientCacheSize()), else 0.
    */
   bool NeedsDelivery(
     vtkMTimeType timestamp, std::vector<unsigned int>& keys_to_deliver, bool interactive);
@@ -192,6 +194,32 @@ public:
    */
   void Deliver(int use_low_res, unsigned int size, unsigned int* keys);
 
+  //@{
+  /**
+   * Get/Set the maximum size, in megabytes, of the geometry kept on the client
+   * after it was delivered. When a representation's geometry needs to be
+   * delivered again for a time step and data generation (see
+   * vtkPVDataRepresentation::GetDataGeneration()) already delivered, e.g.
+   * when playing an animation in a loop, the cached geometry is used instead
+   * and the servers do not send it. The least recently used geometry is
+   * discarded first. Only full resolution geometry is cached. 0 disables the
+   * cache. Default is 0.
+   */
+  void SetClientCacheSize(unsigned long size);
+  unsigned long GetClientCacheSize();
+  //@}
+
+  //@{
+  /**
+   * These methods are used for testing. They count the geometries taken from
+   * the client cache (hits) and the geometries delivered and added to it
+   * (misses) since the last call to ClearClientCacheStateFlags().
+   */
+  static void ClearClientCacheStateFlags();
+  static int GetClientCacheHits();
+  static int GetClientCacheMisses();
+  //@}
+
   // *******************************************************************
   // UNDER CONSTRUCTION STREAMING API
   // *******************************************************************
@@ -250,6 +278,9 @@ private:
 
   class vtkInternals;
   vtkInternals* Internals;
+
+  static int ClientCacheHit;
+  static int ClientCacheMiss;
 };
 
 #endif
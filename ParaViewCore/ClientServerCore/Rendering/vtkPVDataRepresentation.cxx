@@ -30,6 +30,13 @@
 #include <assert.h>
 #include <map>
 
+namespace
+{
+// non-zero while MarkModified() is called because the UpdateTime changed,
+// including on internal representations of composite representations.
+int MarkingModifiedForUpdateTime = 0;
+}
+
 //----------------------------------------------------------------------------
 vtkPVDataRepresentation::vtkPVDataRepresentation()
 {
@@ -45,6 +52,7 @@ vtkPVDataRepresentation::vtkPVDataRepresentation()
   this->ForcedCacheKey = 0.0;
 
   this->NeedUpdate = true;
+  this->DataGeneration = 0;
 
   this->UniqueIdentifier = 0;
 }
@@ -63,7 +71,9 @@ void vtkPVDataRepresentation::SetUpdateTime(double time)
     this->UpdateTimeValid = true;
 
     // Call MarkModified() only when the timestep has indeed changed.
+    ++MarkingModifiedForUpdateTime;
     this->MarkModified();
+    --MarkingModifiedForUpdateTime;
   }
 }
 
@@ -97,6 +107,10 @@ void vtkPVDataRepresentation::MarkModified()
 {
   this->Modified();
   this->NeedUpdate = true;
+  if (MarkingModifiedForUpdateTime == 0)
+  {
+    this->DataGeneration++;
+  }
 }
 
 //----------------------------------------------------------------------------
@@ -300,4 +314,5 @@ void vtkPVDataRepresentation::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "UpdateTime: " << this->UpdateTime << endl;
   os << indent << "ForceUseCache: " << this->ForceUseCache << endl;
   os << indent << "ForcedCacheKey: " << this->ForcedCacheKey << endl;
+  os << indent << "DataGeneration: " << this->DataGeneration << endl;
 }
@@ -150,6 +150,14 @@ public:
 
   vtkGetMacro(NeedUpdate, bool);
 
+  /**
+   * Returns a counter incremented every time MarkModified() is called, except
+   * when it is called because the UpdateTime changed. Together with the
+   * UpdateTime, it identifies the data produced by the representation, e.g.
+   * to recognize data that was already delivered for a time step.
+   */
+  vtkGetMacro(DataGeneration, vtkTypeUInt64);
+
   //@{
   /**
    * Making these methods public. When constructing composite representations,
@@ -233,6 +241,7 @@ private:
   bool ForceUseCache;
   double ForcedCacheKey;
   bool NeedUpdate;
+  vtkTypeUInt64 DataGeneration;
 
   class Internals;
   Internals* Implementation;
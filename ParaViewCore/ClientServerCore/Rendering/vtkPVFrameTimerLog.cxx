@@ -0,0 +1,290 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    vtkPVFrameTimerLog.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkPVFrameTimerLog.h"
+
+#include "vtkObjectFactory.h"
+#include "vtkTimerLog.h"
+
+#include <algorithm>
+#include <deque>
+#include <utility>
+#include <vector>
+
+namespace
+{
+struct vtkSpan
+{
+  int Stage;
+  double Start;
+  double Duration;
+  vtkTypeInt64 Bytes;
+};
+
+struct vtkFrame
+{
+  double Start = 0.0;
+  double End = 0.0;
+  bool Interactive = false;
+  std::vector<vtkSpan> Spans;
+};
+
+struct vtkFrameLog
+{
+  int MaxNumberOfFrames = 100;
+  std::deque<vtkFrame> Frames;
+  vtkFrame CurrentFrame;
+
+  void Trim()
+  {
+    while (this->Frames.size() > static_cast<size_t>(this->MaxNumberOfFrames))
+    {
+      this->Frames.pop_front();
+    }
+  }
+
+  const vtkFrame* GetFrame(int frame) const
+  {
+    if (frame < 0 || frame >= static_cast<int>(this->Frames.size()))
+    {
+      return nullptr;
+    }
+    return &this->Frames[frame];
+  }
+
+  const vtkSpan* GetSpan(int frame, int span) const
+  {
+    const vtkFrame* f = this->GetFrame(frame);
+    if (!f || span < 0 || span >= static_cast<int>(f->Spans.size()))
+    {
+      return nullptr;
+    }
+    return &f->Spans[span];
+  }
+};
+
+vtkFrameLog& GetFrameLog()
+{
+  static vtkFrameLog log;
+  return log;
+}
+}
+
+vtkStandardNewMacro(vtkPVFrameTimerLog);
+//----------------------------------------------------------------------------
+vtkPVFrameTimerLog::vtkPVFrameTimerLog()
+{
+}
+
+//----------------------------------------------------------------------------
+vtkPVFrameTimerLog::~vtkPVFrameTimerLog()
+{
+}
+
+//----------------------------------------------------------------------------
+const char* vtkPVFrameTimerLog::GetStageName(int stage)
+{
+  switch (stage)
+  {
+    case UPDATE:
+      return "Update";
+    case DELIVERY:
+      return "Delivery";
+    case REDISTRIBUTION:
+      return "Redistribution";
+    case RENDER:
+      return "Render";
+    case COMPOSITE:
+      return "Composite";
+    case COMPRESS:
+      return "Compress";
+    case TRANSFER:
+      return "Transfer";
+    case DECOMPRESS:
+      return "Decompress";
+    default:
+      return "Unknown";
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkPVFrameTimerLog::SetMaxNumberOfFrames(int count)
+{
+  vtkFrameLog& log = GetFrameLog();
+  log.MaxNumberOfFrames = std::max(count, 0);
+  log.Trim();
+  if (log.MaxNumberOfFrames == 0)
+  {
+    log.CurrentFrame = vtkFrame();
+  }
+}
+
+//----------------------------------------------------------------------------
+int vtkPVFrameTimerLog::GetMaxNumberOfFrames()
+{
+  return GetFrameLog().MaxNumberOfFrames;
+}
+
+//----------------------------------------------------------------------------
+void vtkPVFrameTimerLog::AddSpan(int stage, double start, double duration, vtkTypeInt64 bytes)
+{
+  vtkFrameLog& log = GetFrameLog();
+  if (log.MaxNumberOfFrames > 0)
+  {
+    log.CurrentFrame.Spans.push_back(vtkSpan{ stage, start, duration, bytes });
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkPVFrameTimerLog::EndFrame(bool interactive)
+{
+  vtkFrameLog& log = GetFrameLog();
+  if (log.MaxNumberOfFrames == 0)
+  {
+    return;
+  }
+
+  vtkFrame& frame = log.CurrentFrame;
+  frame.End = vtkTimerLog::GetUniversalTime();
+  frame.Start = frame.End;
+  for (const vtkSpan& span : frame.Spans)
+  {
+    frame.Start = std::min(frame.Start, span.Start);
+  }
+  frame.Interactive = interactive;
+  log.Frames.push_back(std::move(frame));
+  log.CurrentFrame = vtkFrame();
+  log.Trim();
+}
+
+//----------------------------------------------------------------------------
+void vtkPVFrameTimerLog::Clear()
+{
+  vtkFrameLog& log = GetFrameLog();
+  log.Frames.clear();
+  log.CurrentFrame = vtkFrame();
+}
+
+//----------------------------------------------------------------------------
+int vtkPVFrameTimerLog::GetNumberOfFrames()
+{
+  return static_cast<int>(GetFrameLog().Frames.size());
+}
+
+//----------------------------------------------------------------------------
+double vtkPVFrameTimerLog::GetFrameStartTime(int frame)
+{
+  const vtkFrame* f = GetFrameLog().GetFrame(frame);
+  return f ? f->Start : 0.0;
+}
+
+//----------------------------------------------------------------------------
+double vtkPVFrameTimerLog::GetFrameEndTime(int frame)
+{
+  const vtkFrame* f = GetFrameLog().GetFrame(frame);
+  return f ? f->End : 0.0;
+}
+
+//----------------------------------------------------------------------------
+bool vtkPVFrameTimerLog::GetFrameInteractive(int frame)
+{
+  const vtkFrame* f = GetFrameLog().GetFrame(frame);
+  return f ? f->Interactive : false;
+}
+
+//----------------------------------------------------------------------------
+double vtkPVFrameTimerLog::GetStageTime(int frame, int stage)
+{
+  double time = 0.0;
+  if (const vtkFrame* f = GetFrameLog().GetFrame(frame))
+  {
+    for (const vtkSpan& span : f->Spans)
+    {
+      time += span.Stage == stage ? span.Duration : 0.0;
+    }
+  }
+  return time;
+}
+
+//----------------------------------------------------------------------------
+vtkTypeInt64 vtkPVFrameTimerLog::GetStageBytes(int frame, int stage)
+{
+  vtkTypeInt64 bytes = 0;
+  if (const vtkFrame* f = GetFrameLog().GetFrame(frame))
+  {
+    for (const vtkSpan& span : f->Spans)
+    {
+      bytes += span.Stage == stage ? span.Bytes : 0;
+    }
+  }
+  return bytes;
+}
+
+//----------------------------------------------------------------------------
+int vtkPVFrameTimerLog::GetNumberOfSpans(int frame)
+{
+  const vtkFrame* f = GetFrameLog().GetFrame(frame);
+  return f ? static_cast<int>(f->Spans.size()) : 0;
+}
+
+//----------------------------------------------------------------------------
+int vtkPVFrameTimerLog::GetSpanStage(int frame, int span)
+{
+  const vtkSpan* s = GetFrameLog().GetSpan(frame, span);
+  return s ? s->Stage : -1;
+}
+
+//----------------------------------------------------------------------------
+double vtkPVFrameTimerLog::GetSpanStartTime(int frame, int span)
+{
+  const vtkSpan* s = GetFrameLog().GetSpan(frame, span);
+  return s ? s->Start : 0.0;
+}
+
+//----------------------------------------------------------------------------
+double vtkPVFrameTimerLog::GetSpanDuration(int frame, int span)
+{
+  const vtkSpan* s = GetFrameLog().GetSpan(frame, span);
+  return s ? s->Duration : 0.0;
+}
+
+//----------------------------------------------------------------------------
+vtkTypeInt64 vtkPVFrameTimerLog::GetSpanBytes(int frame, int span)
+{
+  const vtkSpan* s = GetFrameLog().GetSpan(frame, span);
+  return s ? s->Bytes : 0;
+}
+
+//----------------------------------------------------------------------------
+vtkPVFrameTimerLog::Scope::Scope(int stage)
+  : Stage(stage)
+  , Start(vtkTimerLog::GetUniversalTime())
+  , Bytes(0)
+{
+}
+
+//----------------------------------------------------------------------------
+vtkPVFrameTimerLog::Scope::~Scope()
+{
+  vtkPVFrameTimerLog::AddSpan(
+    this->Stage, this->Start, vtkTimerLog::GetUniversalTime() - this->Start, this->Bytes);
+}
+
+//----------------------------------------------------------------------------
+void vtkPVFrameTimerLog::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "MaxNumberOfFrames: " << vtkPVFrameTimerLog::GetMaxNumberOfFrames() << endl;
+  os << indent << "NumberOfFrames: " << vtkPVFrameTimerLog::GetNumberOfFrames() << endl;
+}
@@ -0,0 +1,152 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    vtkPVFrameTimerLog.h
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkPVFrameTimerLog
+ * @brief   per-frame timings of the rendering pipeline.
+ *
+ * vtkPVFrameTimerLog keeps, on each process, the timings of the last few
+ * frames rendered by vtkPVRenderView. Each frame is made of spans, one per
+ * stage executed since the previous frame: updating the representations,
+ * delivering and redistributing the geometry, rendering, compositing,
+ * compressing, transferring and decompressing the image. Spans also record
+ * the number of bytes moved, when that applies.
+ *
+ * The RENDER span covers the whole vtkPVRenderView render, hence it contains
+ * the COMPOSITE, COMPRESS, TRANSFER and DECOMPRESS spans of the same frame.
+ *
+ * The frames of all processes can be gathered using
+ * vtkPVFrameTimerLogInformation.
+ *
+ * @sa vtkPVFrameTimerLogInformation, vtkTimerLog
+ */
+
+#ifndef vtkPVFrameTimerLog_h
+#define vtkPVFrameTimerLog_h
+
+#include "vtkObject.h"
+#include "vtkPVClientServerCoreRenderingModule.h" // needed for exports
+
+class VTKPVCLIENTSERVERCORERENDERING_EXPORT vtkPVFrameTimerLog : public vtkObject
+{
+public:
+  static vtkPVFrameTimerLog* New();
+  vtkTypeMacro(vtkPVFrameTimerLog, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  enum Stages
+  {
+    UPDATE = 0,
+    DELIVERY,
+    REDISTRIBUTION,
+    RENDER,
+    COMPOSITE,
+    COMPRESS,
+    TRANSFER,
+    DECOMPRESS,
+    NUMBER_OF_STAGES
+  };
+
+  /**
+   * Returns a human readable name for the stage.
+   */
+  static const char* GetStageName(int stage);
+
+  //@{
+  /**
+   * Get/Set the number of frames to keep. Older frames are discarded. Set to
+   * 0 to stop recording. Default is 100.
+   */
+  static void SetMaxNumberOfFrames(int count);
+  static int GetMaxNumberOfFrames();
+  //@}
+
+  /**
+   * Adds a span to the current frame. `start` is in seconds, as returned by
+   * vtkTimerLog::GetUniversalTime().
+   */
+  static void AddSpan(int stage, double start, double duration, vtkTypeInt64 bytes = 0);
+
+  /**
+   * Closes the current frame and adds it to the log.
+   */
+  static void EndFrame(bool interactive);
+
+  /**
+   * Discards all frames.
+   */
+  static void Clear();
+
+  //@{
+  /**
+   * Access the frames, oldest first. Times are in seconds.
+   */
+  static int GetNumberOfFrames();
+  static double GetFrameStartTime(int frame);
+  static double GetFrameEndTime(int frame);
+  static bool GetFrameInteractive(int frame);
+  //@}
+
+  //@{
+  /**
+   * Returns the total time and bytes of all the spans of a stage in a frame.
+   */
+  static double GetStageTime(int frame, int stage);
+  static vtkTypeInt64 GetStageBytes(int frame, int stage);
+  //@}
+
+  //@{
+  /**
+   * Access the individual spans of a frame, in the order they were added.
+   */
+  static int GetNumberOfSpans(int frame);
+  static int GetSpanStage(int frame, int span);
+  static double GetSpanStartTime(int frame, int span);
+  static double GetSpanDuration(int frame, int span);
+  static vtkTypeInt64 GetSpanBytes(int frame, int span);
+  //@}
+
+  /**
+   * Adds a span for the lifetime of the scope to the current frame.
+   */
+  class VTKPVCLIENTSERVERCORERENDERING_EXPORT Scope
+  {
+  public:
+    Scope(int stage);
+    ~Scope();
+
+    /**
+     * Sets the number of bytes moved by the stage.
+     */
+    void SetBytes(vtkTypeInt64 bytes) { this->Bytes = bytes; }
+
+  private:
+    Scope(const Scope&) = delete;
+    void operator=(const Scope&) = delete;
+
+    int Stage;
+    double Start;
+    vtkTypeInt64 Bytes;
+  };
+
+protected:
+  vtkPVFrameTimerLog();
+  ~vtkPVFrameTimerLog() override;
+
+private:
+  vtkPVFrameTimerLog(const vtkPVFrameTimerLog&) = delete;
+  void operator=(const vtkPVFrameTimerLog&) = delete;
+};
+
+#endif
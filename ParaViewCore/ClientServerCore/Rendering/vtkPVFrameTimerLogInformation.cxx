@@ -0,0 +1,339 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    vtkPVFrameTimerLogInformation.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkPVFrameTimerLogInformation.h"
+
+#include "vtkClientServerStream.h"
+#include "vtkObjectFactory.h"
+#include "vtkPVFrameTimerLog.h"
+#include "vtkProcessModule.h"
+
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+#define vtkVerifyParseMacro(_call, _field)                                                         \
+  if (!(_call))                                                                                    \
+  {                                                                                                \
+    vtkErrorMacro("Error parsing " _field ".");                                                    \
+    return;                                                                                        \
+  }
+
+class vtkPVFrameTimerLogInformation::vtkInternals
+{
+public:
+  struct Span
+  {
+    int Stage;
+    double Start;
+    double Duration;
+    vtkTypeInt64 Bytes;
+  };
+
+  struct Frame
+  {
+    double Start;
+    double End;
+    int Interactive;
+    std::vector<Span> Spans;
+  };
+
+  struct Process
+  {
+    int ProcessType;
+    int Rank;
+    std::vector<Frame> Frames;
+  };
+
+  std::vector<Process> Processes;
+
+  const Frame* GetFrame(int proc, int frame) const
+  {
+    if (proc < 0 || proc >= static_cast<int>(this->Processes.size()))
+    {
+      return nullptr;
+    }
+    const std::vector<Frame>& frames = this->Processes[proc].Frames;
+    return (frame >= 0 && frame < static_cast<int>(frames.size())) ? &frames[frame] : nullptr;
+  }
+};
+
+namespace
+{
+const char* vtkGetProcessTypeName(int type)
+{
+  switch (type)
+  {
+    case vtkProcessModule::PROCESS_CLIENT:
+      return "client";
+    case vtkProcessModule::PROCESS_SERVER:
+      return "server";
+    case vtkProcessModule::PROCESS_DATA_SERVER:
+      return "data-server";
+    case vtkProcessModule::PROCESS_RENDER_SERVER:
+      return "render-server";
+    case vtkProcessModule::PROCESS_BATCH:
+      return "batch";
+    default:
+      return "process";
+  }
+}
+}
+
+vtkStandardNewMacro(vtkPVFrameTimerLogInformation);
+//-----------------------------------------------------------------------------
+vtkPVFrameTimerLogInformation::vtkPVFrameTimerLogInformation()
+  : Internals(new vtkPVFrameTimerLogInformation::vtkInternals())
+{
+}
+
+//-----------------------------------------------------------------------------
+vtkPVFrameTimerLogInformation::~vtkPVFrameTimerLogInformation()
+{
+  delete this->Internals;
+}
+
+//-----------------------------------------------------------------------------
+void vtkPVFrameTimerLogInformation::CopyFromObject(vtkObject*)
+{
+  this->Internals->Processes.clear();
+
+  vtkInternals::Process process;
+  process.ProcessType = vtkProcessModule::GetProcessType();
+  process.Rank = vtkProcessModule::GetProcessModule()->GetPartitionId();
+  for (int frame = 0, numFrames = vtkPVFrameTimerLog::GetNumberOfFrames(); frame < numFrames;
+       ++frame)
+  {
+    vtkInternals::Frame f;
+    f.Start = vtkPVFrameTimerLog::GetFrameStartTime(frame);
+    f.End = vtkPVFrameTimerLog::GetFrameEndTime(frame);
+    f.Interactive = vtkPVFrameTimerLog::GetFrameInteractive(frame) ? 1 : 0;
+    for (int span = 0, numSpans = vtkPVFrameTimerLog::GetNumberOfSpans(frame); span < numSpans;
+         ++span)
+    {
+      f.Spans.push_back(vtkInternals::Span{ vtkPVFrameTimerLog::GetSpanStage(frame, span),
+        vtkPVFrameTimerLog::GetSpanStartTime(frame, span),
+        vtkPVFrameTimerLog::GetSpanDuration(frame, span),
+        vtkPVFrameTimerLog::GetSpanBytes(frame, span) });
+    }
+    process.Frames.push_back(f);
+  }
+  this->Internals->Processes.push_back(process);
+}
+
+//-----------------------------------------------------------------------------
+void vtkPVFrameTimerLogInformation::AddInformation(vtkPVInformation* info)
+{
+  vtkPVFrameTimerLogInformation* other = vtkPVFrameTimerLogInformation::SafeDownCast(info);
+  if (!other)
+  {
+    vtkErrorMacro("AddInformation needs vtkPVFrameTimerLogInformation.");
+    return;
+  }
+  this->Internals->Processes.insert(this->Internals->Processes.end(),
+    other->Internals->Processes.begin(), other->Internals->Processes.end());
+}
+
+//-----------------------------------------------------------------------------
+void vtkPVFrameTimerLogInformation::CopyToStream(vtkClientServerStream* css)
+{
+  css->Reset();
+  *css << vtkClientServerStream::Reply << static_cast<int>(this->Internals->Processes.size());
+  for (const auto& process : this->Internals->Processes)
+  {
+    *css << process.ProcessType << process.Rank << static_cast<int>(process.Frames.size());
+    for (const auto& frame : process.Frames)
+    {
+      *css << frame.Start << frame.End << frame.Interactive
+           << static_cast<int>(frame.Spans.size());
+      for (const auto& span : frame.Spans)
+      {
+        *css << span.Stage << span.Start << span.Duration << span.Bytes;
+      }
+    }
+  }
+  *css << vtkClientServerStream::End;
+}
+
+//-----------------------------------------------------------------------------
+void vtkPVFrameTimerLogInformation::CopyFromStream(const vtkClientServerStream* css)
+{
+  this->Internals->Processes.clear();
+
+  int offset = 0;
+  int numProcesses = 0;
+  vtkVerifyParseMacro(css->GetArgument(0, offset++, &numProcesses), "number of processes");
+  this->Internals->Processes.resize(numProcesses);
+  for (auto& process : this->Internals->Processes)
+  {
+    int numFrames = 0;
+    vtkVerifyParseMacro(css->GetArgument(0, offset++, &process.ProcessType), "ProcessType");
+    vtkVerifyParseMacro(css->GetArgument(0, offset++, &process.Rank), "Rank");
+    vtkVerifyParseMacro(css->GetArgument(0, offset++, &numFrames), "number of frames");
+    process.Frames.resize(numFrames);
+    for (auto& frame : process.Frames)
+    {
+      int numSpans = 0;
+      vtkVerifyParseMacro(css->GetArgument(0, offset++, &frame.Start), "frame start");
+      vtkVerifyParseMacro(css->GetArgument(0, offset++, &frame.End), "frame end");
+      vtkVerifyParseMacro(css->GetArgument(0, offset++, &frame.Interactive), "frame interactive");
+      vtkVerifyParseMacro(css->GetArgument(0, offset++, &numSpans), "number of spans");
+      frame.Spans.resize(numSpans);
+      for (auto& span : frame.Spans)
+      {
+        vtkVerifyParseMacro(css->GetArgument(0, offset++, &span.Stage), "span stage");
+        vtkVerifyParseMacro(css->GetArgument(0, offset++, &span.Start), "span start");
+        vtkVerifyParseMacro(css->GetArgument(0, offset++, &span.Duration), "span duration");
+        vtkVerifyParseMacro(css->GetArgument(0, offset++, &span.Bytes), "span bytes");
+      }
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+int vtkPVFrameTimerLogInformation::GetNumberOfProcesses()
+{
+  return static_cast<int>(this->Internals->Processes.size());
+}
+
+//-----------------------------------------------------------------------------
+int vtkPVFrameTimerLogInformation::GetProcessType(int proc)
+{
+  return (proc >= 0 && proc < this->GetNumberOfProcesses())
+    ? this->Internals->Processes[proc].ProcessType
+    : vtkProcessModule::PROCESS_INVALID;
+}
+
+//-----------------------------------------------------------------------------
+int vtkPVFrameTimerLogInformation::GetRank(int proc)
+{
+  return (proc >= 0 && proc < this->GetNumberOfProcesses()) ? this->Internals->Processes[proc].Rank
+                                                            : -1;
+}
+
+//-----------------------------------------------------------------------------
+int vtkPVFrameTimerLogInformation::GetNumberOfFrames(int proc)
+{
+  return (proc >= 0 && proc < this->GetNumberOfProcesses())
+    ? static_cast<int>(this->Internals->Processes[proc].Frames.size())
+    : 0;
+}
+
+//-----------------------------------------------------------------------------
+double vtkPVFrameTimerLogInformation::GetFrameStartTime(int proc, int frame)
+{
+  const vtkInternals::Frame* f = this->Internals->GetFrame(proc, frame);
+  return f ? f->Start : 0.0;
+}
+
+//-----------------------------------------------------------------------------
+double vtkPVFrameTimerLogInformation::GetFrameEndTime(int proc, int frame)
+{
+  const vtkInternals::Frame* f = this->Internals->GetFrame(proc, frame);
+  return f ? f->End : 0.0;
+}
+
+//-----------------------------------------------------------------------------
+bool vtkPVFrameTimerLogInformation::GetFrameInteractive(int proc, int frame)
+{
+  const vtkInternals::Frame* f = this->Internals->GetFrame(proc, frame);
+  return f ? f->Interactive != 0 : false;
+}
+
+//-----------------------------------------------------------------------------
+double vtkPVFrameTimerLogInformation::GetStageTime(int proc, int frame, int stage)
+{
+  double time = 0.0;
+  if (const vtkInternals::Frame* f = this->Internals->GetFrame(proc, frame))
+  {
+    for (const auto& span : f->Spans)
+    {
+      time += span.Stage == stage ? span.Duration : 0.0;
+    }
+  }
+  return time;
+}
+
+//-----------------------------------------------------------------------------
+vtkTypeInt64 vtkPVFrameTimerLogInformation::GetStageBytes(int proc, int frame, int stage)
+{
+  vtkTypeInt64 bytes = 0;
+  if (const vtkInternals::Frame* f = this->Internals->GetFrame(proc, frame))
+  {
+    for (const auto& span : f->Spans)
+    {
+      bytes += span.Stage == stage ? span.Bytes : 0;
+    }
+  }
+  return bytes;
+}
+
+//-----------------------------------------------------------------------------
+std::string vtkPVFrameTimerLogInformation::GetChromeTrace()
+{
+  // Times are in microseconds in the trace format.
+  std::ostringstream trace;
+  trace << std::fixed << std::setprecision(1) << "{\"traceEvents\":[";
+  const char* separator = "\n";
+  for (int proc = 0, numProcs = this->GetNumberOfProcesses(); proc < numProcs; ++proc)
+  {
+    const vtkInternals::Process& process = this->Internals->Processes[proc];
+    trace << separator << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << proc
+          << ",\"args\":{\"name\":\"" << vtkGetProcessTypeName(process.ProcessType) << " "
+          << process.Rank << "\"}}";
+    separator = ",\n";
+    for (const auto& frame : process.Frames)
+    {
+      const char* category = frame.Interactive ? "interactive" : "still";
+      trace << separator << "{\"name\":\"Frame\",\"cat\":\"" << category
+            << "\",\"ph\":\"X\",\"pid\":" << proc << ",\"tid\":0,\"ts\":" << frame.Start * 1e6
+            << ",\"dur\":" << (frame.End - frame.Start) * 1e6 << "}";
+      for (const auto& span : frame.Spans)
+      {
+        trace << separator << "{\"name\":\"" << vtkPVFrameTimerLog::GetStageName(span.Stage)
+              << "\",\"cat\":\"" << category << "\",\"ph\":\"X\",\"pid\":" << proc
+              << ",\"tid\":0,\"ts\":" << span.Start * 1e6 << ",\"dur\":" << span.Duration * 1e6
+              << ",\"args\":{\"bytes\":" << span.Bytes << "}}";
+      }
+    }
+  }
+  trace << "\n]}\n";
+  return trace.str();
+}
+
+//-----------------------------------------------------------------------------
+bool vtkPVFrameTimerLogInformation::WriteChromeTrace(const char* filename)
+{
+  if (!filename)
+  {
+    vtkErrorMacro("No filename specified.");
+    return false;
+  }
+  std::ofstream file(filename);
+  if (!file)
+  {
+    vtkErrorMacro("Failed to open '" << filename << "' for writing.");
+    return false;
+  }
+  file << this->GetChromeTrace();
+  return static_cast<bool>(file);
+}
+
+//-----------------------------------------------------------------------------
+void vtkPVFrameTimerLogInformation::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "NumberOfProcesses: " << this->GetNumberOfProcesses() << endl;
+}
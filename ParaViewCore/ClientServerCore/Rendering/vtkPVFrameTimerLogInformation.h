@@ -0,0 +1,114 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    vtkPVFrameTimerLogInformation.h
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkPVFrameTimerLogInformation
+ * @brief   gathers the vtkPVFrameTimerLog of all processes.
+ *
+ * vtkPVFrameTimerLogInformation collects the frames recorded by
+ * vtkPVFrameTimerLog on every process it is gathered from. The object passed
+ * to GatherInformation() is ignored. The frames can then be queried per
+ * process or exported in the Chrome trace event format, which can be loaded
+ * in chrome://tracing or https://ui.perfetto.dev.
+ *
+ * In Python:
+ * @code{.py}
+ * info = servermanager.vtkPVFrameTimerLogInformation()
+ * session = servermanager.ActiveConnection.Session
+ * session.GatherInformation(servermanager.vtkPVSession.CLIENT_AND_SERVERS, info, 0)
+ * info.WriteChromeTrace("frames.json")
+ * @endcode
+ *
+ * @sa vtkPVFrameTimerLog
+ */
+
+#ifndef vtkPVFrameTimerLogInformation_h
+#define vtkPVFrameTimerLogInformation_h
+
+#include "vtkPVClientServerCoreRenderingModule.h" //needed for exports
+#include "vtkPVInformation.h"
+
+#include <string> // for std::string
+
+class VTKPVCLIENTSERVERCORERENDERING_EXPORT vtkPVFrameTimerLogInformation : public vtkPVInformation
+{
+public:
+  static vtkPVFrameTimerLogInformation* New();
+  vtkTypeMacro(vtkPVFrameTimerLogInformation, vtkPVInformation);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * Transfer information about a single object into this object.
+   */
+  void CopyFromObject(vtkObject*) override;
+
+  /**
+   * Merge another information object.
+   */
+  void AddInformation(vtkPVInformation*) override;
+
+  //@{
+  /**
+   * Manage a serialized version of the information.
+   */
+  void CopyToStream(vtkClientServerStream*) override;
+  void CopyFromStream(const vtkClientServerStream*) override;
+  //@}
+
+  //@{
+  /**
+   * Access the processes the frames were gathered from. The process type is
+   * one of vtkProcessModule::ProcessTypes.
+   */
+  int GetNumberOfProcesses();
+  int GetProcessType(int proc);
+  int GetRank(int proc);
+  //@}
+
+  //@{
+  /**
+   * Access the frames of a process. See vtkPVFrameTimerLog.
+   */
+  int GetNumberOfFrames(int proc);
+  double GetFrameStartTime(int proc, int frame);
+  double GetFrameEndTime(int proc, int frame);
+  bool GetFrameInteractive(int proc, int frame);
+  double GetStageTime(int proc, int frame, int stage);
+  vtkTypeInt64 GetStageBytes(int proc, int frame, int stage);
+  //@}
+
+  /**
+   * Returns the frames of all processes in the Chrome trace event format. Each
+   * process is shown as a separate track, each span as a complete event.
+   */
+  std::string GetChromeTrace();
+
+  /**
+   * Writes GetChromeTrace() to a file. Returns false on failure.
+   */
+  bool WriteChromeTrace(const char* filename);
+
+protected:
+  vtkPVFrameTimerLogInformation();
+  ~vtkPVFrameTimerLogInformation() override;
+
+private:
+  vtkPVFrameTimerLogInformation(const vtkPVFrameTimerLogInformation&) = delete;
+  void operator=(const vtkPVFrameTimerLogInformation&) = delete;
+
+  class vtkInternals;
+  vtkInternals* Internals;
+};
+
+#endif
@@ -0,0 +1,302 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    vtkPVLODPyramid.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkPVLODPyramid.h"
+
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
+#include "vtkCompositeDataIterator.h"
+#include "vtkFieldData.h"
+#include "vtkMath.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPointData.h"
+#include "vtkPolyData.h"
+#include "vtkQuadricClustering.h"
+#include "vtkSmartPointer.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+// Returns a copy of `cells`, so that traversing one does not move the
+// traversal position of the other.
+vtkSmartPointer<vtkCellArray> vtkCopyCells(vtkCellArray* cells)
+{
+  vtkSmartPointer<vtkCellArray> copy = vtkSmartPointer<vtkCellArray>::New();
+  copy->DeepCopy(cells);
+  return copy;
+}
+}
+
+//*****************************************************************************
+class vtkPVLODPyramid::vtkInternals
+{
+public:
+  // Only used on the calling thread.
+  vtkSmartPointer<vtkMultiBlockDataSet> Input;
+  std::vector<vtkSmartPointer<vtkDataObject> > Outputs;
+  double Resolution = -1.0;
+
+  // The decimation of each polydata block, for each level. They are created
+  // before the background thread starts, and only updated by it until it is
+  // done. A null filter passes its block through.
+  std::vector<std::vector<vtkSmartPointer<vtkQuadricClustering> > > Filters;
+  std::atomic<bool> Abort{ false };
+
+  // Shared with the background thread, protected by Mutex.
+  int NumberOfLevels = 0;
+  bool Done = true;
+  std::mutex Mutex;
+  std::condition_variable NewLevel;
+
+  std::thread Thread;
+
+  void Build(vtkPVLODPyramid* self)
+  {
+    for (size_t level = 0; level < this->Filters.size(); ++level)
+    {
+      for (size_t cc = 0; cc < this->Filters[level].size() && !this->Abort; ++cc)
+      {
+        if (vtkQuadricClustering* filter = this->Filters[level][cc])
+        {
+          filter->Update();
+        }
+      }
+      if (this->Abort)
+      {
+        break;
+      }
+
+      {
+        std::lock_guard<std::mutex> lock(this->Mutex);
+        ++this->NumberOfLevels;
+        this->NewLevel.notify_all();
+      }
+      self->LevelBuilt(static_cast<int>(level));
+    }
+
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    this->Done = true;
+    this->NewLevel.notify_all();
+  }
+
+  vtkSmartPointer<vtkDataObject> Assemble(size_t level)
+  {
+    vtkSmartPointer<vtkMultiBlockDataSet> output = vtkSmartPointer<vtkMultiBlockDataSet>::New();
+    output->CopyStructure(this->Input);
+
+    vtkSmartPointer<vtkCompositeDataIterator> iter;
+    iter.TakeReference(this->Input->NewIterator());
+    size_t index = 0;
+    for (iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextItem())
+    {
+      vtkDataObject* leaf = iter->GetCurrentDataObject();
+      if (vtkPolyData::SafeDownCast(leaf))
+      {
+        vtkQuadricClustering* filter = this->Filters[level][index++];
+        output->SetDataSet(iter, filter ? filter->GetOutput() : leaf);
+      }
+      else
+      {
+        output->SetDataSet(iter, leaf);
+      }
+    }
+    return output;
+  }
+};
+
+vtkStandardNewMacro(vtkPVLODPyramid);
+//----------------------------------------------------------------------------
+vtkPVLODPyramid::vtkPVLODPyramid()
+  : Internals(new vtkPVLODPyramid::vtkInternals())
+{
+}
+
+//----------------------------------------------------------------------------
+vtkPVLODPyramid::~vtkPVLODPyramid()
+{
+  this->Stop();
+  delete this->Internals;
+}
+
+//----------------------------------------------------------------------------
+int vtkPVLODPyramid::GetNumberOfDivisions(double factor)
+{
+  factor = vtkMath::ClampValue(factor, 0., 1.);
+  return static_cast<int>(150 * factor) + 10;
+}
+
+//----------------------------------------------------------------------------
+void vtkPVLODPyramid::Start(vtkDataObject* input, double resolution)
+{
+  this->Stop();
+
+  vtkInternals& internals = *this->Internals;
+  vtkMultiBlockDataSet* inputMB = vtkMultiBlockDataSet::SafeDownCast(input);
+  if (!inputMB || inputMB->GetNumberOfPoints() == 0)
+  {
+    return;
+  }
+
+  resolution = vtkMath::ClampValue(resolution, 0., 1.);
+  std::vector<int> divisions;
+  const double factors[] = { 0.0, 0.5 * resolution, resolution };
+  for (double factor : factors)
+  {
+    if (divisions.empty() || factor > internals.Resolution)
+    {
+      divisions.push_back(vtkPVLODPyramid::GetNumberOfDivisions(factor));
+      internals.Resolution = factor;
+    }
+  }
+  internals.Filters.resize(divisions.size());
+  internals.Outputs.resize(divisions.size());
+
+  internals.Input = inputMB;
+  vtkSmartPointer<vtkCompositeDataIterator> iter;
+  iter.TakeReference(inputMB->NewIterator());
+  for (iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextItem())
+  {
+    vtkPolyData* pd = vtkPolyData::SafeDownCast(iter->GetCurrentDataObject());
+    if (!pd)
+    {
+      continue;
+    }
+    if (pd->GetNumberOfPoints() == 0)
+    {
+      for (auto& filters : internals.Filters)
+      {
+        filters.push_back(nullptr);
+      }
+      continue;
+    }
+
+    vtkNew<vtkPolyData> copy;
+    copy->SetPoints(pd->GetPoints());
+    copy->SetVerts(vtkCopyCells(pd->GetVerts()));
+    copy->SetLines(vtkCopyCells(pd->GetLines()));
+    copy->SetPolys(vtkCopyCells(pd->GetPolys()));
+    copy->SetStrips(vtkCopyCells(pd->GetStrips()));
+    copy->GetPointData()->ShallowCopy(pd->GetPointData());
+    copy->GetCellData()->ShallowCopy(pd->GetCellData());
+    copy->GetFieldData()->ShallowCopy(pd->GetFieldData());
+    // compute the bounds now, so that the filters only read them.
+    double bounds[6];
+    copy->GetBounds(bounds);
+
+    for (size_t level = 0; level < divisions.size(); ++level)
+    {
+      vtkSmartPointer<vtkQuadricClustering> filter = vtkSmartPointer<vtkQuadricClustering>::New();
+      filter->SetUseInputPoints(1);
+      filter->SetCopyCellData(1);
+      filter->SetUseInternalTriangles(0);
+      filter->SetNumberOfDivisions(divisions[level], divisions[level], divisions[level]);
+      filter->SetInputData(copy.GetPointer());
+      internals.Filters[level].push_back(filter);
+    }
+  }
+
+  internals.Done = false;
+  internals.NumberOfLevels = 0;
+  internals.Thread = std::thread([this, &internals]() { internals.Build(this); });
+}
+
+//----------------------------------------------------------------------------
+void vtkPVLODPyramid::Stop()
+{
+  vtkInternals& internals = *this->Internals;
+  if (internals.Thread.joinable())
+  {
+    internals.Abort = true;
+    internals.Thread.join();
+  }
+  internals.Abort = false;
+  internals.Done = true;
+  internals.NumberOfLevels = 0;
+  internals.Outputs.clear();
+  internals.Filters.clear();
+  internals.Input = nullptr;
+  internals.Resolution = -1.0;
+}
+
+//----------------------------------------------------------------------------
+double vtkPVLODPyramid::GetResolution() const
+{
+  return this->Internals->Resolution;
+}
+
+//----------------------------------------------------------------------------
+vtkDataObject* vtkPVLODPyramid::GetFinestLevel()
+{
+  vtkInternals& internals = *this->Internals;
+  size_t index = 0;
+  {
+    std::unique_lock<std::mutex> lock(internals.Mutex);
+    internals.NewLevel.wait(lock, [&internals]() {
+      return internals.NumberOfLevels > 0 || internals.Done;
+    });
+    if (internals.NumberOfLevels == 0)
+    {
+      return nullptr;
+    }
+    index = static_cast<size_t>(internals.NumberOfLevels - 1);
+  }
+
+  if (!internals.Outputs[index])
+  {
+    internals.Outputs[index] = internals.Assemble(index);
+  }
+  return internals.Outputs[index];
+}
+
+//----------------------------------------------------------------------------
+void vtkPVLODPyramid::Abort()
+{
+  this->Internals->Abort = true;
+}
+
+//----------------------------------------------------------------------------
+void vtkPVLODPyramid::LevelBuilt(int)
+{
+}
+
+//----------------------------------------------------------------------------
+void vtkPVLODPyramid::Wait()
+{
+  vtkInternals& internals = *this->Internals;
+  std::unique_lock<std::mutex> lock(internals.Mutex);
+  internals.NewLevel.wait(lock, [&internals]() { return internals.Done; });
+}
+
+//----------------------------------------------------------------------------
+int vtkPVLODPyramid::GetNumberOfLevels()
+{
+  vtkInternals& internals = *this->Internals;
+  std::lock_guard<std::mutex> lock(internals.Mutex);
+  return internals.NumberOfLevels;
+}
+
+//----------------------------------------------------------------------------
+void vtkPVLODPyramid::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Resolution: " << this->GetResolution() << endl;
+  os << indent << "NumberOfLevels: " << this->GetNumberOfLevels() << endl;
+}
@@ -0,0 +1,123 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    vtkPVLODPyramid.h
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkPVLODPyramid
+ * @brief   decimates geometry at a few resolutions on a background thread.
+ *
+ * vtkPVLODPyramid is used by vtkGeometryRepresentation to build the LOD
+ * geometry ahead of the first interaction. Start() decimates the polydata
+ * blocks of a vtkMultiBlockDataSet with vtkQuadricClustering, at up to three
+ * resolutions, coarsest first: LOD factor 0, half the requested factor, and
+ * the requested factor itself. The clustering grid has `150 * factor + 10`
+ * divisions along each axis, as for the decimator of vtkGeometryRepresentation,
+ * and is configured the same way: output points are input points, and cell
+ * data is copied.
+ *
+ * Start() creates a vtkQuadricClustering per level and per block on the
+ * calling thread, each with a private copy of its block that shares the points
+ * and attribute arrays but not the cell arrays, whose traversal is not
+ * thread-safe. The background thread only updates these filters, as
+ * vtkThreadedCompositeDataPipeline does, and never touches the input datasets
+ * nor any pipeline outside of them. The output multiblocks are assembled on the
+ * calling thread, by GetFinestLevel(). The thread checks for cancellation
+ * between blocks, so Stop() waits for one block to be decimated at most.
+ *
+ * The input must not be modified until Stop() is called or a new Start()
+ * replaces it.
+ */
+
+#ifndef vtkPVLODPyramid_h
+#define vtkPVLODPyramid_h
+
+#include "vtkObject.h"
+#include "vtkPVClientServerCoreRenderingModule.h" // needed for exports
+
+class vtkDataObject;
+
+class VTKPVCLIENTSERVERCORERENDERING_EXPORT vtkPVLODPyramid : public vtkObject
+{
+public:
+  static vtkPVLODPyramid* New();
+  vtkTypeMacro(vtkPVLODPyramid, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * Stops any previous decimation and starts decimating `input`, up to the LOD
+   * factor `resolution`, in the range [0, 1]. Only vtkMultiBlockDataSet inputs
+   * with polydata leaves are decimated; for other inputs, GetFinestLevel()
+   * returns nullptr.
+   */
+  void Start(vtkDataObject* input, double resolution);
+
+  /**
+   * Stops the decimation and releases the input and all levels.
+   */
+  void Stop();
+
+  /**
+   * Returns the LOD factor of the finest level, or -1 when not started.
+   */
+  double GetResolution() const;
+
+  /**
+   * Returns the finest level built so far, waiting for the coarsest one if
+   * needed. Returns nullptr if no level could be built. A finer level is
+   * returned as soon as it is built, callers check whether the returned
+   * dataset changed to pick it up.
+   */
+  vtkDataObject* GetFinestLevel();
+
+  /**
+   * Asks the background thread to stop once it is done with the current block,
+   * without waiting for it. The levels already built are kept. Unlike the other
+   * methods, this may be called from any thread.
+   */
+  void Abort();
+
+  /**
+   * Waits for all levels to be built, or for the decimation to be stopped.
+   */
+  void Wait();
+
+  /**
+   * Returns the number of levels built so far.
+   */
+  int GetNumberOfLevels();
+
+  /**
+   * Returns the number of divisions of the clustering grid, along each axis,
+   * for the LOD factor `factor`.
+   */
+  static int GetNumberOfDivisions(double factor);
+
+protected:
+  vtkPVLODPyramid();
+  ~vtkPVLODPyramid() override;
+
+  /**
+   * Called on the background thread once the level `level` is built, 0 being
+   * the coarsest one. Does nothing by default. Overrides must be thread-safe.
+   */
+  virtual void LevelBuilt(int level);
+
+private:
+  vtkPVLODPyramid(const vtkPVLODPyramid&) = delete;
+  void operator=(const vtkPVLODPyramid&) = delete;
+
+  class vtkInternals;
+  vtkInternals* Internals;
+};
+
+#endif
@@ -57,12 +57,14 @@
 #include "vtkPVClientServerSynchronizedRenderers.h"
 #include "vtkPVDataDeliveryManager.h"
 #include "vtkPVDataRepresentation.h"
+#include "vtkPVFrameTimerLog.h"
 #include "vtkPVGridAxes3DActor.h"
 #include "vtkPVHardwareSelector.h"
 #include "vtkPVInteractorStyle.h"
 #include "vtkPVLogger.h"
 #include "vtkPVMaterialLibrary.h"
 #include "vtkPVOptions.h"
+#include "vtkPVRenderingCostModel.h"
 #include "vtkPVServerInformation.h"
 #include "vtkPVSession.h"
 #include "vtkPVStreamingMacros.h"
@@ -109,6 +111,7 @@
 #include "vtkOSPRayRendererNode.h"
 #endif
 
+#include <algorithm>
 #include <cassert>
 #include <map>
 #include <set>
@@ -361,6 +364,11 @@ vtkPVRenderView::vtkPVRenderView()
   this->InteractiveRenderImageReductionFactor = 2;
   this->RemoteRenderingThreshold = 0;
   this->LODRenderingThreshold = 0;
+  this->GeometrySize = 0;
+  this->LODGeometrySize = 0;
+  this->UseRenderingCostModel = false;
+  this->RemoteRenderingCostDecision = -1;
+  this->RemoteRenderingCostDecisionLOD = -1;
   this->LODResolution = 0.5;
   this->UseOutlineForLODRendering = false;
   this->UseLightKit = false;
@@ -1210,6 +1218,7 @@ void vtkPVRenderView::Update()
   vtkVLogScopeFunction(PARAVIEW_LOG_RENDERING_VERBOSITY());
 
   vtkTimerLog::MarkStartEvent("RenderView::Update");
+  vtkPVFrameTimerLog::Scope frameTimerScope(vtkPVFrameTimerLog::UPDATE);
 
   // reset the bounds, so that representations can provide us with bounds
   // information during update.
@@ -1260,6 +1269,9 @@ void vtkPVRenderView::Update()
   double local_size = this->GetDeliveryManager()->GetVisibleDataSize(false) / 1024.0;
   this->SynchronizedWindows->SynchronizeSize(local_size);
   // cout << "Full Geometry size: " << local_size << endl;
+  this->GeometrySize = local_size;
+  this->RemoteRenderingCostDecision =
+    this->ChooseRemoteRenderingFromCostModel(local_size, this->UseDistributedRenderingForRender);
 
   // Update decisions about lod-rendering and remote-rendering.
   this->UseLODForInteractiveRender = this->ShouldUseLODRendering(local_size);
@@ -1327,6 +1339,9 @@ void vtkPVRenderView::UpdateLOD()
   double local_size = this->GetDeliveryManager()->GetVisibleDataSize(true) / 1024.0;
   this->SynchronizedWindows->SynchronizeSize(local_size);
   // cout << "LOD Geometry size: " << local_size << endl;
+  this->LODGeometrySize = local_size;
+  this->RemoteRenderingCostDecisionLOD = this->ChooseRemoteRenderingFromCostModel(
+    local_size, this->UseDistributedRenderingForLODRender);
 
   this->UseDistributedRenderingForLODRender =
     this->ShouldUseDistributedRendering(local_size, /*using_lod=*/true);
@@ -1352,7 +1367,12 @@ void vtkPVRenderView::StillRender()
 
   this->Internals->PreRender(this->RenderView);
 
-  this->Render(false, this->SuppressRendering);
+  {
+    vtkPVFrameTimerLog::Scope frameTimerScope(vtkPVFrameTimerLog::RENDER);
+    this->Render(false, this->SuppressRendering);
+  }
+  vtkPVFrameTimerLog::EndFrame(false);
+  this->UpdateRenderingCostModel(false);
 
   vtkTimerLog::MarkEndEvent("Still Render");
 }
@@ -1368,7 +1388,12 @@ void vtkPVRenderView::InteractiveRender()
   this->Internals->OSPRayCount = 0;
   this->Internals->PreRender(this->RenderView);
 
-  this->Render(true, this->SuppressRendering);
+  {
+    vtkPVFrameTimerLog::Scope frameTimerScope(vtkPVFrameTimerLog::RENDER);
+    this->Render(true, this->SuppressRendering);
+  }
+  vtkPVFrameTimerLog::EndFrame(true);
+  this->UpdateRenderingCostModel(true);
 
   vtkTimerLog::MarkEndEvent("Interactive Render");
 }
@@ -1624,6 +1649,18 @@ void vtkPVRenderView::Deliver(int use_lod, unsigned int size, unsigned int* repr
   this->GetDeliveryManager()->Deliver(use_lod, size, representation_ids);
 }
 
+//----------------------------------------------------------------------------
+void vtkPVRenderView::SetClientGeometryCacheSize(int size)
+{
+  this->GetDeliveryManager()->SetClientCacheSize(static_cast<unsigned long>(std::max(size, 0)));
+}
+
+//----------------------------------------------------------------------------
+int vtkPVRenderView::GetClientGeometryCacheSize()
+{
+  return static_cast<int>(this->GetDeliveryManager()->GetClientCacheSize());
+}
+
 //----------------------------------------------------------------------------
 int vtkPVRenderView::GetDataDistributionMode(bool use_remote_rendering)
 {
@@ -1985,6 +2022,14 @@ bool vtkPVRenderView::ShouldUseDistributedRendering(double geometry_size, bool u
       throw true;
     }
 
+    // the cost model, when calibrated, overrides the threshold.
+    const int cost_decision =
+      using_lod ? this->RemoteRenderingCostDecisionLOD : this->RemoteRenderingCostDecision;
+    if (cost_decision >= 0)
+    {
+      throw(cost_decision == 1);
+    }
+
     throw(this->RemoteRenderingThreshold <= geometry_size);
   }
   catch (bool val)
@@ -2014,6 +2059,57 @@ bool vtkPVRenderView::ShouldUseDistributedRendering(double geometry_size, bool u
   }
 }
 
+//----------------------------------------------------------------------------
+int vtkPVRenderView::ChooseRemoteRenderingFromCostModel(double geometry_size, bool current_remote)
+{
+  if (!this->UseRenderingCostModel)
+  {
+    return -1;
+  }
+
+  // only the client measures the frames, hence the decision is made there and
+  // broadcast to the servers.
+  vtkIdType decision = -1;
+  if (this->SynchronizedWindows->GetMode() == vtkPVSynchronizedRenderWindows::CLIENT)
+  {
+    const int* image_size = this->GetRenderWindow()->GetActualSize();
+    const double local_cost =
+      this->RenderingCostModel->PredictLocalRenderingCost(geometry_size, image_size);
+    const double remote_cost =
+      this->RenderingCostModel->PredictRemoteRenderingCost(geometry_size, image_size);
+    decision =
+      this->RenderingCostModel->ChooseRemoteRendering(geometry_size, image_size, current_remote);
+    vtkVLogF(PARAVIEW_LOG_RENDERING_VERBOSITY(),
+      "rendering cost model: geometry %g MB, local %g s, remote %g s, currently %s, choosing %s",
+      geometry_size, local_cost, remote_cost, (current_remote ? "remote" : "local"),
+      (decision < 0 ? "by threshold" : (decision == 1 ? "remote" : "local")));
+  }
+  this->SynchronizedWindows->Reduce(decision, vtkPVSynchronizedRenderWindows::MAX_OP);
+  return static_cast<int>(decision);
+}
+
+//----------------------------------------------------------------------------
+void vtkPVRenderView::UpdateRenderingCostModel(bool interactive)
+{
+  // frames rendered on tile or CAVE displays are always remote, whatever the
+  // decision was.
+  if (!this->UseRenderingCostModel || this->SuppressRendering ||
+    vtkPVFrameTimerLog::GetMaxNumberOfFrames() == 0 ||
+    vtkPVFrameTimerLog::GetNumberOfFrames() == 0 ||
+    this->SynchronizedWindows->GetMode() != vtkPVSynchronizedRenderWindows::CLIENT ||
+    this->InTileDisplayMode() || this->InCaveDisplayMode())
+  {
+    return;
+  }
+
+  const bool remote = interactive ? this->UseDistributedRenderingForLODRender
+                                  : this->UseDistributedRenderingForRender;
+  const double geometry_size =
+    this->UsedLODForLastRender ? this->LODGeometrySize : this->GeometrySize;
+  this->RenderingCostModel->AddFrame(
+    vtkPVFrameTimerLog::GetNumberOfFrames() - 1, remote, geometry_size);
+}
+
 //----------------------------------------------------------------------------
 bool vtkPVRenderView::ShouldUseLODRendering(double geometry_size)
 {
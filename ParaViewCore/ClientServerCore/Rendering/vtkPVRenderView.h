@@ -60,6 +60,7 @@ class vtkPVGridAxes3DActor;
 class vtkPVHardwareSelector;
 class vtkPVInteractorStyle;
 class vtkPVMaterialLibrary;
+class vtkPVRenderingCostModel;
 class vtkPVSynchronizedRenderer;
 class vtkRenderer;
 class vtkRenderViewBase;
@@ -250,6 +251,21 @@ public:
   vtkGetMacro(RemoteRenderingThreshold, double);
   //@}
 
+  //@{
+  /**
+   * When on, the choice between local and remote rendering is made by
+   * predicting the cost of each mode from the measured link latency and
+   * bandwidth and render times, rather than by comparing the geometry size to
+   * RemoteRenderingThreshold. The threshold is still used until enough frames
+   * have been measured. The decisions are logged with the rendering verbosity.
+   * Default is off.
+   * @sa vtkPVRenderingCostModel
+   * \note CallOnAllProcesses
+   */
+  vtkSetMacro(UseRenderingCostModel, bool);
+  vtkGetMacro(UseRenderingCostModel, bool);
+  //@}
+
   //@{
   /**
    * Get/Set the data-size in megabytes above which LOD rendering should be
@@ -744,6 +760,18 @@ public:
    */
   void Deliver(int use_lod, unsigned int size, unsigned int* representation_ids);
 
+  //@{
+  /**
+   * Get/Set the maximum size, in megabytes, of the geometry cached on the
+   * client to avoid delivering it again, e.g. when playing an animation in a
+   * loop. 0 disables the cache.
+   * @sa vtkPVDataDeliveryManager::SetClientCacheSize
+   * \note CallOnAllProcesses
+   */
+  void SetClientGeometryCacheSize(int size);
+  int GetClientGeometryCacheSize();
+  //@}
+
   /**
    * Returns true when ordered compositing is needed on the current group of
    * processes. Note that unlike most other functions, this may return different
@@ -1002,6 +1030,21 @@ protected:
    */
   bool ShouldUseDistributedRendering(double geometry_size, bool using_lod);
 
+  /**
+   * Returns 1 if the rendering cost model predicts remote rendering to be the
+   * cheapest for the geometry size, 0 if it predicts local rendering to be,
+   * or -1 if the model is not used or not calibrated yet. The prediction is
+   * made on the client and shared with all processes.
+   * \note CallOnAllProcesses
+   */
+  int ChooseRemoteRenderingFromCostModel(double geometry_size, bool current_remote);
+
+  /**
+   * Adds the last frame recorded by vtkPVFrameTimerLog to the rendering cost
+   * model.
+   */
+  void UpdateRenderingCostModel(bool interactive);
+
   /**
    * Returns true if LOD rendering should be used based on the geometry size.
    */
@@ -1125,6 +1168,13 @@ protected:
   // In mega-bytes.
   double RemoteRenderingThreshold;
   double LODRenderingThreshold;
+  double GeometrySize;
+  double LODGeometrySize;
+
+  bool UseRenderingCostModel;
+  vtkNew<vtkPVRenderingCostModel> RenderingCostModel;
+  int RemoteRenderingCostDecision;
+  int RemoteRenderingCostDecisionLOD;
   vtkBoundingBox GeometryBounds;
 
   bool UseInteractiveRenderingForScreenshots;
@@ -0,0 +1,251 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    vtkPVRenderingCostModel.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkPVRenderingCostModel.h"
+
+#include "vtkObjectFactory.h"
+#include "vtkPVFrameTimerLog.h"
+
+#include <algorithm>
+
+namespace
+{
+// weighted least squares fit of y = a + b * x, with a and b >= 0.
+class vtkLinearFit
+{
+public:
+  void Add(double x, double y, double decay)
+  {
+    this->W = this->W * decay + 1.0;
+    this->X = this->X * decay + x;
+    this->Y = this->Y * decay + y;
+    this->XX = this->XX * decay + x * x;
+    this->XY = this->XY * decay + x * y;
+  }
+
+  bool IsValid() const { return this->W > 0.0; }
+
+  double Evaluate(double x) const
+  {
+    double a = 0.0, b = 0.0;
+    this->Solve(a, b);
+    return a + b * x;
+  }
+
+  void Solve(double& a, double& b) const
+  {
+    a = b = 0.0;
+    if (this->W <= 0.0)
+    {
+      return;
+    }
+
+    const double det = this->W * this->XX - this->X * this->X;
+    if (det > 1e-3 * this->W * this->XX)
+    {
+      b = (this->W * this->XY - this->X * this->Y) / det;
+      a = (this->Y - b * this->X) / this->W;
+    }
+    else if (this->XX > 0.0)
+    {
+      // all samples are at about the same x: assume y is proportional to x.
+      b = this->XY / this->XX;
+    }
+    else
+    {
+      a = this->Y / this->W;
+    }
+
+    if (b < 0.0)
+    {
+      a = this->Y / this->W;
+      b = 0.0;
+    }
+    else if (a < 0.0)
+    {
+      a = 0.0;
+      b = this->XX > 0.0 ? this->XY / this->XX : 0.0;
+    }
+  }
+
+private:
+  double W = 0.0;
+  double X = 0.0;
+  double Y = 0.0;
+  double XX = 0.0;
+  double XY = 0.0;
+};
+
+double GetImageSize(const int image_size[2])
+{
+  // uncompressed RGB image, in megabytes.
+  return image_size[0] * static_cast<double>(image_size[1]) * 3 / (1024.0 * 1024.0);
+}
+}
+
+class vtkPVRenderingCostModel::vtkInternals
+{
+public:
+  // transfer time as a function of the size, in megabytes.
+  vtkLinearFit Link;
+  // render times as a function of the geometry size, in megabytes.
+  vtkLinearFit LocalRender;
+  vtkLinearFit RemoteRender;
+};
+
+vtkStandardNewMacro(vtkPVRenderingCostModel);
+//----------------------------------------------------------------------------
+vtkPVRenderingCostModel::vtkPVRenderingCostModel()
+  : Hysteresis(0.2)
+  , DeliveryAmortization(10.0)
+  , Decay(0.9)
+  , Internals(new vtkPVRenderingCostModel::vtkInternals())
+{
+}
+
+//----------------------------------------------------------------------------
+vtkPVRenderingCostModel::~vtkPVRenderingCostModel()
+{
+  delete this->Internals;
+}
+
+//----------------------------------------------------------------------------
+void vtkPVRenderingCostModel::AddFrame(int frame, bool remote, double geometry_size)
+{
+  for (int cc = 0, max = vtkPVFrameTimerLog::GetNumberOfSpans(frame); cc < max; ++cc)
+  {
+    const int stage = vtkPVFrameTimerLog::GetSpanStage(frame, cc);
+    const vtkTypeInt64 bytes = vtkPVFrameTimerLog::GetSpanBytes(frame, cc);
+    if ((stage == vtkPVFrameTimerLog::DELIVERY || stage == vtkPVFrameTimerLog::TRANSFER) &&
+      bytes > 0)
+    {
+      this->AddTransferSample(bytes, vtkPVFrameTimerLog::GetSpanDuration(frame, cc));
+    }
+  }
+
+  const double time = vtkPVFrameTimerLog::GetStageTime(frame, vtkPVFrameTimerLog::RENDER);
+  if (time <= 0.0)
+  {
+    return;
+  }
+  if (remote)
+  {
+    this->AddRemoteRenderSample(geometry_size, time);
+  }
+  else
+  {
+    this->AddLocalRenderSample(geometry_size, time);
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkPVRenderingCostModel::AddTransferSample(vtkTypeInt64 bytes, double time)
+{
+  this->Internals->Link.Add(bytes / (1024.0 * 1024.0), time, this->Decay);
+}
+
+//----------------------------------------------------------------------------
+void vtkPVRenderingCostModel::AddLocalRenderSample(double geometry_size, double time)
+{
+  this->Internals->LocalRender.Add(geometry_size, time, this->Decay);
+}
+
+//----------------------------------------------------------------------------
+void vtkPVRenderingCostModel::AddRemoteRenderSample(double geometry_size, double time)
+{
+  this->Internals->RemoteRender.Add(geometry_size, time, this->Decay);
+}
+
+//----------------------------------------------------------------------------
+void vtkPVRenderingCostModel::Reset()
+{
+  delete this->Internals;
+  this->Internals = new vtkPVRenderingCostModel::vtkInternals();
+}
+
+//----------------------------------------------------------------------------
+double vtkPVRenderingCostModel::PredictLocalRenderingCost(
+  double geometry_size, const int image_size[2])
+{
+  const vtkInternals& internals = *this->Internals;
+  if (!internals.Link.IsValid())
+  {
+    return -1.0;
+  }
+
+  double render_time;
+  if (internals.LocalRender.IsValid())
+  {
+    render_time = internals.LocalRender.Evaluate(geometry_size);
+  }
+  else if (internals.RemoteRender.IsValid())
+  {
+    render_time = std::max(internals.RemoteRender.Evaluate(geometry_size) -
+        internals.Link.Evaluate(GetImageSize(image_size)),
+      0.0);
+  }
+  else
+  {
+    return -1.0;
+  }
+  return render_time + internals.Link.Evaluate(geometry_size) / this->DeliveryAmortization;
+}
+
+//----------------------------------------------------------------------------
+double vtkPVRenderingCostModel::PredictRemoteRenderingCost(
+  double geometry_size, const int image_size[2])
+{
+  const vtkInternals& internals = *this->Internals;
+  if (internals.RemoteRender.IsValid())
+  {
+    return internals.RemoteRender.Evaluate(geometry_size);
+  }
+  if (internals.LocalRender.IsValid() && internals.Link.IsValid())
+  {
+    return internals.LocalRender.Evaluate(geometry_size) +
+      internals.Link.Evaluate(GetImageSize(image_size));
+  }
+  return -1.0;
+}
+
+//----------------------------------------------------------------------------
+int vtkPVRenderingCostModel::ChooseRemoteRendering(
+  double geometry_size, const int image_size[2], bool current_remote)
+{
+  const double local_cost = this->PredictLocalRenderingCost(geometry_size, image_size);
+  const double remote_cost = this->PredictRemoteRenderingCost(geometry_size, image_size);
+  if (local_cost < 0.0 || remote_cost < 0.0)
+  {
+    return -1;
+  }
+  if (current_remote)
+  {
+    return local_cost < remote_cost * (1.0 - this->Hysteresis) ? 0 : 1;
+  }
+  return remote_cost < local_cost * (1.0 - this->Hysteresis) ? 1 : 0;
+}
+
+//----------------------------------------------------------------------------
+void vtkPVRenderingCostModel::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Hysteresis: " << this->Hysteresis << endl;
+  os << indent << "DeliveryAmortization: " << this->DeliveryAmortization << endl;
+  os << indent << "Decay: " << this->Decay << endl;
+
+  double a, b;
+  this->Internals->Link.Solve(a, b);
+  os << indent << "Latency: " << a << endl;
+  os << indent << "Bandwidth: " << (b > 0.0 ? 1.0 / b : 0.0) << endl;
+}
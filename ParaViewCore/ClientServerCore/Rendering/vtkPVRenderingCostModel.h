@@ -0,0 +1,141 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    vtkPVRenderingCostModel.h
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkPVRenderingCostModel
+ * @brief   predicts the cost of local and remote rendering.
+ *
+ * vtkPVRenderingCostModel is used by vtkPVRenderView on the client to decide
+ * between local and remote rendering from measurements rather than from a
+ * fixed geometry size threshold. It is fed the frames recorded by
+ * vtkPVFrameTimerLog, from which it fits:
+ *
+ * \li the link latency and bandwidth, from the geometry deliveries and image
+ *     transfers, as `time = latency + bytes / bandwidth`;
+ * \li the time to render a frame locally, as a linear function of the
+ *     geometry size;
+ * \li the time to render a frame remotely, as seen by the client i.e.
+ *     including rendering, compositing and the image transfer, as a linear
+ *     function of the geometry size.
+ *
+ * Older samples are progressively forgotten so that the model follows changes
+ * in the link or the load.
+ *
+ * The cost of local rendering is the local render time plus the time to
+ * deliver the geometry, amortized over DeliveryAmortization frames. The cost of
+ * remote rendering is the remote render time. Until a mode has been measured,
+ * its cost is estimated from the other one: the remote render time as the
+ * local render time plus the transfer of an uncompressed image, and the local
+ * render time as the remote render time minus that transfer. If the link has
+ * not been measured either, no decision is made.
+ *
+ * To avoid flip-flopping between modes, the current mode is only abandoned if
+ * the other one is predicted to be cheaper by more than Hysteresis.
+ */
+
+#ifndef vtkPVRenderingCostModel_h
+#define vtkPVRenderingCostModel_h
+
+#include "vtkObject.h"
+#include "vtkPVClientServerCoreRenderingModule.h" // needed for exports
+
+class VTKPVCLIENTSERVERCORERENDERING_EXPORT vtkPVRenderingCostModel : public vtkObject
+{
+public:
+  static vtkPVRenderingCostModel* New();
+  vtkTypeMacro(vtkPVRenderingCostModel, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  //@{
+  /**
+   * Get/Set the relative cost difference needed to switch from the current
+   * mode to the other one. Default is 0.2.
+   */
+  vtkSetClampMacro(Hysteresis, double, 0.0, 1.0);
+  vtkGetMacro(Hysteresis, double);
+  //@}
+
+  //@{
+  /**
+   * Get/Set the number of frames over which the cost of delivering the
+   * geometry to the client is spread. Default is 10.
+   */
+  vtkSetClampMacro(DeliveryAmortization, double, 1.0, VTK_DOUBLE_MAX);
+  vtkGetMacro(DeliveryAmortization, double);
+  //@}
+
+  //@{
+  /**
+   * Get/Set the weight of the past samples, per new sample. Default is 0.9.
+   */
+  vtkSetClampMacro(Decay, double, 0.0, 1.0);
+  vtkGetMacro(Decay, double);
+  //@}
+
+  /**
+   * Adds the measurements of a frame recorded by vtkPVFrameTimerLog.
+   * `remote` tells whether the frame was rendered remotely and `geometry_size`
+   * is the size, in megabytes, of the geometry it rendered.
+   */
+  void AddFrame(int frame, bool remote, double geometry_size);
+
+  //@{
+  /**
+   * Adds individual measurements. Times are in seconds.
+   */
+  void AddTransferSample(vtkTypeInt64 bytes, double time);
+  void AddLocalRenderSample(double geometry_size, double time);
+  void AddRemoteRenderSample(double geometry_size, double time);
+  //@}
+
+  /**
+   * Forgets all measurements.
+   */
+  void Reset();
+
+  //@{
+  /**
+   * Returns the predicted cost, in seconds per frame, of rendering geometry
+   * of the given size, in megabytes, locally or remotely. `image_size` is the
+   * size of the image in pixels. Returns -1 if there are not enough
+   * measurements.
+   */
+  double PredictLocalRenderingCost(double geometry_size, const int image_size[2]);
+  double PredictRemoteRenderingCost(double geometry_size, const int image_size[2]);
+  //@}
+
+  /**
+   * Returns 1 if remote rendering is the cheapest, 0 if local rendering is,
+   * taking the hysteresis from the current mode into account, or -1 if there
+   * are not enough measurements.
+   */
+  int ChooseRemoteRendering(double geometry_size, const int image_size[2], bool current_remote);
+
+protected:
+  vtkPVRenderingCostModel();
+  ~vtkPVRenderingCostModel() override;
+
+  double Hysteresis;
+  double DeliveryAmortization;
+  double Decay;
+
+private:
+  vtkPVRenderingCostModel(const vtkPVRenderingCostModel&) = delete;
+  void operator=(const vtkPVRenderingCostModel&) = delete;
+
+  class vtkInternals;
+  vtkInternals* Internals;
+};
+
+#endif
@@ -27,6 +27,7 @@
 #include "vtkMemberFunctionCommand.h"
 #include "vtkMultiProcessController.h"
 #include "vtkMultiProcessStream.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPVMergeTables.h"
 #include "vtkPVSynchronizedRenderWindows.h"
@@ -42,8 +43,10 @@
 #include <algorithm>
 #include <map>
 #include <set>
+#include <sstream>
 #include <string>
 #include <vector>
+#include <vtksys/SystemTools.hxx>
 namespace
 {
 struct OrderByNames : std::binary_function<vtkAbstractArray*, vtkAbstractArray*, bool>
@@ -151,6 +154,7 @@ class vtkSpreadSheetView::vtkInternals
   std::vector<std::tuple<std::string, std::string, int> > ColumnMetaData;
   std::map<std::string, size_t> ColumnIndexMap;
 
+public:
   void UpdateColumnMetaData(vtkTable* table)
   {
     this->ColumnMetaData.clear();
@@ -183,6 +187,7 @@ class vtkSpreadSheetView::vtkInternals
       this->ColumnIndexMap.size() == static_cast<size_t>(table->GetNumberOfColumns()));
   }
 
+private:
   vtkIdType GetMostRecentlyAccessedBlock(vtkSpreadSheetView* self)
   {
     vtkIdType maxBlockId = self->GetNumberOfRows() / self->TableStreamer->GetBlockSize();
@@ -790,6 +795,7 @@ bool vtkSpreadSheetView::Export(vtkCSVExporter* exporter)
   {
     vtkIdType blockSize = this->TableStreamer->GetBlockSize();
     vtkIdType numBlocks = (this->GetNumberOfRows() / blockSize) + 1;
+    exporter->SetTotalNumberOfRows(this->GetNumberOfRows());
     for (vtkIdType cc = 0; cc < numBlocks; cc++)
     {
       if (vtkTable* block = this->FetchBlock(cc))
@@ -797,30 +803,7 @@ bool vtkSpreadSheetView::Export(vtkCSVExporter* exporter)
         auto* rowData = block->GetRowData();
         if (cc == 0)
         {
-          // update column labels; this ensures that all the columns have same
-          // names as the spreadsheet view.
-          for (vtkIdType idx = 0; idx < rowData->GetNumberOfArrays(); ++idx)
-          {
-            if (auto array = rowData->GetAbstractArray(idx))
-            {
-              // note: internal columns get nullptr label which the exporter
-              // skips.
-              auto name = array->GetName();
-              auto label = this->GetColumnLabel(name);
-              if (this->IsColumnInternal(name) || this->IsColumnHiddenByName(name) ||
-                this->IsColumnHiddenByLabel(label))
-              {
-                exporter->SetColumnLabel(array->GetName(), nullptr);
-              }
-              else
-              {
-                // we don't use the label since it is same for all components in
-                // the array, instead we only use user friendly version of the
-                // array name.
-                exporter->SetColumnLabel(array->GetName(), ::get_userfriendly_name(name, this));
-              }
-            }
-          }
+          this->SetExporterColumnLabels(exporter, rowData);
           exporter->WriteHeader(rowData);
         }
         exporter->WriteData(rowData);
@@ -831,6 +814,86 @@ bool vtkSpreadSheetView::Export(vtkCSVExporter* exporter)
   return true;
 }
 
+//----------------------------------------------------------------------------
+bool vtkSpreadSheetView::ExportLocalRows(vtkCSVExporter* exporter)
+{
+  if (!exporter || !exporter->GetFileName() || !this->Internals->ActiveRepresentation ||
+    !this->TableSelectionMarker->GetNumberOfInputConnections(0))
+  {
+    return false;
+  }
+
+  // the rows of all the blocks on this process, merged in a single table. They
+  // are written in the order of the data, not sorted as in the view.
+  this->TableSelectionMarker->SetFieldAssociation(this->FieldAssociation);
+  vtkNew<vtkPVMergeTables> merger;
+  merger->SetInputConnection(this->TableSelectionMarker->GetOutputPort());
+  merger->Update();
+  vtkTable* table = merger->GetOutput();
+  if (table->GetNumberOfRows() == 0)
+  {
+    return true;
+  }
+
+  const std::string fileName = exporter->GetFileName();
+  vtkMultiProcessController* controller = vtkMultiProcessController::GetGlobalController();
+  if (controller && controller->GetNumberOfProcesses() > 1)
+  {
+    std::ostringstream localName;
+    const std::string path = vtksys::SystemTools::GetFilenamePath(fileName);
+    localName << (path.empty() ? "" : path + "/")
+              << vtksys::SystemTools::GetFilenameWithoutLastExtension(fileName) << "_"
+              << controller->GetLocalProcessId()
+              << vtksys::SystemTools::GetFilenameLastExtension(fileName);
+    exporter->SetFileName(localName.str().c_str());
+  }
+
+  bool status = exporter->Open();
+  if (status)
+  {
+    this->ClearCache();
+    this->Internals->UpdateColumnMetaData(table);
+    vtkFieldData* rowData = table->GetRowData();
+    this->SetExporterColumnLabels(exporter, rowData);
+    exporter->SetTotalNumberOfRows(table->GetNumberOfRows());
+    exporter->WriteHeader(rowData);
+    exporter->WriteData(rowData);
+    exporter->Close();
+    this->ClearCache();
+  }
+  exporter->SetFileName(fileName.c_str());
+  return status;
+}
+
+//----------------------------------------------------------------------------
+void vtkSpreadSheetView::SetExporterColumnLabels(vtkCSVExporter* exporter, vtkFieldData* rowData)
+{
+  // update column labels; this ensures that all the columns have same
+  // names as the spreadsheet view.
+  for (vtkIdType idx = 0; idx < rowData->GetNumberOfArrays(); ++idx)
+  {
+    if (auto array = rowData->GetAbstractArray(idx))
+    {
+      // note: internal columns get nullptr label which the exporter
+      // skips.
+      auto name = array->GetName();
+      auto label = this->GetColumnLabel(name);
+      if (this->IsColumnInternal(name) || this->IsColumnHiddenByName(name) ||
+        this->IsColumnHiddenByLabel(label))
+      {
+        exporter->SetColumnLabel(array->GetName(), nullptr);
+      }
+      else
+      {
+        // we don't use the label since it is same for all components in
+        // the array, instead we only use user friendly version of the
+        // array name.
+        exporter->SetColumnLabel(array->GetName(), ::get_userfriendly_name(name, this));
+      }
+    }
+  }
+}
+
 //***************************************************************************
 // Forwarded to vtkSortedTableStreamer.
 //----------------------------------------------------------------------------
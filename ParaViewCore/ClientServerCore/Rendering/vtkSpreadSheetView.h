@@ -31,6 +31,7 @@
 
 class vtkCSVExporter;
 class vtkClientServerMoveData;
+class vtkFieldData;
 class vtkMarkSelectedRows;
 class vtkReductionFilter;
 class vtkSortedTableStreamer;
@@ -197,6 +198,16 @@ public:
    */
   virtual bool Export(vtkCSVExporter* exporter);
 
+  /**
+   * Export the rows local to this process using the exporter, without
+   * streaming them to the client. When running in parallel, each process
+   * writes its own file, named after the exporter's file name with the rank
+   * of the process appended, e.g. `data_3.csv`. Processes without rows don't
+   * write a file.
+   * \note CallOnAllProcesses
+   */
+  virtual bool ExportLocalRows(vtkCSVExporter* exporter);
+
   /**
    * Allow user to clear the cache if he needs to.
    */
@@ -221,6 +232,12 @@ protected:
 
   vtkTable* FetchBlock(vtkIdType blockindex);
 
+  /**
+   * Sets the exporter labels of the columns in \c rowData, hidden and internal
+   * columns get no label and are not exported.
+   */
+  void SetExporterColumnLabels(vtkCSVExporter* exporter, vtkFieldData* rowData);
+
   bool ShowExtractedSelection;
   bool GenerateCellConnectivity;
   vtkSortedTableStreamer* TableStreamer;
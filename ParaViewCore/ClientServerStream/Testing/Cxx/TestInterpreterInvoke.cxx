@@ -0,0 +1,93 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    TestInterpreterInvoke.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkClientServerInterpreter.h"
+#include "vtkClientServerStream.h"
+#include "vtkNew.h"
+
+#include <cstring>
+#include <iostream>
+
+#define TEST_ASSERT(cond)                                                                          \
+  if (!(cond))                                                                                     \
+  {                                                                                                \
+    std::cerr << "ERROR: failed at line " << __LINE__ << ": " #cond << std::endl;                  \
+    return EXIT_FAILURE;                                                                           \
+  }
+
+namespace
+{
+const vtkClientServerStream* LastMessage = nullptr;
+int LastValue = 0;
+
+// Records the message and replies with twice its value.
+int TestCommand(vtkClientServerInterpreter*, vtkObjectBase*, const char* method,
+  const vtkClientServerStream& msg, vtkClientServerStream& result, void*)
+{
+  if (strcmp(method, "Twice") != 0 || msg.GetNumberOfArguments(0) != 3 ||
+    !msg.GetArgument(0, 2, &LastValue))
+  {
+    return 0;
+  }
+  LastMessage = &msg;
+  result << vtkClientServerStream::Reply << 2 * LastValue << vtkClientServerStream::End;
+  return 1;
+}
+}
+
+int TestInterpreterInvoke(int, char* [])
+{
+  // must match the hashes emitted by the wrapper generator.
+  TEST_ASSERT(vtkClientServerInterpreter::HashMethodName("") == 2166136261u);
+  TEST_ASSERT(vtkClientServerInterpreter::HashMethodName("a") == 0xe40c292cu);
+
+  vtkNew<vtkClientServerInterpreter> interp;
+  interp->AddCommandFunction("vtkObject", TestCommand);
+  TEST_ASSERT(interp->HasCommandFunction("vtkObject"));
+  TEST_ASSERT(!interp->HasCommandFunction("vtkDataObject"));
+
+  vtkNew<vtkObject> obj;
+  vtkClientServerID id(1);
+  vtkClientServerStream assign;
+  assign << vtkClientServerStream::Assign << id << obj.Get() << vtkClientServerStream::End;
+  TEST_ASSERT(interp->ProcessStream(assign));
+
+  // the first message is not copied when only the object is an id.
+  vtkClientServerStream css;
+  css << vtkClientServerStream::Invoke << id << "Twice" << 5 << vtkClientServerStream::End;
+  TEST_ASSERT(interp->ProcessStream(css));
+  TEST_ASSERT(LastMessage == &css && LastValue == 5);
+  int value = 0;
+  TEST_ASSERT(interp->GetLastResult().GetArgument(0, 0, &value) && value == 10);
+
+  // arguments referring to the last result are expanded.
+  css.Reset();
+  css << vtkClientServerStream::Invoke << id << "Twice" << vtkClientServerStream::LastResult
+      << vtkClientServerStream::End;
+  TEST_ASSERT(interp->ProcessStream(css));
+  TEST_ASSERT(LastMessage != &css && LastValue == 10);
+
+  // other messages of a stream are invoked as well.
+  css.Reset();
+  css << vtkClientServerStream::Invoke << id << "Twice" << 1 << vtkClientServerStream::End;
+  css << vtkClientServerStream::Invoke << obj.Get() << "Twice" << 3 << vtkClientServerStream::End;
+  TEST_ASSERT(interp->ProcessStream(css));
+  TEST_ASSERT(LastValue == 3);
+
+  // unknown methods fail.
+  css.Reset();
+  css << vtkClientServerStream::Invoke << id << "Thrice" << 1 << vtkClientServerStream::End;
+  TEST_ASSERT(!interp->ProcessStream(css));
+  return EXIT_SUCCESS;
+}
@@ -24,6 +24,7 @@
 #include <map>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 vtkStandardNewMacro(vtkClientServerInterpreter);
@@ -75,8 +76,64 @@ public:
   NewInstanceFunctionsType NewInstanceFunctions;
   ClassToFunctionMapType ClassToFunctionMap;
   IDToMessageMapType IDToMessageMap;
+
+  // Command functions already found, keyed on the address of the class name.
+  // Class names come from GetClassName() or from string literals in the
+  // generated code, so the same addresses are looked up over and over.
+  typedef std::unordered_map<const char*, ClassToFunctionMapType::const_iterator>
+    ClassNameToFunctionCacheType;
+  ClassNameToFunctionCacheType ClassNameToFunctionCache;
+
+  const CommandFunction* FindCommandFunction(const char* cname)
+  {
+    if (!cname)
+    {
+      return NULL;
+    }
+    ClassNameToFunctionCacheType::const_iterator cached = this->ClassNameToFunctionCache.find(cname);
+    // the name is compared in case the address was reused for another name.
+    if (cached != this->ClassNameToFunctionCache.end() && cached->second->first == cname)
+    {
+      return cached->second->second;
+    }
+    ClassToFunctionMapType::const_iterator iter = this->ClassToFunctionMap.find(cname);
+    if (iter == this->ClassToFunctionMap.end())
+    {
+      return NULL;
+    }
+    this->ClassNameToFunctionCache[cname] = iter;
+    return iter->second;
+  }
 };
 
+namespace
+{
+// Returns the object invoked by the first message of `css` if it can be
+// obtained without expanding the message.
+bool vtkClientServerInterpreterGetInvokedObject(
+  vtkClientServerInterpreter* self, const vtkClientServerStream& css, vtkObjectBase** obj)
+{
+  if (css.GetNumberOfArguments(0) < 2)
+  {
+    return false;
+  }
+  switch (css.GetArgumentType(0, 0))
+  {
+    case vtkClientServerStream::id_value:
+    {
+      vtkClientServerID id;
+      css.GetArgument(0, 0, &id);
+      *obj = self->GetObjectFromID(id, 1);
+      return *obj != NULL;
+    }
+    case vtkClientServerStream::vtk_object_pointer:
+      return css.GetArgument(0, 0, obj) != 0;
+    default:
+      return false;
+  }
+}
+}
+
 //----------------------------------------------------------------------------
 vtkClientServerInterpreter::vtkClientServerInterpreter()
 {
@@ -391,37 +448,49 @@ int vtkClientServerInterpreter::ProcessCommandNew(const vtkClientServerStream& c
 //----------------------------------------------------------------------------
 int vtkClientServerInterpreter::ProcessCommandInvoke(const vtkClientServerStream& css, int midx)
 {
-  // Create a message with all known id_value arguments expanded.
-  vtkClientServerStream msg;
-  if (!this->ExpandMessage(css, midx, 0, msg))
+  // Command functions read the arguments of the first message and get the
+  // object separately. When the message to invoke is the first one and only
+  // its object needs to be resolved, it is used as is instead of being copied.
+  vtkObjectBase* obj = 0;
+  const vtkClientServerStream* msgp = &css;
+  vtkClientServerStream expanded;
+  if (midx != 0 || !vtkClientServerInterpreterGetInvokedObject(this, css, &obj) ||
+    this->NeedsExpansion(css, midx, 1))
   {
-    // ExpandMessage left an error in the LastResultMessage for us.
-    return 0;
+    // Create a message with all known id_value arguments expanded.
+    if (!this->ExpandMessage(css, midx, 0, expanded))
+    {
+      // ExpandMessage left an error in the LastResultMessage for us.
+      return 0;
+    }
+    msgp = &expanded;
   }
+  const vtkClientServerStream& msg = *msgp;
 
   // Now that id_values have been expanded, we do not need the last
   // result.  Reset the result to empty before processing the message.
   this->LastResultMessage->Reset();
 
   // Get the object and method to be invoked.
-  vtkObjectBase* obj;
   const char* method;
-  if (msg.GetNumberOfArguments(0) >= 2 && msg.GetArgument(0, 0, &obj) &&
+  if (msg.GetNumberOfArguments(0) >= 2 && (msgp == &css || msg.GetArgument(0, 0, &obj)) &&
     msg.GetArgument(0, 1, &method))
   {
     // Log the expanded form of the message.
     if (this->LogStream)
     {
       *this->LogStream << "Invoking ";
-      msg.Print(*this->LogStream);
+      msg.PrintMessage(*this->LogStream, 0);
       this->LogStream->flush();
     }
 
     // Find the command function for this object's type.
-    if (obj && this->HasCommandFunction(obj->GetClassName()))
+    const vtkClientServerInterpreterInternals::CommandFunction* n =
+      obj ? this->Internal->FindCommandFunction(obj->GetClassName()) : NULL;
+    if (n)
     {
-      if (this->CallCommandFunction(
-            obj->GetClassName(), obj, method, msg, *this->LastResultMessage))
+      void* ctx = n->Context ? n->Context->Context : 0;
+      if (n->Function(this, obj, method, msg, *this->LastResultMessage, ctx))
       {
         return 1;
       }
@@ -581,6 +650,35 @@ int vtkClientServerInterpreter::ProcessCommandAssign(const vtkClientServerStream
   return 0;
 }
 
+//----------------------------------------------------------------------------
+bool vtkClientServerInterpreter::NeedsExpansion(
+  const vtkClientServerStream& in, int inIndex, int startArgument)
+{
+  for (int a = startArgument; a < in.GetNumberOfArguments(inIndex); ++a)
+  {
+    switch (in.GetArgumentType(inIndex, a))
+    {
+      case vtkClientServerStream::id_value:
+      {
+        // IDs not in the map are left as is by ExpandMessage.
+        vtkClientServerID id;
+        in.GetArgument(inIndex, a, &id);
+        if (this->GetMessageFromID(id))
+        {
+          return true;
+        }
+      }
+      break;
+      case vtkClientServerStream::LastResult:
+      case vtkClientServerStream::stream_value:
+        return true;
+      default:
+        break;
+    }
+  }
+  return false;
+}
+
 //----------------------------------------------------------------------------
 int vtkClientServerInterpreter::ExpandMessage(
   const vtkClientServerStream& in, int inIndex, int startArgument, vtkClientServerStream& out)
@@ -781,28 +879,21 @@ void vtkClientServerInterpreter::AddCommandFunction(const char* cname,
 //----------------------------------------------------------------------------
 bool vtkClientServerInterpreter::HasCommandFunction(const char* cname)
 {
-  if (!cname)
-  {
-    return false;
-  }
-  return (this->Internal->ClassToFunctionMap.count(cname) > 0);
+  return this->Internal->FindCommandFunction(cname) != NULL;
 }
 
 //----------------------------------------------------------------------------
 int vtkClientServerInterpreter::CallCommandFunction(const char* cname, vtkObjectBase* ptr,
   const char* method, const vtkClientServerStream& msg, vtkClientServerStream& result)
 {
-  vtkClientServerInterpreterInternals::ClassToFunctionMapType::const_iterator f =
-    this->Internal->ClassToFunctionMap.find(cname);
-
-  if (f == this->Internal->ClassToFunctionMap.end())
+  const vtkClientServerInterpreterInternals::CommandFunction* n =
+    this->Internal->FindCommandFunction(cname);
+  if (!n)
   {
     vtkErrorMacro("Cannot find command function for \"" << cname << "\".");
     return 1;
   }
 
-  const vtkClientServerInterpreterInternals::CommandFunction* n = f->second;
-
   vtkClientServerCommandFunction function = n->Function;
   void* ctx = n->Context ? n->Context->Context : 0;
   return function(this, ptr, method, msg, result, ctx);
@@ -149,6 +149,21 @@ public:
   int CallCommandFunction(const char* classname, vtkObjectBase* ptr, const char* method,
     const vtkClientServerStream& msg, vtkClientServerStream& result);
 
+  /**
+   * Returns the hash of a method name used by the generated command
+   * functions to dispatch methods. Must match the hash computed by the
+   * ClientServer wrapper generator.
+   */
+  static vtkTypeUInt32 HashMethodName(const char* name)
+  {
+    vtkTypeUInt32 hash = 2166136261u;
+    for (; name && *name; ++name)
+    {
+      hash = (hash ^ static_cast<unsigned char>(*name)) * 16777619u;
+    }
+    return hash;
+  }
+
   /**
    * Add a function used to create new objects.
    */
@@ -204,6 +219,10 @@ protected:
   int ProcessCommandDelete(const vtkClientServerStream& css, int midx);
   int ProcessCommandAssign(const vtkClientServerStream& css, int midx);
 
+  // Returns true if the arguments of a message starting with the given
+  // argument index need to be expanded by ExpandMessage.
+  bool NeedsExpansion(const vtkClientServerStream& in, int inIndex, int startArgument);
+
   // Expand all the id_value arguments of a message starting with the
   // given argument index.
   int ExpandMessage(
@@ -0,0 +1,90 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    TestPVXMLParserCache.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkNew.h"
+#include "vtkPVXMLElement.h"
+#include "vtkPVXMLParser.h"
+
+#include <vtksys/Directory.hxx>
+#include <vtksys/SystemTools.hxx>
+
+#include <cstdlib>
+#include <string>
+
+#define TEST_ASSERT(cond)                                                                          \
+  if (!(cond))                                                                                     \
+  {                                                                                                \
+    cerr << "ERROR: Condition FAILED!! : " << #cond << endl;                                      \
+    return EXIT_FAILURE;                                                                           \
+  }
+
+namespace
+{
+const char* TestXML = "<ServerManagerConfiguration>"
+                      "  <ProxyGroup name=\"sources\">"
+                      "    <SourceProxy name=\"Sphere\" class=\"vtkSphereSource\">"
+                      "      <DoubleVectorProperty name=\"Radius\" default_values=\"0.5\">"
+                      "        <Documentation>Radius of the sphere.</Documentation>"
+                      "      </DoubleVectorProperty>"
+                      "    </SourceProxy>"
+                      "    <SourceProxy name=\"Cone\" class=\"vtkConeSource\" id=\"cone\" />"
+                      "  </ProxyGroup>"
+                      "</ServerManagerConfiguration>";
+}
+
+int TestPVXMLParserCache(int, char* [])
+{
+  const std::string cacheDir =
+    vtksys::SystemTools::GetCurrentWorkingDirectory() + "/TestPVXMLParserCache";
+  vtksys::SystemTools::RemoveADirectory(cacheDir);
+  vtksys::SystemTools::MakeDirectory(cacheDir);
+
+  // First parse writes the snapshot.
+  vtkNew<vtkPVXMLParser> writer;
+  writer->SetCacheDirectory(cacheDir.c_str());
+  TEST_ASSERT(writer->ParseWithCache(TestXML) == 1);
+  vtksys::Directory dir;
+  TEST_ASSERT(dir.Load(cacheDir));
+  TEST_ASSERT(dir.GetNumberOfFiles() == 3); // ".", ".." and the snapshot
+
+  // Second parse restores the tree from it.
+  vtkNew<vtkPVXMLParser> reader;
+  reader->SetCacheDirectory(cacheDir.c_str());
+  reader->SetUpdateCache(false);
+  TEST_ASSERT(reader->ParseWithCache(TestXML) == 1);
+
+  vtkPVXMLElement* expected = writer->GetRootElement();
+  vtkPVXMLElement* restored = reader->GetRootElement();
+  TEST_ASSERT(expected != nullptr && restored != nullptr && expected != restored);
+  TEST_ASSERT(restored->Equals(expected));
+  TEST_ASSERT(restored->FindNestedElementByName("ProxyGroup") != nullptr);
+
+  vtkPVXMLElement* group = restored->FindNestedElementByName("ProxyGroup");
+  TEST_ASSERT(group->GetNumberOfNestedElements() == 2);
+  TEST_ASSERT(group->GetNestedElement(0)->GetParent() == group);
+  TEST_ASSERT(group->FindNestedElement("cone") == group->GetNestedElement(1));
+  TEST_ASSERT(std::string(group->GetNestedElement(0)
+                            ->FindNestedElementByName("DoubleVectorProperty")
+                            ->FindNestedElementByName("Documentation")
+                            ->GetCharacterData()) == "Radius of the sphere.");
+
+  // Different contents must not hit the snapshot.
+  vtkNew<vtkPVXMLParser> other;
+  other->SetCacheDirectory(cacheDir.c_str());
+  TEST_ASSERT(other->ParseWithCache("<Other />") == 1);
+  TEST_ASSERT(std::string(other->GetRootElement()->GetName()) == "Other");
+
+  vtksys::SystemTools::RemoveADirectory(cacheDir);
+  return EXIT_SUCCESS;
+}
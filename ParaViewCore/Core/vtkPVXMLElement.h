@@ -76,6 +76,16 @@ public:
    */
   const char* GetAttributeOrDefault(const char* name, const char* notFound);
 
+  //@{
+  /**
+   * Get the number of attributes of the element and the name/value of the
+   * attribute at the given index, in the order they were added.
+   */
+  unsigned int GetNumberOfAttributes();
+  const char* GetAttributeName(unsigned int index);
+  const char* GetAttributeValue(unsigned int index);
+  //@}
+
   /**
    * Get the character data for the element.
    */
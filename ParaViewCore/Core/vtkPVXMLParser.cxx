@@ -17,10 +17,133 @@
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPVXMLElement.h"
+#include "vtkType.h"
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <random>
 #include <sstream>
+#include <vector>
+
+#include <vtksys/MD5.h>
+#include <vtksys/SystemTools.hxx>
 
 vtkStandardNewMacro(vtkPVXMLParser);
 
+namespace
+{
+// Layout of a snapshot file, all integers being vtkTypeUInt32 in native byte
+// order:
+//   magic, version, byte order mark, content digest (32 hex characters),
+//   number of strings, size of the string blob, string blob (each string is
+//   null terminated), number of records, records.
+// Records describe the elements in pre-order: name, id, number of attributes,
+// (attribute name, attribute value)*, character data, number of children. All
+// strings are stored as indices in the blob, so that the many repeated names
+// and values of a configuration file are stored once.
+const char SNAPSHOT_MAGIC[8] = { 'P', 'V', 'X', 'M', 'L', 'B', 'I', 'N' };
+const vtkTypeUInt32 SNAPSHOT_VERSION = 1;
+const vtkTypeUInt32 SNAPSHOT_BYTE_ORDER_MARK = 0x01020304;
+const size_t SNAPSHOT_DIGEST_LENGTH = 32;
+
+std::string ComputeDigest(const char* contents, size_t length)
+{
+  char hex[SNAPSHOT_DIGEST_LENGTH + 1];
+  vtksysMD5* md5 = vtksysMD5_New();
+  vtksysMD5_Initialize(md5);
+  vtksysMD5_Append(md5, reinterpret_cast<const unsigned char*>(contents), static_cast<int>(length));
+  vtksysMD5_FinalizeHex(md5, hex);
+  vtksysMD5_Delete(md5);
+  hex[SNAPSHOT_DIGEST_LENGTH] = '\0';
+  return std::string(hex);
+}
+
+class vtkSnapshotWriter
+{
+public:
+  std::string Blob;
+  vtkTypeUInt32 NumberOfStrings = 0;
+  std::map<std::string, vtkTypeUInt32> StringOffsets;
+  std::vector<vtkTypeUInt32> Records;
+
+  vtkTypeUInt32 Intern(const char* str)
+  {
+    std::string key(str ? str : "");
+    auto iter = this->StringOffsets.find(key);
+    if (iter != this->StringOffsets.end())
+    {
+      return iter->second;
+    }
+    vtkTypeUInt32 offset = static_cast<vtkTypeUInt32>(this->Blob.size());
+    this->Blob.append(key.c_str(), key.size() + 1);
+    this->StringOffsets[key] = offset;
+    ++this->NumberOfStrings;
+    return offset;
+  }
+
+  void Add(vtkPVXMLElement* element)
+  {
+    this->Records.push_back(this->Intern(element->GetName()));
+    this->Records.push_back(this->Intern(element->GetId()));
+    unsigned int numAttributes = element->GetNumberOfAttributes();
+    this->Records.push_back(numAttributes);
+    for (unsigned int cc = 0; cc < numAttributes; ++cc)
+    {
+      this->Records.push_back(this->Intern(element->GetAttributeName(cc)));
+      this->Records.push_back(this->Intern(element->GetAttributeValue(cc)));
+    }
+    this->Records.push_back(this->Intern(element->GetCharacterData()));
+    unsigned int numChildren = element->GetNumberOfNestedElements();
+    this->Records.push_back(numChildren);
+    for (unsigned int cc = 0; cc < numChildren; ++cc)
+    {
+      this->Add(element->GetNestedElement(cc));
+    }
+  }
+};
+
+void WriteUInt32(std::ostream& os, vtkTypeUInt32 value)
+{
+  os.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+class vtkSnapshotReader
+{
+public:
+  const std::vector<char>& Buffer;
+  size_t Position = 0;
+
+  vtkSnapshotReader(const std::vector<char>& buffer)
+    : Buffer(buffer)
+  {
+  }
+
+  bool Read(vtkTypeUInt32& value)
+  {
+    if (this->Position + sizeof(value) > this->Buffer.size())
+    {
+      return false;
+    }
+    memcpy(&value, &this->Buffer[this->Position], sizeof(value));
+    this->Position += sizeof(value);
+    return true;
+  }
+
+  bool Read(char* data, size_t length)
+  {
+    if (this->Position + length > this->Buffer.size())
+    {
+      return false;
+    }
+    memcpy(data, &this->Buffer[this->Position], length);
+    this->Position += length;
+    return true;
+  }
+};
+}
+
 //----------------------------------------------------------------------------
 vtkPVXMLParser::vtkPVXMLParser()
 {
@@ -31,6 +154,8 @@ vtkPVXMLParser::vtkPVXMLParser()
   this->ElementIdIndex = 0;
   this->RootElement = 0;
   this->SuppressErrorMessages = 0;
+  this->CacheDirectory = nullptr;
+  this->UpdateCache = true;
 }
 
 //----------------------------------------------------------------------------
@@ -46,6 +171,7 @@ vtkPVXMLParser::~vtkPVXMLParser()
   {
     this->RootElement->Delete();
   }
+  this->SetCacheDirectory(nullptr);
 }
 
 //----------------------------------------------------------------------------
@@ -53,6 +179,9 @@ void vtkPVXMLParser::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
   os << indent << "SuppressErrorMessages: " << this->SuppressErrorMessages << "\n";
+  os << indent << "CacheDirectory: " << (this->CacheDirectory ? this->CacheDirectory : "(none)")
+     << "\n";
+  os << indent << "UpdateCache: " << this->UpdateCache << "\n";
 }
 
 //----------------------------------------------------------------------------
@@ -165,6 +294,197 @@ void vtkPVXMLParser::ReportXmlParseError()
   }
 }
 
+//-----------------------------------------------------------------------------
+int vtkPVXMLParser::ParseWithCache(const char* xmlcontents)
+{
+  if (!xmlcontents || !this->CacheDirectory || !*this->CacheDirectory)
+  {
+    return this->Parse(xmlcontents);
+  }
+
+  const std::string digest = ComputeDigest(xmlcontents, strlen(xmlcontents));
+  const std::string filename = std::string(this->CacheDirectory) + "/" + digest + ".pvxmlbin";
+  if (this->ReadSnapshot(filename, digest))
+  {
+    return 1;
+  }
+
+  if (!this->Parse(xmlcontents))
+  {
+    return 0;
+  }
+  if (this->UpdateCache && vtksys::SystemTools::FileIsDirectory(this->CacheDirectory))
+  {
+    // Write to a unique temporary file and rename it so that concurrent
+    // readers never see a partially written snapshot.
+    std::ostringstream tmpname;
+    tmpname << filename << "." << std::random_device()() << ".tmp";
+    if (!this->WriteSnapshot(tmpname.str(), digest) ||
+      !vtksys::SystemTools::RenameFile(tmpname.str().c_str(), filename.c_str()))
+    {
+      vtksys::SystemTools::RemoveFile(tmpname.str());
+    }
+  }
+  return 1;
+}
+
+//-----------------------------------------------------------------------------
+bool vtkPVXMLParser::WriteSnapshot(const std::string& filename, const std::string& digest)
+{
+  if (!this->RootElement)
+  {
+    return false;
+  }
+
+  vtkSnapshotWriter writer;
+  writer.Add(this->RootElement);
+
+  std::ofstream os(filename.c_str(), std::ios::out | std::ios::binary);
+  if (!os)
+  {
+    return false;
+  }
+  os.write(SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+  WriteUInt32(os, SNAPSHOT_VERSION);
+  WriteUInt32(os, SNAPSHOT_BYTE_ORDER_MARK);
+  os.write(digest.c_str(), SNAPSHOT_DIGEST_LENGTH);
+  WriteUInt32(os, writer.NumberOfStrings);
+  WriteUInt32(os, static_cast<vtkTypeUInt32>(writer.Blob.size()));
+  os.write(writer.Blob.c_str(), writer.Blob.size());
+  WriteUInt32(os, static_cast<vtkTypeUInt32>(writer.Records.size()));
+  os.write(reinterpret_cast<const char*>(writer.Records.data()),
+    writer.Records.size() * sizeof(vtkTypeUInt32));
+  os.close();
+  return !os.fail();
+}
+
+//-----------------------------------------------------------------------------
+bool vtkPVXMLParser::ReadSnapshot(const std::string& filename, const std::string& digest)
+{
+  std::ifstream is(filename.c_str(), std::ios::in | std::ios::binary);
+  if (!is)
+  {
+    return false;
+  }
+  std::vector<char> buffer(
+    (std::istreambuf_iterator<char>(is)), std::istreambuf_iterator<char>());
+  vtkSnapshotReader reader(buffer);
+
+  char magic[sizeof(SNAPSHOT_MAGIC)];
+  char fileDigest[SNAPSHOT_DIGEST_LENGTH];
+  vtkTypeUInt32 version, byteOrderMark, numberOfStrings, blobSize, numberOfRecords;
+  if (!reader.Read(magic, sizeof(magic)) ||
+    memcmp(magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC)) != 0 || !reader.Read(version) ||
+    version != SNAPSHOT_VERSION || !reader.Read(byteOrderMark) ||
+    byteOrderMark != SNAPSHOT_BYTE_ORDER_MARK || !reader.Read(fileDigest, sizeof(fileDigest)) ||
+    digest.compare(0, SNAPSHOT_DIGEST_LENGTH, fileDigest, SNAPSHOT_DIGEST_LENGTH) != 0 ||
+    !reader.Read(numberOfStrings) || !reader.Read(blobSize))
+  {
+    return false;
+  }
+  const size_t blobStart = reader.Position;
+  if (blobSize == 0 || blobStart + blobSize > buffer.size() ||
+    buffer[blobStart + blobSize - 1] != '\0')
+  {
+    return false;
+  }
+  reader.Position += blobSize;
+  if (!reader.Read(numberOfRecords) ||
+    reader.Position + numberOfRecords * sizeof(vtkTypeUInt32) != buffer.size())
+  {
+    return false;
+  }
+
+  // Strings point directly into the loaded buffer.
+  auto getString = [&](vtkTypeUInt32 offset, const char*& str) {
+    if (offset >= blobSize)
+    {
+      return false;
+    }
+    str = &buffer[blobStart + offset];
+    return true;
+  };
+
+  // Rebuild the tree in pre-order using an explicit stack of the elements
+  // still expecting children.
+  std::vector<std::pair<vtkSmartPointer<vtkPVXMLElement>, vtkTypeUInt32> > stack;
+  vtkSmartPointer<vtkPVXMLElement> root;
+  vtkTypeUInt32 value;
+  const char* str;
+  while (reader.Position < buffer.size())
+  {
+    vtkNew<vtkPVXMLElement> element;
+    if (!reader.Read(value) || !getString(value, str))
+    {
+      return false;
+    }
+    element->SetName(str);
+    if (!reader.Read(value) || !getString(value, str))
+    {
+      return false;
+    }
+    element->SetId(str);
+    vtkTypeUInt32 numAttributes;
+    if (!reader.Read(numAttributes))
+    {
+      return false;
+    }
+    for (vtkTypeUInt32 cc = 0; cc < numAttributes; ++cc)
+    {
+      const char* attrName;
+      if (!reader.Read(value) || !getString(value, attrName) || !reader.Read(value) ||
+        !getString(value, str))
+      {
+        return false;
+      }
+      element->AddAttribute(attrName, str);
+    }
+    if (!reader.Read(value) || !getString(value, str))
+    {
+      return false;
+    }
+    element->AddCharacterData(str, static_cast<int>(strlen(str)));
+    vtkTypeUInt32 numChildren;
+    if (!reader.Read(numChildren))
+    {
+      return false;
+    }
+
+    if (stack.empty())
+    {
+      if (root)
+      {
+        // more than one root element.
+        return false;
+      }
+      root = element.GetPointer();
+    }
+    else
+    {
+      stack.back().first->AddNestedElement(element);
+      --stack.back().second;
+    }
+    stack.push_back(std::make_pair(vtkSmartPointer<vtkPVXMLElement>(element.GetPointer()),
+      numChildren));
+    while (!stack.empty() && stack.back().second == 0)
+    {
+      stack.pop_back();
+    }
+  }
+  if (!root || !stack.empty())
+  {
+    return false;
+  }
+
+  if (this->RootElement)
+  {
+    this->RootElement->Delete();
+  }
+  this->RootElement = root;
+  this->RootElement->Register(nullptr);
+  return true;
+}
+
 //-----------------------------------------------------------------------------
 vtkSmartPointer<vtkPVXMLElement> vtkPVXMLParser::ParseXML(
   const char* xmlcontents, bool suppress_errors)
@@ -25,6 +25,7 @@
 #include "vtkPVCoreModule.h" // needed for export macro
 #include "vtkSmartPointer.h" // needed for vtkSmartPointer.
 #include "vtkXMLParser.h"
+#include <string> // needed for std::string
 
 class vtkPVXMLElement;
 
@@ -57,6 +58,35 @@ public:
   vtkBooleanMacro(SuppressErrorMessages, int);
   //@}
 
+  //@{
+  /**
+   * Directory used by ParseWithCache() to store binary snapshots of parsed
+   * documents. Not set by default, in which case no snapshot is used.
+   */
+  vtkSetStringMacro(CacheDirectory);
+  vtkGetStringMacro(CacheDirectory);
+  //@}
+
+  //@{
+  /**
+   * If on (default), ParseWithCache() writes a snapshot when none is found for
+   * the parsed contents. Turn off on processes that should only read the
+   * snapshots, e.g. all but one rank of a parallel job.
+   */
+  vtkSetMacro(UpdateCache, bool);
+  vtkGetMacro(UpdateCache, bool);
+  vtkBooleanMacro(UpdateCache, bool);
+  //@}
+
+  /**
+   * Parse the given XML contents. When CacheDirectory is set, the element tree
+   * is restored from the binary snapshot matching the MD5 hash of the contents
+   * instead, if one exists. Otherwise the contents are parsed and, if
+   * UpdateCache is on, a snapshot is written for next time. Returns 1 on
+   * success, 0 otherwise.
+   */
+  int ParseWithCache(const char* xmlcontents);
+
   /**
    * Convenience method to parse XML contents. Will return NULL is the
    * xmlcontents cannot be parsed.
@@ -69,6 +99,14 @@ protected:
   ~vtkPVXMLParser() override;
 
   int SuppressErrorMessages;
+  char* CacheDirectory;
+  bool UpdateCache;
+
+  /**
+   * Read/write the binary snapshot of the element tree in the given file.
+   */
+  bool ReadSnapshot(const std::string& filename, const std::string& digest);
+  bool WriteSnapshot(const std::string& filename, const std::string& digest);
 
   void StartElement(const char* name, const char** atts) override;
   void EndElement(const char* name) override;
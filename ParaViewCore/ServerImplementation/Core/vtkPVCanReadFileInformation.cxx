@@ -0,0 +1,206 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    vtkPVCanReadFileInformation.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkPVCanReadFileInformation.h"
+
+#include "vtkClientServerInterpreter.h"
+#include "vtkClientServerInterpreterInitializer.h"
+#include "vtkClientServerStream.h"
+#include "vtkMultiProcessStream.h"
+#include "vtkObjectFactory.h"
+#include "vtkPVFileInformationHelper.h"
+#include "vtkSmartPointer.h"
+
+#include <map>
+#include <vtksys/SystemTools.hxx>
+
+vtkStandardNewMacro(vtkPVCanReadFileInformation);
+//----------------------------------------------------------------------------
+vtkPVCanReadFileInformation::vtkPVCanReadFileInformation()
+{
+  this->RootOnly = 1;
+  this->FileName = NULL;
+  this->IsDirectory = false;
+}
+
+//----------------------------------------------------------------------------
+vtkPVCanReadFileInformation::~vtkPVCanReadFileInformation()
+{
+  this->SetFileName(NULL);
+}
+
+//----------------------------------------------------------------------------
+void vtkPVCanReadFileInformation::AddReader(const char* classname, bool is_directory)
+{
+  vtkReader reader = { classname ? classname : "", is_directory, false };
+  this->Readers.push_back(reader);
+}
+
+//----------------------------------------------------------------------------
+void vtkPVCanReadFileInformation::RemoveAllReaders()
+{
+  this->Readers.clear();
+}
+
+//----------------------------------------------------------------------------
+bool vtkPVCanReadFileInformation::GetCanReadFile(unsigned int index) const
+{
+  return index < this->Readers.size() ? this->Readers[index].CanReadFile : false;
+}
+
+//----------------------------------------------------------------------------
+void vtkPVCanReadFileInformation::CopyFromObject(vtkObject*)
+{
+  if (!this->FileName)
+  {
+    return;
+  }
+
+  const std::string localName = vtkPVFileInformationHelper::Utf8ToLocalWin32(this->FileName);
+  this->IsDirectory = vtksys::SystemTools::FileIsDirectory(localName);
+
+  vtkClientServerInterpreter* interpreter =
+    vtkClientServerInterpreterInitializer::GetGlobalInterpreter();
+  int warnings = interpreter->GetGlobalWarningDisplay();
+  interpreter->SetGlobalWarningDisplay(0);
+
+  // Only the reader classes are instantiated, once each, the proxies of the
+  // candidate readers are never created.
+  std::map<std::string, vtkSmartPointer<vtkObjectBase> > instances;
+  for (auto& reader : this->Readers)
+  {
+    reader.CanReadFile = false;
+    if (reader.IsDirectory != this->IsDirectory || reader.ClassName.empty())
+    {
+      continue;
+    }
+    auto iter = instances.find(reader.ClassName);
+    if (iter == instances.end())
+    {
+      vtkSmartPointer<vtkObjectBase> instance;
+      instance.TakeReference(interpreter->NewInstance(reader.ClassName.c_str()));
+      iter = instances.insert(std::make_pair(reader.ClassName, instance)).first;
+    }
+    vtkObjectBase* object = iter->second;
+    if (!object)
+    {
+      continue;
+    }
+
+    vtkClientServerStream stream;
+    stream << vtkClientServerStream::Invoke << object << "CanReadFile" << localName.c_str()
+           << vtkClientServerStream::End;
+    // Like vtkPVFilePathEncodingHelper, assume the reader can read the file if
+    // it has no CanReadFile method.
+    int canRead = 1;
+    interpreter->ProcessStream(stream);
+    interpreter->GetLastResult().GetArgument(0, 0, &canRead);
+    reader.CanReadFile = (canRead != 0);
+  }
+  interpreter->SetGlobalWarningDisplay(warnings);
+}
+
+//----------------------------------------------------------------------------
+void vtkPVCanReadFileInformation::CopyToStream(vtkClientServerStream* stream)
+{
+  // Only the indices of the readers that can read the file are sent.
+  std::vector<unsigned int> readable;
+  for (size_t cc = 0; cc < this->Readers.size(); ++cc)
+  {
+    if (this->Readers[cc].CanReadFile)
+    {
+      readable.push_back(static_cast<unsigned int>(cc));
+    }
+  }
+  stream->Reset();
+  *stream << vtkClientServerStream::Reply << (this->IsDirectory ? 1 : 0)
+          << static_cast<unsigned int>(readable.size());
+  for (unsigned int index : readable)
+  {
+    *stream << index;
+  }
+  *stream << vtkClientServerStream::End;
+}
+
+//----------------------------------------------------------------------------
+void vtkPVCanReadFileInformation::CopyFromStream(const vtkClientServerStream* stream)
+{
+  int offset = 0;
+  int is_dir = 0;
+  unsigned int count = 0;
+  if (!stream->GetArgument(0, offset++, &is_dir) || !stream->GetArgument(0, offset++, &count) ||
+    count > this->Readers.size())
+  {
+    vtkErrorMacro("Error parsing stream.");
+    return;
+  }
+  this->IsDirectory = (is_dir != 0);
+  for (auto& reader : this->Readers)
+  {
+    reader.CanReadFile = false;
+  }
+  for (unsigned int cc = 0; cc < count; ++cc)
+  {
+    unsigned int index = 0;
+    if (!stream->GetArgument(0, offset++, &index) || index >= this->Readers.size())
+    {
+      vtkErrorMacro("Error parsing stream.");
+      return;
+    }
+    this->Readers[index].CanReadFile = true;
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkPVCanReadFileInformation::CopyParametersToStream(vtkMultiProcessStream& str)
+{
+  str << 831017 << std::string(this->FileName ? this->FileName : "")
+      << static_cast<unsigned int>(this->Readers.size());
+  for (const auto& reader : this->Readers)
+  {
+    str << reader.ClassName << (reader.IsDirectory ? 1 : 0);
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkPVCanReadFileInformation::CopyParametersFromStream(vtkMultiProcessStream& str)
+{
+  int magic_number;
+  std::string filename;
+  unsigned int count;
+  str >> magic_number >> filename >> count;
+  if (magic_number != 831017)
+  {
+    vtkErrorMacro("Magic number mismatch.");
+    return;
+  }
+  this->SetFileName(filename.empty() ? NULL : filename.c_str());
+  this->Readers.clear();
+  for (unsigned int cc = 0; cc < count; ++cc)
+  {
+    std::string classname;
+    int is_dir;
+    str >> classname >> is_dir;
+    this->AddReader(classname.c_str(), is_dir != 0);
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkPVCanReadFileInformation::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "FileName: " << (this->FileName ? this->FileName : "(none)") << endl;
+  os << indent << "IsDirectory: " << this->IsDirectory << endl;
+  os << indent << "NumberOfReaders: " << this->Readers.size() << endl;
+}
@@ -0,0 +1,128 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    vtkPVCanReadFileInformation.h
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkPVCanReadFileInformation
+ * @brief   checks whether several readers can read a file at once.
+ *
+ * vtkPVCanReadFileInformation is used by vtkSMReaderFactory to test all the
+ * candidate readers for a file in a single request to the server, without
+ * creating their proxies. For each reader, identified by the name of its VTK
+ * class, the server checks that the file kind (directory or not) matches what
+ * the reader expects, then creates an instance of the class and calls
+ * `CanReadFile` on it. The readers that can read the file are sent back, in the
+ * order they were added. The information is gathered from the root node only.
+*/
+
+#ifndef vtkPVCanReadFileInformation_h
+#define vtkPVCanReadFileInformation_h
+
+#include "vtkPVInformation.h"
+#include "vtkPVServerImplementationCoreModule.h" //needed for exports
+
+#include <string> // for std::string
+#include <vector> // for std::vector
+
+class VTKPVSERVERIMPLEMENTATIONCORE_EXPORT vtkPVCanReadFileInformation : public vtkPVInformation
+{
+public:
+  static vtkPVCanReadFileInformation* New();
+  vtkTypeMacro(vtkPVCanReadFileInformation, vtkPVInformation);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  //@{
+  /**
+   * Set/get the file to test, utf8 encoded.
+   */
+  vtkSetStringMacro(FileName);
+  vtkGetStringMacro(FileName);
+  //@}
+
+  /**
+   * Add a reader to test. \c classname is the VTK class of the reader, i.e.
+   * the class implementing `CanReadFile`. \c is_directory tells whether the
+   * reader expects a directory rather than a file.
+   */
+  void AddReader(const char* classname, bool is_directory);
+
+  /**
+   * Remove all the readers and results.
+   */
+  void RemoveAllReaders();
+
+  /**
+   * Returns the number of readers added with AddReader().
+   */
+  unsigned int GetNumberOfReaders() const
+  {
+    return static_cast<unsigned int>(this->Readers.size());
+  }
+
+  /**
+   * After the information has been gathered, returns whether the reader at the
+   * given index, in the order they were added, can read the file.
+   */
+  bool GetCanReadFile(unsigned int index) const;
+
+  /**
+   * After the information has been gathered, returns whether FileName is a
+   * directory.
+   */
+  vtkGetMacro(IsDirectory, bool);
+
+  //@{
+  /**
+   * Transfer information about a single object into this object.
+   */
+  void CopyFromObject(vtkObject*) override;
+  //@}
+
+  //@{
+  /**
+   * Manage a serialized version of the information.
+   */
+  void CopyToStream(vtkClientServerStream*) override;
+  void CopyFromStream(const vtkClientServerStream*) override;
+  //@}
+
+  //@{
+  /**
+   * Serialize/Deserialize the parameters that control how/what information is
+   * gathered.
+   */
+  void CopyParametersToStream(vtkMultiProcessStream&) override;
+  void CopyParametersFromStream(vtkMultiProcessStream&) override;
+  //@}
+
+protected:
+  vtkPVCanReadFileInformation();
+  ~vtkPVCanReadFileInformation() override;
+
+  char* FileName;
+  bool IsDirectory;
+
+  struct vtkReader
+  {
+    std::string ClassName;
+    bool IsDirectory;
+    bool CanReadFile;
+  };
+  std::vector<vtkReader> Readers;
+
+private:
+  vtkPVCanReadFileInformation(const vtkPVCanReadFileInformation&) = delete;
+  void operator=(const vtkPVCanReadFileInformation&) = delete;
+};
+
+#endif
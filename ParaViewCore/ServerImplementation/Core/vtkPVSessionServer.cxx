@@ -537,22 +537,21 @@ void vtkPVSessionServer::OnClientServerMessageRMI(void* message, int message_len
     {
       std::string string;
       stream >> string;
-      vtkSMMessage msg;
-      msg.ParseFromString(string);
-
-      //      cout << "=================================" << endl;
-      //      msg.PrintDebugString();
-      //      cout << "=================================" << endl;
+      this->PushStateFromClient(string);
+    }
+    break;
 
-      // Do we skip the processing ?
-      if (!this->Internal->StoreShareOnly(&msg))
+    case vtkPVSessionServer::PUSH_BATCH:
+    {
+      // Messages are applied in the order the client issued them.
+      int count = 0;
+      stream >> count;
+      std::string string;
+      for (int cc = 0; cc < count; ++cc)
       {
-        this->PushState(&msg);
+        stream >> string;
+        this->PushStateFromClient(string);
       }
-
-      // Notify when ProxyManager state has changed
-      // or any other state change
-      this->NotifyOtherClients(&msg);
     }
     break;
 
@@ -625,6 +624,23 @@ void vtkPVSessionServer::OnClientServerMessageRMI(void* message, int message_len
   }
 }
 
+//----------------------------------------------------------------------------
+void vtkPVSessionServer::PushStateFromClient(const std::string& serializedMessage)
+{
+  vtkSMMessage msg;
+  msg.ParseFromString(serializedMessage);
+
+  // Do we skip the processing ?
+  if (!this->Internal->StoreShareOnly(&msg))
+  {
+    this->PushState(&msg);
+  }
+
+  // Notify when ProxyManager state has changed
+  // or any other state change
+  this->NotifyOtherClients(&msg);
+}
+
 //----------------------------------------------------------------------------
 void vtkPVSessionServer::SendLastResultToClient()
 {
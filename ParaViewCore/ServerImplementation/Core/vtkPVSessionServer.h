@@ -27,6 +27,7 @@
 
 #include "vtkPVServerImplementationCoreModule.h" //needed for exports
 #include "vtkPVSessionBase.h"
+#include <string>                                // for std::string
 
 class vtkMultiProcessController;
 class vtkMultiProcessStream;
@@ -83,6 +84,7 @@ public:
     REGISTER_SI = 16,
     UNREGISTER_SI = 17,
     LAST_RESULT = 18,
+    PUSH_BATCH = 19,
     SERVER_NOTIFICATION_MESSAGE_RMI = 55624,
     CLIENT_SERVER_MESSAGE_RMI = 55625,
     CLOSE_SESSION = 55626,
@@ -151,6 +153,12 @@ protected:
    */
   void SendLastResultToClient();
 
+  /**
+   * Applies a serialized state message pushed by the client, either on its own
+   * or as part of a batch.
+   */
+  void PushStateFromClient(const std::string& serializedMessage);
+
   vtkMPIMToNSocketConnection* MPIMToNSocketConnection;
 
   bool MultipleConnection;
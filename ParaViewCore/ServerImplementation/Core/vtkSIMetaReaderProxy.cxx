@@ -17,6 +17,7 @@
 #include "vtkAlgorithm.h"
 #include "vtkClientServerInterpreter.h"
 #include "vtkClientServerStream.h"
+#include "vtkCommand.h"
 #include "vtkInformation.h"
 #include "vtkMultiProcessController.h"
 #include "vtkObjectFactory.h"
@@ -61,6 +62,18 @@ void vtkSIMetaReaderProxy::OnCreateVTKObjects()
     stream << vtkClientServerStream::Invoke << this->GetVTKObject() << "SetFileNameMethod"
            << this->GetFileNameMethod() << vtkClientServerStream::End;
   }
+
+  // Optional second reader used to read time steps ahead on a background
+  // thread. It must not report progress from that thread.
+  vtkSIProxy* prefetchReaderSI = this->GetSubSIProxy("PrefetchReader");
+  vtkObject* prefetchReader =
+    prefetchReaderSI ? vtkObject::SafeDownCast(prefetchReaderSI->GetVTKObject()) : nullptr;
+  if (prefetchReader)
+  {
+    prefetchReader->RemoveObservers(vtkCommand::ProgressEvent);
+    stream << vtkClientServerStream::Invoke << this->GetVTKObject() << "SetPrefetchReader"
+           << prefetchReader << vtkClientServerStream::End;
+  }
   this->Interpreter->ProcessStream(stream);
 }
 
@@ -42,6 +42,7 @@
 #include <vector>
 
 #include <vtksys/RegularExpression.hxx>
+#include <vtksys/SystemTools.hxx>
 
 //****************************************************************************/
 //                    Internal Classes and typedefs
@@ -766,7 +767,13 @@ bool vtkSIProxyDefinitionManager::LoadConfigurationXMLFromString(
   const char* xmlContent, bool attachHints)
 {
   vtkNew<vtkPVXMLParser> parser;
-  return (parser->Parse(xmlContent) != 0) &&
+  if (const char* cacheDir = vtksys::SystemTools::GetEnv("PV_XML_CACHE_DIR"))
+  {
+    vtkProcessModule* pm = vtkProcessModule::GetProcessModule();
+    parser->SetCacheDirectory(cacheDir);
+    parser->SetUpdateCache(pm == nullptr || pm->GetPartitionId() == 0);
+  }
+  return (parser->ParseWithCache(xmlContent) != 0) &&
     this->LoadConfigurationXML(parser->GetRootElement(), attachHints);
 }
 
@@ -152,6 +152,10 @@ public:
   //@{
   /**
    * Loads server-manager configuration xml.
+   * When the PV_XML_CACHE_DIR environment variable names a directory,
+   * LoadConfigurationXMLFromString() keeps binary snapshots of the parsed
+   * configurations there (see vtkPVXMLParser::ParseWithCache()) so that later
+   * runs skip the XML parsing. Only the root process writes the snapshots.
    */
   bool LoadConfigurationXML(vtkPVXMLElement* root);
   bool LoadConfigurationXMLFromString(const char* xmlContent);
@@ -26,6 +26,7 @@
 #include "vtkPVCompositeDataPipeline.h"
 #include "vtkPVInstantiator.h"
 #include "vtkPVLogger.h"
+#include "vtkPVPipelineProfiler.h"
 #include "vtkPVPostFilter.h"
 #include "vtkPVXMLElement.h"
 #include "vtkPolyData.h"
@@ -37,6 +38,7 @@
 
 #include <cassert>
 #include <sstream>
+#include <string>
 #include <vector>
 
 //*****************************************************************************
@@ -299,6 +301,22 @@ void vtkSISourceProxy::MarkStartEvent()
   filterName << "Execute " << this->GetLogNameOrDefault() << " id: " << this->GetGlobalID();
   vtkTimerLog::MarkStartEvent(filterName.str().c_str());
 
+  if (vtkPVPipelineProfiler::GetEnabled())
+  {
+    // label the algorithm and its post filters with the proxy name in the
+    // profiler records.
+    vtkAlgorithm* algo = vtkAlgorithm::SafeDownCast(this->GetVTKObject());
+    algo->GetInformation()->Set(vtkPVPipelineProfiler::LABEL(), this->GetLogNameOrDefault());
+    const std::string postFilterLabel = std::string(this->GetLogNameOrDefault()) + " (PostFilter)";
+    for (const auto& postFilter : this->Internals->PostFilters)
+    {
+      if (postFilter)
+      {
+        postFilter->GetInformation()->Set(vtkPVPipelineProfiler::LABEL(), postFilterLabel.c_str());
+      }
+    }
+  }
+
   vtkVLogStartScopeF(PARAVIEW_LOG_PIPELINE_VERBOSITY(), vtkLogIdentifier(this), "%s: execute",
     this->GetLogNameOrDefault());
 }
@@ -0,0 +1,130 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    TestFileSeriesPrefetch.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkAlgorithm.h"
+#include "vtkInitializationHelper.h"
+#include "vtkNew.h"
+#include "vtkPointSet.h"
+#include "vtkPoints.h"
+#include "vtkPolyDataWriter.h"
+#include "vtkProcessModule.h"
+#include "vtkSMParaViewPipelineController.h"
+#include "vtkSMPropertyHelper.h"
+#include "vtkSMSession.h"
+#include "vtkSMSessionProxyManager.h"
+#include "vtkSMSourceProxy.h"
+#include "vtkSmartPointer.h"
+#include "vtkSphereSource.h"
+#include "vtkTestUtilities.h"
+
+#include <string>
+
+#define TEST_ASSERT(x)                                                                             \
+  if (!(x))                                                                                        \
+  {                                                                                                \
+    cerr << "ERROR: failed at " << __LINE__ << "!" << endl;                                        \
+    return EXIT_FAILURE;                                                                           \
+  }
+
+namespace
+{
+vtkDataArray* GetPoints(vtkAlgorithm* algorithm)
+{
+  vtkPointSet* output = vtkPointSet::SafeDownCast(algorithm->GetOutputDataObject(0));
+  return output && output->GetPoints() ? output->GetPoints()->GetData() : nullptr;
+}
+
+vtkIdType GetNumberOfPoints(vtkAlgorithm* algorithm)
+{
+  vtkPointSet* output = vtkPointSet::SafeDownCast(algorithm->GetOutputDataObject(0));
+  return output ? output->GetNumberOfPoints() : -1;
+}
+}
+
+int TestFileSeriesPrefetch(int argc, char* argv[])
+{
+  char* tempDir =
+    vtkTestUtilities::GetArgOrEnvOrDefault("-T", argc, argv, "VTK_TEMP_DIR", "Testing/Temporary");
+  if (!tempDir)
+  {
+    cerr << "Could not determine temporary directory.\n";
+    return EXIT_FAILURE;
+  }
+  const std::string prefix = std::string(tempDir) + "/TestFileSeriesPrefetch_";
+  delete[] tempDir;
+
+  // Two steps with a different number of points.
+  vtkIdType numberOfPoints[2];
+  std::string files[2];
+  for (int cc = 0; cc < 2; ++cc)
+  {
+    vtkNew<vtkSphereSource> sphere;
+    sphere->SetThetaResolution(8 * (cc + 1));
+    sphere->Update();
+    numberOfPoints[cc] = sphere->GetOutput()->GetNumberOfPoints();
+    files[cc] = prefix + std::to_string(cc) + ".vtk";
+    vtkNew<vtkPolyDataWriter> writer;
+    writer->SetInputConnection(sphere->GetOutputPort());
+    writer->SetFileName(files[cc].c_str());
+    TEST_ASSERT(writer->Write() == 1);
+  }
+
+  vtkInitializationHelper::Initialize(argv[0], vtkProcessModule::PROCESS_CLIENT);
+  vtkNew<vtkSMParaViewPipelineController> controller;
+  vtkSMSession* session = vtkSMSession::New();
+  vtkSMSessionProxyManager* pxm = session->GetSessionProxyManager();
+  TEST_ASSERT(controller->InitializeSession(session));
+
+  {
+    vtkSmartPointer<vtkSMSourceProxy> reader;
+    reader.TakeReference(
+      vtkSMSourceProxy::SafeDownCast(pxm->NewProxy("sources", "LegacyVTKFileReader")));
+    TEST_ASSERT(reader != nullptr);
+    controller->PreInitializeProxy(reader);
+    vtkSMPropertyHelper fileNames(reader, "FileNames");
+    fileNames.Set(0, files[0].c_str());
+    fileNames.Set(1, files[1].c_str());
+    vtkSMPropertyHelper(reader, "PrefetchNextStep").Set(1);
+    reader->UpdateVTKObjects();
+    controller->PostInitializeProxy(reader);
+
+    vtkAlgorithm* fileSeries = vtkAlgorithm::SafeDownCast(reader->GetClientSideObject());
+    vtkAlgorithm* prefetchReader =
+      vtkAlgorithm::SafeDownCast(reader->GetSubProxy("PrefetchReader")->GetClientSideObject());
+    TEST_ASSERT(fileSeries && prefetchReader);
+
+    // Reading the first step reads the second one ahead.
+    reader->UpdatePipeline(0.0);
+    TEST_ASSERT(GetNumberOfPoints(fileSeries) == numberOfPoints[0]);
+    TEST_ASSERT(GetPoints(fileSeries) != GetPoints(prefetchReader));
+
+    // The second step is the output of the prefetch reader, the file is not
+    // read again.
+    reader->UpdatePipeline(1.0);
+    TEST_ASSERT(GetNumberOfPoints(fileSeries) == numberOfPoints[1]);
+    TEST_ASSERT(GetNumberOfPoints(prefetchReader) == numberOfPoints[1]);
+    TEST_ASSERT(GetPoints(fileSeries) != nullptr);
+    TEST_ASSERT(GetPoints(fileSeries) == GetPoints(prefetchReader));
+
+    // Nothing is read ahead when going back to the first step, it is read
+    // again by the internal reader.
+    reader->UpdatePipeline(0.0);
+    TEST_ASSERT(GetNumberOfPoints(fileSeries) == numberOfPoints[0]);
+    TEST_ASSERT(GetPoints(fileSeries) != GetPoints(prefetchReader));
+  }
+
+  session->Delete();
+  vtkInitializationHelper::Finalize();
+  return EXIT_SUCCESS;
+}
@@ -28,10 +28,28 @@
 #include "vtkSMCompoundSourceProxy.h"
 #include "vtkSMMessage.h"
 #include "vtkSMSession.h"
+#include "vtkSmartPointer.h"
 #include "vtkTimerLog.h"
 
+#include <map>
 #include <sstream>
 
+class vtkSMOutputPort::vtkInternals
+{
+public:
+  // Complete data information gathered for individual nodes of a composite
+  // dataset, indexed by flat index, when SummaryOnly is set.
+  std::map<unsigned int, vtkSmartPointer<vtkPVDataInformation> > CompositeIndexInformation;
+  // Complete data information for the whole dataset, when SummaryOnly is set.
+  vtkSmartPointer<vtkPVDataInformation> CompleteInformation;
+
+  void Clear()
+  {
+    this->CompositeIndexInformation.clear();
+    this->CompleteInformation = nullptr;
+  }
+};
+
 //----------------------------------------------------------------------------
 vtkStandardNewMacro(vtkSMOutputPort);
 
@@ -48,6 +66,8 @@ vtkSMOutputPort::vtkSMOutputPort()
   this->SourceProxy = 0;
   this->CompoundSourceProxy = 0;
   this->ObjectsCreated = 1;
+  this->SummaryOnly = false;
+  this->Internals = new vtkInternals();
 }
 
 //----------------------------------------------------------------------------
@@ -57,6 +77,7 @@ vtkSMOutputPort::~vtkSMOutputPort()
   this->ClassNameInformation->Delete();
   this->DataInformation->Delete();
   this->TemporalDataInformation->Delete();
+  delete this->Internals;
 }
 
 //----------------------------------------------------------------------------
@@ -73,6 +94,72 @@ vtkPVDataInformation* vtkSMOutputPort::GetDataInformation()
   return this->DataInformation;
 }
 
+//----------------------------------------------------------------------------
+void vtkSMOutputPort::SetSummaryOnly(bool summaryOnly)
+{
+  if (this->SummaryOnly != summaryOnly)
+  {
+    this->SummaryOnly = summaryOnly;
+    this->DataInformationValid = false;
+    this->Internals->Clear();
+    this->Modified();
+  }
+}
+
+//----------------------------------------------------------------------------
+vtkPVDataInformation* vtkSMOutputPort::GetDataInformationForCompositeIndex(unsigned int index)
+{
+  vtkPVDataInformation* dataInfo = this->GetDataInformation();
+  if (!dataInfo->GetSummaryOnly())
+  {
+    return dataInfo->GetDataInformationForCompositeIndex(static_cast<int>(index));
+  }
+  if (this->Internals->CompleteInformation)
+  {
+    return this->Internals->CompleteInformation->GetDataInformationForCompositeIndex(
+      static_cast<int>(index));
+  }
+  if (index == 0 || !dataInfo->GetCompositeDataClassName())
+  {
+    // nothing was left out of the summary for the root.
+    return dataInfo;
+  }
+
+  vtkSmartPointer<vtkPVDataInformation>& info = this->Internals->CompositeIndexInformation[index];
+  if (!info)
+  {
+    info = vtkSmartPointer<vtkPVDataInformation>::New();
+    info->SetPortNumber(this->PortIndex);
+    info->SetCompositeIndex(index);
+    info->SetSummaryOnly(true);
+    this->SourceProxy->GetSession()->PrepareProgress();
+    this->SourceProxy->GatherInformation(info);
+    this->SourceProxy->GetSession()->CleanupPendingProgress();
+  }
+  return info;
+}
+
+//----------------------------------------------------------------------------
+vtkPVDataInformation* vtkSMOutputPort::GetCompleteDataInformation()
+{
+  vtkPVDataInformation* dataInfo = this->GetDataInformation();
+  if (!dataInfo->GetSummaryOnly() || !dataInfo->GetCompositeDataClassName())
+  {
+    return dataInfo;
+  }
+
+  vtkSmartPointer<vtkPVDataInformation>& info = this->Internals->CompleteInformation;
+  if (!info)
+  {
+    info = vtkSmartPointer<vtkPVDataInformation>::New();
+    info->SetPortNumber(this->PortIndex);
+    this->SourceProxy->GetSession()->PrepareProgress();
+    this->SourceProxy->GatherInformation(info);
+    this->SourceProxy->GetSession()->CleanupPendingProgress();
+  }
+  return info;
+}
+
 //----------------------------------------------------------------------------
 vtkPVTemporalDataInformation* vtkSMOutputPort::GetTemporalDataInformation()
 {
@@ -103,6 +190,7 @@ const char* vtkSMOutputPort::GetDataClassName()
 void vtkSMOutputPort::InvalidateDataInformation()
 {
   this->DataInformationValid = false;
+  this->Internals->Clear();
   this->ClassNameInformationValid = false;
   this->TemporalDataInformationValid = false;
 }
@@ -119,6 +207,7 @@ void vtkSMOutputPort::GatherDataInformation()
   this->SourceProxy->GetSession()->PrepareProgress();
   this->DataInformation->Initialize();
   this->DataInformation->SetPortNumber(this->PortIndex);
+  this->DataInformation->SetSummaryOnly(this->SummaryOnly);
   this->SourceProxy->GatherInformation(this->DataInformation);
   this->DataInformationValid = true;
   this->SourceProxy->GetSession()->CleanupPendingProgress();
@@ -194,6 +283,7 @@ void vtkSMOutputPort::PrintSelf(ostream& os, vtkIndent indent)
   this->Superclass::PrintSelf(os, indent);
   os << indent << "PortIndex: " << this->PortIndex << endl;
   os << indent << "SourceProxy: " << this->SourceProxy << endl;
+  os << indent << "SummaryOnly: " << this->SummaryOnly << endl;
 }
 
 //----------------------------------------------------------------------------
@@ -53,9 +53,41 @@ public:
    * invalid, calls GatherDataInformation.
    * If data information is gathered then this fires the
    * vtkCommand::UpdateInformationEvent event.
+   * When SummaryOnly is set, the information of the individual blocks of
+   * composite datasets is a summary without array information.
    */
   virtual vtkPVDataInformation* GetDataInformation();
 
+  //@{
+  /**
+   * When set, GetDataInformation() only gathers a summary of the blocks of
+   * composite datasets, without their array information (see
+   * vtkPVDataInformation::SetSummaryOnly). This is much cheaper for datasets
+   * with many blocks. Use GetDataInformationForCompositeIndex() or
+   * GetCompleteDataInformation() to get the details. Default is false.
+   */
+  void SetSummaryOnly(bool summaryOnly);
+  vtkGetMacro(SummaryOnly, bool);
+  vtkBooleanMacro(SummaryOnly, bool);
+  //@}
+
+  /**
+   * Returns the data information for the node with the given flat index in a
+   * composite dataset, including its array information. When SummaryOnly is
+   * set, blocks under that node are summarized like in GetDataInformation(),
+   * and the information is gathered on demand and kept until the data
+   * information is invalidated. 0 refers to the whole data object.
+   */
+  virtual vtkPVDataInformation* GetDataInformationForCompositeIndex(unsigned int index);
+
+  /**
+   * Returns the data information including the array information of all
+   * blocks. This is GetDataInformation() unless SummaryOnly is set, in which
+   * case it is gathered once, in a single request, and kept until the data
+   * information is invalidated.
+   */
+  virtual vtkPVDataInformation* GetCompleteDataInformation();
+
   /**
    * Returns data information collected over all timesteps provided by the
    * pipeline. If the data information is not valid, this results iterating over
@@ -138,7 +170,12 @@ protected:
   vtkPVTemporalDataInformation* TemporalDataInformation;
   bool TemporalDataInformationValid;
 
+  bool SummaryOnly;
+
 private:
+  class vtkInternals;
+  vtkInternals* Internals;
+
   vtkSMOutputPort(const vtkSMOutputPort&) = delete;
   void operator=(const vtkSMOutputPort&) = delete;
 
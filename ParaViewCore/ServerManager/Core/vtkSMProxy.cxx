@@ -637,6 +637,10 @@ void vtkSMProxy::UpdateVTKObjects()
     return;
   }
 
+  // Send the pushes of this proxy and of its sub-proxies together.
+  vtkSMSession* session = this->GetSession();
+  session->BeginPushBatch();
+
   if (this->PropertiesModified)
   {
     this->InUpdateVTKObjects = 1;
@@ -720,6 +724,7 @@ void vtkSMProxy::UpdateVTKObjects()
   {
     it2->second.GetPointer()->UpdateVTKObjects();
   }
+  session->EndPushBatch();
 
   this->MarkModified(this);
   this->InvokeEvent(vtkCommand::UpdateEvent, 0);
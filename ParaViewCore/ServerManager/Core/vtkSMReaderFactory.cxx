@@ -16,7 +16,9 @@
 
 #include "vtkCallbackCommand.h"
 #include "vtkClientServerStream.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
+#include "vtkPVCanReadFileInformation.h"
 #include "vtkPVProxyDefinitionIterator.h"
 #include "vtkPVXMLElement.h"
 #include "vtkPVXMLParser.h"
@@ -141,11 +143,22 @@ public:
       return (this->GetPrototypeProxy(session, this->Group.c_str(), this->Name.c_str()) != NULL);
     }
 
-    // Returns true if the reader can read the file. More correctly, it returns
-    // false is the reader reports that it cannot read the file.
-    // is_dir == true, if filename refers to a directory.
-    bool CanReadFile(const char* filename, bool is_dir, const std::vector<std::string>& extensions,
-      vtkSMSession* session, bool skip_filename_test = false);
+    // Returns true if the filename passes the extension or filename pattern
+    // tests of the reader.
+    bool FilenameTest(const char* filename, const std::vector<std::string>& extensions,
+      vtkSMSession* session)
+    {
+      this->FillInformation(session);
+      return this->ExtensionTest(extensions) || this->FilenameRegExTest(filename);
+    }
+
+    // Returns false if the reader cannot run with the number of processes, or
+    // without the MPI support, of the data server.
+    bool ProcessSupportTest(vtkSMSession* session);
+
+    // Returns the VTK class that implements CanReadFile for this reader. For
+    // meta-readers, e.g. file series, this is the class of the internal reader.
+    std::string GetReaderClassName(vtkSMSession* session);
 
     // Tests if 'any' of the strings in extensions is contained in
     // this->Extensions.
@@ -200,6 +213,12 @@ public:
   // combination of the prototype name and group.
   typedef std::map<std::string, vtkValue> PrototypesType;
   PrototypesType Prototypes;
+
+  // Keeps the candidates that can read the file, in order. All candidates are
+  // tested by the server in a single request, see vtkPVCanReadFileInformation.
+  void RemoveReadersThatCannotReadFile(
+    const char* filename, std::vector<vtkValue*>& candidates, vtkSMSession* session);
+
   std::string SupportedFileTypes;
   // The set of groups that are searched for readers. By default "sources" is
   // included.
@@ -251,40 +270,88 @@ bool vtkSMReaderFactory::vtkInternals::vtkValue::FilenameRegExTest(const char* f
 }
 
 //----------------------------------------------------------------------------
-bool vtkSMReaderFactory::vtkInternals::vtkValue::CanReadFile(const char* filename, bool is_dir,
-  const std::vector<std::string>& extensions, vtkSMSession* session,
-  bool skip_filename_test /*=false*/)
+bool vtkSMReaderFactory::vtkInternals::vtkValue::ProcessSupportTest(vtkSMSession* session)
 {
-  vtkSMSessionProxyManager* pxm = this->GetProxyManager(session);
-  vtkSMProxy* prototype = this->GetPrototypeProxy(session, this->Group.c_str(), this->Name.c_str());
-  if (!prototype)
+  vtkSMSourceProxy* source = vtkSMSourceProxy::SafeDownCast(
+    this->GetPrototypeProxy(session, this->Group.c_str(), this->Name.c_str()));
+  if (!source)
   {
-    return false;
+    return true;
   }
 
-  if (is_dir != this->IsDirectory)
+  // first check if the source requires MPI to be initialized and
+  // that it is initialized on the server.
+  if (source->GetMPIRequired() &&
+    session->IsMPIInitialized(vtkProcessModule::DATA_SERVER_ROOT) == false)
   {
     return false;
   }
 
-  if (!skip_filename_test)
+  // Check if the source requires multiple processes and if we have
+  // multiple processes on the server.
+  if (session->GetNumberOfProcesses(vtkProcessModule::DATA_SERVER) > 1)
   {
-    this->FillInformation(session);
-    if (!this->ExtensionTest(extensions) && !this->FilenameRegExTest(filename))
+    return source->GetProcessSupport() != vtkSMSourceProxy::SINGLE_PROCESS;
+  }
+  return source->GetProcessSupport() != vtkSMSourceProxy::MULTIPLE_PROCESSES;
+}
+
+//----------------------------------------------------------------------------
+std::string vtkSMReaderFactory::vtkInternals::vtkValue::GetReaderClassName(vtkSMSession* session)
+{
+  vtkSMProxy* prototype = this->GetPrototypeProxy(session, this->Group.c_str(), this->Name.c_str());
+  if (!prototype)
+  {
+    return std::string();
+  }
+  vtkSMProxy* reader = prototype->GetSubProxy("Reader");
+  if (reader && reader->GetVTKClassName())
+  {
+    return reader->GetVTKClassName();
+  }
+  return prototype->GetVTKClassName() ? prototype->GetVTKClassName() : "";
+}
+
+//----------------------------------------------------------------------------
+void vtkSMReaderFactory::vtkInternals::RemoveReadersThatCannotReadFile(
+  const char* filename, std::vector<vtkValue*>& candidates, vtkSMSession* session)
+{
+  vtkNew<vtkPVCanReadFileInformation> info;
+  info->SetFileName(filename);
+
+  // No proxy is created for the candidates: the server only instantiates their
+  // reader classes, and the information request is the only round trip.
+  std::vector<vtkValue*> probed;
+  for (vtkValue* candidate : candidates)
+  {
+    if (!candidate->ProcessSupportTest(session))
     {
-      return false;
+      continue;
     }
+    std::string classname = candidate->GetReaderClassName(session);
+    if (classname.empty())
+    {
+      continue;
+    }
+    info->AddReader(classname.c_str(), candidate->IsDirectory);
+    probed.push_back(candidate);
   }
 
-  vtkSMProxy* proxy = pxm->NewProxy(this->Group.c_str(), this->Name.c_str());
-  proxy->SetLocation(vtkProcessModule::DATA_SERVER_ROOT);
-  // we deliberate don't call UpdateVTKObjects() here since CanReadFile() can
-  // avoid callind UpdateVTKObjects() all together if not needed.
-  // proxy->UpdateVTKObjects();
-  bool canRead = vtkSMReaderFactory::CanReadFile(filename, proxy);
-  proxy->Delete();
-  return canRead;
+  candidates.clear();
+  if (probed.empty())
+  {
+    return;
+  }
+  session->GatherInformation(vtkProcessModule::DATA_SERVER_ROOT, info.GetPointer(), 0);
+  for (size_t cc = 0; cc < probed.size(); ++cc)
+  {
+    if (info->GetCanReadFile(static_cast<unsigned int>(cc)))
+    {
+      candidates.push_back(probed[cc]);
+    }
+  }
 }
+
 //----------------------------------------------------------------------------
 vtkStandardNewMacro(vtkSMReaderFactory);
 //----------------------------------------------------------------------------
@@ -419,21 +486,26 @@ vtkStringList* vtkSMReaderFactory::GetReaders(const char* filename, vtkSMSession
   std::vector<std::string> extensions;
   this->Internals->BuildExtensions(filename, extensions);
 
-  const bool is_dir = vtkSMReaderFactory::GetFilenameIsDirectory(filename, session);
+  std::vector<vtkInternals::vtkValue*> candidates;
   vtkInternals::PrototypesType::iterator iter;
   for (iter = this->Internals->Prototypes.begin(); iter != this->Internals->Prototypes.end();
        ++iter)
   {
     if (iter->second.CanCreatePrototype(session) &&
-      iter->second.CanReadFile(filename, is_dir, extensions, session))
+      iter->second.FilenameTest(filename, extensions, session))
     {
-      iter->second.FillInformation(session);
-      this->Readers->AddString(iter->second.Group.c_str());
-      this->Readers->AddString(iter->second.Name.c_str());
-      this->Readers->AddString(iter->second.Label.c_str());
+      candidates.push_back(&iter->second);
     }
   }
 
+  this->Internals->RemoveReadersThatCannotReadFile(filename, candidates, session);
+  for (vtkInternals::vtkValue* candidate : candidates)
+  {
+    this->Readers->AddString(candidate->Group.c_str());
+    this->Readers->AddString(candidate->Name.c_str());
+    this->Readers->AddString(candidate->Label.c_str());
+  }
+
   return this->Readers;
 }
 
@@ -444,27 +516,30 @@ vtkStringList* vtkSMReaderFactory::GetPossibleReaders(const char* filename, vtkS
 
   bool empty_filename = (!filename || filename[0] == 0);
 
-  const bool is_dir =
-    empty_filename ? false : vtkSMReaderFactory::GetFilenameIsDirectory(filename, session);
-
-  std::vector<std::string> extensions;
-  // purposefully set the extensions to empty, since we don't want the extension
-  // test to be used for this case.
-
+  // purposefully skip the extension test for this case.
+  std::vector<vtkInternals::vtkValue*> candidates;
   vtkInternals::PrototypesType::iterator iter;
   for (iter = this->Internals->Prototypes.begin(); iter != this->Internals->Prototypes.end();
        ++iter)
   {
-    if (iter->second.CanCreatePrototype(session) &&
-      (empty_filename || iter->second.CanReadFile(filename, is_dir, extensions, session, true)))
+    if (iter->second.CanCreatePrototype(session))
     {
       iter->second.FillInformation(session);
-      this->Readers->AddString(iter->second.Group.c_str());
-      this->Readers->AddString(iter->second.Name.c_str());
-      this->Readers->AddString(iter->second.Label.c_str());
+      candidates.push_back(&iter->second);
     }
   }
 
+  if (!empty_filename)
+  {
+    this->Internals->RemoveReadersThatCannotReadFile(filename, candidates, session);
+  }
+  for (vtkInternals::vtkValue* candidate : candidates)
+  {
+    this->Readers->AddString(candidate->Group.c_str());
+    this->Readers->AddString(candidate->Name.c_str());
+    this->Readers->AddString(candidate->Label.c_str());
+  }
+
   return this->Readers;
 }
 
@@ -479,23 +554,30 @@ bool vtkSMReaderFactory::CanReadFile(const char* filename, vtkSMSession* session
     return false;
   }
 
-  const bool is_dir = vtkSMReaderFactory::GetFilenameIsDirectory(filename, session);
-
   std::vector<std::string> extensions;
   this->Internals->BuildExtensions(filename, extensions);
 
+  std::vector<vtkInternals::vtkValue*> candidates;
   vtkInternals::PrototypesType::iterator iter;
   for (iter = this->Internals->Prototypes.begin(); iter != this->Internals->Prototypes.end();
        ++iter)
   {
     if (iter->second.CanCreatePrototype(session) &&
-      iter->second.CanReadFile(filename, is_dir, extensions, session))
+      iter->second.FilenameTest(filename, extensions, session))
     {
-      this->SetReaderGroup(iter->second.Group.c_str());
-      this->SetReaderName(iter->second.Name.c_str());
-      return true;
+      candidates.push_back(&iter->second);
     }
   }
+
+  // the first reader, in the order of the prototypes, that can read the file
+  // is picked.
+  this->Internals->RemoveReadersThatCannotReadFile(filename, candidates, session);
+  if (!candidates.empty())
+  {
+    this->SetReaderGroup(candidates.front()->Group.c_str());
+    this->SetReaderName(candidates.front()->Name.c_str());
+    return true;
+  }
   return false;
 }
 
@@ -155,6 +155,18 @@ public:
    */
   void NotifyOtherClients(const vtkSMMessage*) override { /* nothing to do. */}
 
+  //@{
+  /**
+   * Begin/end a block in which state pushes may be coalesced before being
+   * sent to the server(s). Blocks can be nested; pending pushes are sent, in
+   * order, when the outermost block ends or as soon as any other request has to
+   * reach the server. Builtin sessions apply every push immediately, hence the
+   * default implementation does nothing.
+   */
+  virtual void BeginPushBatch() {}
+  virtual void EndPushBatch() {}
+  //@}
+
   //---------------------------------------------------------------------------
   // API for Collaboration management
   //---------------------------------------------------------------------------
@@ -48,6 +48,8 @@
 
 #include <assert.h>
 #include <set>
+#include <utility>
+#include <vector>
 
 //****************************************************************************/
 //                    Internal Classes and typedefs
@@ -61,6 +63,32 @@ void RMICallback(
   self->OnServerNotificationMessageRMI(remoteArg, remoteArgLength);
 }
 };
+
+//****************************************************************************/
+class vtkSMSessionClient::vtkPushBatch
+{
+public:
+  // Nesting level of BeginPushBatch()/EndPushBatch().
+  int Depth = 0;
+
+  // Serialized messages waiting to be sent, in order, for each controller.
+  std::vector<std::pair<vtkMultiProcessController*, std::vector<std::string> > > Pending;
+
+  void Append(vtkMultiProcessController* controller, std::string message)
+  {
+    for (auto& pending : this->Pending)
+    {
+      if (pending.first == controller)
+      {
+        pending.second.push_back(std::move(message));
+        return;
+      }
+    }
+    this->Pending.emplace_back(controller, std::vector<std::string>());
+    this->Pending.back().second.push_back(std::move(message));
+  }
+};
+
 //****************************************************************************/
 vtkStandardNewMacro(vtkSMSessionClient);
 vtkCxxSetObjectMacro(vtkSMSessionClient, RenderServerController, vtkMultiProcessController);
@@ -83,6 +111,7 @@ vtkSMSessionClient::vtkSMSessionClient()
   this->RenderServerInformation = vtkPVServerInformation::New();
   this->ServerInformation = vtkPVServerInformation::New();
   this->ServerLastInvokeResult = new vtkClientServerStream();
+  this->PushBatch = new vtkPushBatch();
 
   // Register server state locator for that specific session
   vtkNew<vtkSMServerStateLocator> serverStateLocator;
@@ -120,11 +149,20 @@ vtkSMSessionClient::~vtkSMSessionClient()
 
   delete this->ServerLastInvokeResult;
   this->ServerLastInvokeResult = NULL;
+  delete this->PushBatch;
+  this->PushBatch = NULL;
 }
 
 //----------------------------------------------------------------------------
 vtkMultiProcessController* vtkSMSessionClient::GetController(ServerFlags processType)
 {
+  // The caller may talk to the server directly; it must not overtake the
+  // pushes that are still queued.
+  if (processType != CLIENT)
+  {
+    this->FlushPushBatch();
+  }
+
   switch (processType)
   {
     case CLIENT:
@@ -447,6 +485,7 @@ bool vtkSMSessionClient::IsMPIInitialized(vtkTypeUInt32 servers)
 //----------------------------------------------------------------------------
 void vtkSMSessionClient::CloseSession()
 {
+  this->FlushPushBatch();
   if (this->DataServerController)
   {
     this->DataServerController->TriggerRMIOnAllChildren(vtkPVSessionServer::CLOSE_SESSION);
@@ -465,9 +504,64 @@ void vtkSMSessionClient::CloseSession()
 //----------------------------------------------------------------------------
 void vtkSMSessionClient::PreDisconnection()
 {
+  this->FlushPushBatch();
   this->NoMoreDelete = true;
 }
 
+//----------------------------------------------------------------------------
+void vtkSMSessionClient::BeginPushBatch()
+{
+  ++this->PushBatch->Depth;
+}
+
+//----------------------------------------------------------------------------
+void vtkSMSessionClient::EndPushBatch()
+{
+  assert(this->PushBatch->Depth > 0);
+  if (--this->PushBatch->Depth == 0)
+  {
+    this->FlushPushBatch();
+  }
+}
+
+//----------------------------------------------------------------------------
+int vtkSMSessionClient::GetNumberOfPendingPushes()
+{
+  size_t count = 0;
+  for (const auto& item : this->PushBatch->Pending)
+  {
+    count += item.second.size();
+  }
+  return static_cast<int>(count);
+}
+
+//----------------------------------------------------------------------------
+void vtkSMSessionClient::FlushPushBatch()
+{
+  if (this->PushBatch->Pending.empty())
+  {
+    return;
+  }
+
+  // Sending may re-enter this session, detach the queue first.
+  std::vector<std::pair<vtkMultiProcessController*, std::vector<std::string> > > pending;
+  pending.swap(this->PushBatch->Pending);
+  for (auto& item : pending)
+  {
+    vtkMultiProcessStream stream;
+    stream << static_cast<int>(vtkPVSessionServer::PUSH_BATCH)
+           << static_cast<int>(item.second.size());
+    for (const std::string& message : item.second)
+    {
+      stream << message;
+    }
+    std::vector<unsigned char> raw_message;
+    stream.GetRawData(raw_message);
+    item.first->TriggerRMIOnAllChildren(&raw_message[0], static_cast<int>(raw_message.size()),
+      vtkPVSessionServer::CLIENT_SERVER_MESSAGE_RMI);
+  }
+}
+
 //----------------------------------------------------------------------------
 vtkTypeUInt32 vtkSMSessionClient::GetRealLocation(vtkTypeUInt32 location)
 {
@@ -510,7 +604,16 @@ void vtkSMSessionClient::PushState(vtkSMMessage* message)
   {
     controllers[num_controllers++] = this->RenderServerController;
   }
-  if (num_controllers > 0)
+  if (num_controllers > 0 && this->PushBatch->Depth > 0)
+  {
+    std::string serialized = message->SerializeAsString();
+    for (int cc = 0; cc + 1 < num_controllers; cc++)
+    {
+      this->PushBatch->Append(controllers[cc], serialized);
+    }
+    this->PushBatch->Append(controllers[num_controllers - 1], std::move(serialized));
+  }
+  else if (num_controllers > 0)
   {
     vtkMultiProcessStream stream;
     stream << static_cast<int>(vtkPVSessionServer::PUSH);
@@ -552,13 +655,20 @@ void vtkSMSessionClient::PushState(vtkSMMessage* message)
         msg.set_share_only(true);
         msg.set_client_id(this->ServerInformation->GetClientId());
 
-        vtkMultiProcessStream stream;
-        stream << static_cast<int>(vtkPVSessionServer::PUSH);
-        stream << msg.SerializeAsString();
-        std::vector<unsigned char> raw_message;
-        stream.GetRawData(raw_message);
-        this->DataServerController->TriggerRMIOnAllChildren(&raw_message[0],
-          static_cast<int>(raw_message.size()), vtkPVSessionServer::CLIENT_SERVER_MESSAGE_RMI);
+        if (this->PushBatch->Depth > 0)
+        {
+          this->PushBatch->Append(this->DataServerController, msg.SerializeAsString());
+        }
+        else
+        {
+          vtkMultiProcessStream stream;
+          stream << static_cast<int>(vtkPVSessionServer::PUSH);
+          stream << msg.SerializeAsString();
+          std::vector<unsigned char> raw_message;
+          stream.GetRawData(raw_message);
+          this->DataServerController->TriggerRMIOnAllChildren(&raw_message[0],
+            static_cast<int>(raw_message.size()), vtkPVSessionServer::CLIENT_SERVER_MESSAGE_RMI);
+        }
       }
       else if (!remoteObject)
       {
@@ -583,6 +693,7 @@ void vtkSMSessionClient::PushState(vtkSMMessage* message)
 //----------------------------------------------------------------------------
 void vtkSMSessionClient::PullState(vtkSMMessage* message)
 {
+  this->FlushPushBatch();
   this->StartBusyWork();
   vtkTypeUInt32 location = this->GetRealLocation(message->location());
   message->set_location(location);
@@ -639,6 +750,7 @@ void vtkSMSessionClient::ExecuteStream(
     return;
   }
 
+  this->FlushPushBatch();
   location = this->GetRealLocation(location);
 
   vtkMultiProcessController* controllers[2] = { NULL, NULL };
@@ -682,6 +794,7 @@ void vtkSMSessionClient::ExecuteStream(
 //----------------------------------------------------------------------------
 const vtkClientServerStream& vtkSMSessionClient::GetLastResult(vtkTypeUInt32 location)
 {
+  this->FlushPushBatch();
   this->StartBusyWork();
   location = this->GetRealLocation(location);
 
@@ -730,6 +843,7 @@ const vtkClientServerStream& vtkSMSessionClient::GetLastResult(vtkTypeUInt32 loc
 bool vtkSMSessionClient::GatherInformation(
   vtkTypeUInt32 location, vtkPVInformation* information, vtkTypeUInt32 globalid)
 {
+  this->FlushPushBatch();
   this->StartBusyWork();
   if (this->RenderServerController == NULL)
   {
@@ -829,6 +943,7 @@ void vtkSMSessionClient::UnRegisterSIObject(vtkSMMessage* message)
     return;
   }
 
+  this->FlushPushBatch();
   vtkTypeUInt32 location = this->GetRealLocation(message->location());
   message->set_location(location);
   message->set_client_id(this->GetServerInformation()->GetClientId());
@@ -870,6 +985,7 @@ void vtkSMSessionClient::RegisterSIObject(vtkSMMessage* message)
     return;
   }
 
+  this->FlushPushBatch();
   vtkTypeUInt32 location = this->GetRealLocation(message->location());
   message->set_location(location);
   message->set_client_id(this->GetServerInformation()->GetClientId());
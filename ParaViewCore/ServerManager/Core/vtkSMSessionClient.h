@@ -108,6 +108,23 @@ public:
   const vtkClientServerStream& GetLastResult(vtkTypeUInt32 location) override;
   //@}
 
+  //@{
+  /**
+   * Overridden to queue the state pushed to the server(s) while a batch is
+   * open. The queued messages are sent as a single message per server when
+   * the outermost batch ends, or before any other request is sent to the
+   * server so that the order of the requests is preserved.
+   */
+  void BeginPushBatch() override;
+  void EndPushBatch() override;
+  //@}
+
+  /**
+   * Returns the number of state messages queued by the current push batch and
+   * not sent to the server(s) yet.
+   */
+  int GetNumberOfPendingPushes();
+
   //@{
   /**
    * When Connect() is waiting for a server to connect back to the client (in
@@ -277,6 +294,14 @@ private:
   vtkSMSessionClient(const vtkSMSessionClient&) = delete;
   void operator=(const vtkSMSessionClient&) = delete;
 
+  /**
+   * Sends the state messages queued by the current push batch, if any.
+   */
+  void FlushPushBatch();
+
+  class vtkPushBatch;
+  vtkPushBatch* PushBatch;
+
   int NotBusy;
   vtkTypeUInt32 LastGlobalID;
   vtkTypeUInt32 LastGlobalIDAvailable;
@@ -1231,6 +1231,9 @@ void vtkSMSessionProxyManager::LoadXMLState(
   {
     spLoader = loader;
   }
+  // Pushes issued while creating and updating the proxies of the state are
+  // sent together instead of one message per proxy.
+  this->GetSession()->BeginPushBatch();
   if (spLoader->LoadState(rootElement, keepOriginalIds))
   {
     vtkSMProxyManager::LoadStateInformation info;
@@ -1238,6 +1241,7 @@ void vtkSMSessionProxyManager::LoadXMLState(
     info.ProxyLocator = spLoader->GetProxyLocator();
     this->InvokeEvent(vtkCommand::LoadStateEvent, &info);
   }
+  this->GetSession()->EndPushBatch();
   this->InLoadXMLState = prev;
 }
 
@@ -0,0 +1,66 @@
+from paraview import servermanager
+from paraview.simple import *
+from paraview import smtesting
+
+# Make sure the test driver know that process has properly started
+print ("Process started")
+
+def getHost(url):
+   return url.split(':')[1][2:]
+def getPort(url):
+   return int(url.split(':')[2])
+
+smtesting.ProcessCommandLineArguments()
+
+options = servermanager.vtkProcessModule.GetProcessModule().GetOptions()
+url = options.GetServerURL()
+Connect(getHost(url), getPort(url))
+
+connection = servermanager.ActiveConnection
+session = connection.Session
+
+sphere = Sphere()
+sphere.UpdatePipeline()
+
+def checkMaxX(expected):
+    sphere.UpdatePipeline()
+    bounds = sphere.GetDataInformation().GetBounds()
+    if abs(bounds[1] - expected) > 1e-6:
+        raise RuntimeError("Expected a maximum x of %g, got %g" % (expected, bounds[1]))
+
+def checkPending(condition, message):
+    if not condition(session.GetNumberOfPendingPushes()):
+        raise RuntimeError("%s: %d pending pushes" % (message, session.GetNumberOfPendingPushes()))
+
+#---------------------------------------------------------
+# Pushes are queued while a batch is open, nested batches do not send them.
+with connection.BatchPushes():
+    for radius in (2.0, 3.0, 4.0):
+        sphere.Radius = radius
+    checkPending(lambda count: count >= 3, "Pushes not queued")
+    pending = session.GetNumberOfPendingPushes()
+
+    with connection.BatchPushes():
+        sphere.Center = [1.0, 0.0, 0.0]
+    checkPending(lambda count: count > pending, "Nested batch sent the pushes")
+
+    #---------------------------------------------------------
+    # Any other request sends the queued pushes first, in order.
+    checkMaxX(5.0)
+    checkPending(lambda count: count == 0, "Pushes not sent before a request")
+
+    sphere.Radius = 5.0
+    checkPending(lambda count: count > 0, "Pushes not queued after a request")
+
+#---------------------------------------------------------
+# Closing the batch sends the remaining pushes.
+checkPending(lambda count: count == 0, "Pushes not sent when the batch ends")
+checkMaxX(6.0)
+
+#---------------------------------------------------------
+# Outside of a batch, pushes are sent right away.
+sphere.Radius = 1.0
+checkPending(lambda count: count == 0, "Pushes queued outside of a batch")
+checkMaxX(2.0)
+
+print ("Test Passed")
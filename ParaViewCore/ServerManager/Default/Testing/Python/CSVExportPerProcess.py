@@ -0,0 +1,48 @@
+from paraview.simple import *
+from paraview import smtesting
+import glob
+import os
+
+smtesting.ProcessCommandLineArguments()
+
+# Exports a spreadsheet view with each process writing its own rows, and
+# checks that the files hold all the points of the data.
+sphere = Sphere(ThetaResolution=32, PhiResolution=32)
+view = CreateView('SpreadSheetView')
+Show(sphere, view)
+view.StillRender()
+
+prefix = os.path.join(smtesting.TempDir, "CSVExportPerProcess")
+for f in glob.glob(prefix + "*.csv"):
+    os.remove(f)
+ExportView(prefix + ".csv", view=view, WritePerProcess=1)
+
+pm = servermanager.vtkProcessModule.GetProcessModule()
+controller = pm.GetGlobalController()
+if pm.GetSymmetricMPIMode():
+    controller.Barrier()
+else:
+    # fetching the data reduces it over all the processes, which are done
+    # exporting by then.
+    servermanager.Fetch(sphere)
+
+if pm.GetPartitionId() == 0:
+    numProcs = controller.GetNumberOfProcesses()
+    if numProcs > 1:
+        expected = ["%s_%d.csv" % (prefix, rank) for rank in range(numProcs)]
+    else:
+        expected = [prefix + ".csv"]
+    files = sorted(glob.glob(prefix + "*.csv"))
+    if files != sorted(expected):
+        raise RuntimeError("Unexpected files: %s" % files)
+
+    numberOfRows = 0
+    for fname in files:
+        with open(fname) as f:
+            lines = f.read().splitlines()
+        if not lines or "Points:0" not in lines[0]:
+            raise RuntimeError("Missing header in %s" % fname)
+        numberOfRows += len(lines) - 1
+    numberOfPoints = sphere.GetDataInformation().GetNumberOfPoints()
+    if numberOfRows != numberOfPoints:
+        raise RuntimeError("Exported %d rows for %d points" % (numberOfRows, numberOfPoints))
@@ -0,0 +1,79 @@
+from paraview import servermanager
+from paraview.simple import *
+from paraview import smtesting
+from paraview.modules.vtkPVClientServerCoreRendering import vtkPVDataDeliveryManager
+import filecmp
+import os
+
+# Make sure the test driver know that process has properly started
+print ("Process started")
+
+def getHost(url):
+   return url.split(':')[1][2:]
+def getPort(url):
+   return int(url.split(':')[2])
+
+smtesting.ProcessCommandLineArguments()
+
+options = servermanager.vtkProcessModule.GetProcessModule().GetOptions()
+url = options.GetServerURL()
+Connect(getHost(url), getPort(url))
+
+source = TimeSource()
+source.XAmplitude = 1.0
+
+view = CreateRenderView()
+view.ViewSize = [300, 300]
+# render locally so that the geometry is delivered to the client.
+view.RemoteRenderThreshold = 1000
+view.ClientGeometryCacheSize = 100
+Show(source, view)
+ResetCamera(view)
+
+scene = GetAnimationScene()
+scene.UpdateAnimationUsingDataTimeSteps()
+scene.PlayMode = 'Snap To TimeSteps'
+times = source.TimestepValues
+if len(times) < 2:
+    raise RuntimeError("Expected a temporal source.")
+
+# Plays the animation once, saving an image per time step, and returns the
+# number of cache hits and misses.
+def play(prefix):
+    vtkPVDataDeliveryManager.ClearClientCacheStateFlags()
+    for index, time in enumerate(times):
+        scene.AnimationTime = time
+        Render(view)
+        SaveScreenshot(os.path.join(smtesting.TempDir, "%s.%d.png" % (prefix, index)), view)
+    return (vtkPVDataDeliveryManager.GetClientCacheHits(),
+            vtkPVDataDeliveryManager.GetClientCacheMisses())
+
+def compare(prefix, other_prefix):
+    for index in range(len(times)):
+        image = os.path.join(smtesting.TempDir, "%s.%d.png" % (prefix, index))
+        other = os.path.join(smtesting.TempDir, "%s.%d.png" % (other_prefix, index))
+        if not filecmp.cmp(image, other, shallow=False):
+            raise RuntimeError("%s differs from %s" % (image, other))
+
+#---------------------------------------------------------
+# First pass: all time steps are delivered and cached, except the first one
+# if it was delivered already.
+hits, misses = play("ClientGeometryCacheFirst")
+if hits != 0 or misses < len(times) - 1:
+    raise RuntimeError("Unexpected first pass: %d hits, %d misses" % (hits, misses))
+
+#---------------------------------------------------------
+# Second pass: all time steps come from the cache and look the same.
+hits, misses = play("ClientGeometryCacheSecond")
+if hits < len(times) or misses != 0:
+    raise RuntimeError("Unexpected second pass: %d hits, %d misses" % (hits, misses))
+compare("ClientGeometryCacheSecond", "ClientGeometryCacheFirst")
+
+#---------------------------------------------------------
+# Changing an upstream property invalidates the cached geometry.
+source.XAmplitude = 2.0
+hits, misses = play("ClientGeometryCacheModified")
+if hits != 0 or misses < len(times):
+    raise RuntimeError("Unexpected pass after a change: %d hits, %d misses" % (hits, misses))
+
+print ("Test Passed")
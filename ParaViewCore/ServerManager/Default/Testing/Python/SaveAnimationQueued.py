@@ -0,0 +1,43 @@
+from paraview.simple import *
+from paraview import smtesting
+import filecmp
+import glob
+import os
+
+smtesting.ProcessCommandLineArguments()
+
+# Saves the same animation with and without the frame queue, which writes
+# frames on a separate thread, and checks that the images are identical.
+sphere = Sphere()
+view = CreateView('RenderView')
+view.ViewSize = [300, 300]
+display = Show(sphere, view)
+
+scene = GetAnimationScene()
+scene.PlayMode = 'Sequence'
+scene.NumberOfFrames = 6
+cue = GetAnimationTrack('StartTheta', proxy=sphere)
+cue.KeyFrames = [CompositeKeyFrame(KeyTime=0, KeyValues=[0]),
+                 CompositeKeyFrame(KeyTime=1, KeyValues=[300])]
+
+ResetCamera(view)
+
+sync_prefix = os.path.join(smtesting.TempDir, "SaveAnimationSync")
+queued_prefix = os.path.join(smtesting.TempDir, "SaveAnimationQueued")
+for prefix in (sync_prefix, queued_prefix):
+    for f in glob.glob(prefix + ".*.png"):
+        os.remove(f)
+
+SaveAnimation(sync_prefix + ".png", view, FrameQueueDepth=0)
+SaveAnimation(queued_prefix + ".png", view, FrameQueueDepth=3)
+
+pm = servermanager.vtkProcessModule.GetProcessModule()
+if pm.GetPartitionId() == 0:
+    sync_files = sorted(glob.glob(sync_prefix + ".*.png"))
+    queued_files = sorted(glob.glob(queued_prefix + ".*.png"))
+    if len(sync_files) != 6 or len(queued_files) != len(sync_files):
+        raise RuntimeError("Unexpected number of frames: %d and %d" %
+                           (len(sync_files), len(queued_files)))
+    for sync_file, queued_file in zip(sync_files, queued_files):
+        if not filecmp.cmp(sync_file, queued_file, shallow=False):
+            raise RuntimeError("%s differs from %s" % (queued_file, sync_file))
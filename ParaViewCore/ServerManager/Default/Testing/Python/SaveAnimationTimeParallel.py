@@ -0,0 +1,62 @@
+from paraview.simple import *
+from paraview import smtesting
+import glob
+import os
+import re
+
+smtesting.ProcessCommandLineArguments()
+
+# Run with --time-parallel-groups: each group saves the same animation, with
+# both frame distributions, and checks that it played and wrote only its own
+# frames.
+sphere = Sphere()
+view = CreateView('RenderView')
+view.ViewSize = [200, 200]
+Show(sphere, view)
+
+scene = GetAnimationScene()
+scene.PlayMode = 'Sequence'
+scene.StartTime = 0
+scene.EndTime = 1
+numFrames = 7
+scene.NumberOfFrames = numFrames
+cue = GetAnimationTrack('StartTheta', proxy=sphere)
+cue.KeyFrames = [CompositeKeyFrame(KeyTime=0, KeyValues=[0]),
+                 CompositeKeyFrame(KeyTime=1, KeyValues=[300])]
+ResetCamera(view)
+
+pm = servermanager.vtkProcessModule.GetProcessModule()
+group = pm.GetTimeParallelGroup()
+numGroups = pm.GetNumberOfTimeParallelGroups()
+if numGroups != 2:
+    raise RuntimeError("Expected 2 time-parallel groups, got %d" % numGroups)
+
+# frames played while saving, when the scene does not render on its own.
+ticks = []
+def recordTick(obj, event):
+    if obj.GetOverrideStillRender():
+        ticks.append(int(round(obj.GetSceneTime() * (numFrames - 1))))
+scene.GetClientSideObject().AddObserver("AnimationCueTickEvent", recordTick)
+
+expectedFrames = {
+    "Interleaved": [f for f in range(numFrames) if f % numGroups == group],
+    "Contiguous": [f for f in range(numFrames)
+                   if numFrames * group // numGroups <= f < numFrames * (group + 1) // numGroups],
+}
+for distribution, expected in expectedFrames.items():
+    prefix = os.path.join(smtesting.TempDir,
+                          "SaveAnimationTimeParallel_%s_%d" % (distribution, group))
+    for f in glob.glob(prefix + ".*.png"):
+        os.remove(f)
+
+    del ticks[:]
+    SaveAnimation(prefix + ".png", view, FrameDistribution=distribution)
+
+    if ticks != expected:
+        raise RuntimeError("%s: group %d played frames %s instead of %s" %
+                           (distribution, group, ticks, expected))
+    written = sorted(int(re.search(r"\.(\d+)\.png$", f).group(1))
+                     for f in glob.glob(prefix + ".*.png"))
+    if written != expected:
+        raise RuntimeError("%s: group %d wrote frames %s instead of %s" %
+                           (distribution, group, written, expected))
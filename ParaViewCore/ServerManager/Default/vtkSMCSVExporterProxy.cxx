@@ -15,7 +15,9 @@
 #include "vtkSMCSVExporterProxy.h"
 
 #include "vtkCSVExporter.h"
+#include "vtkClientServerStream.h"
 #include "vtkObjectFactory.h"
+#include "vtkPVSession.h"
 #include "vtkPVXYChartView.h"
 #include "vtkSMPropertyHelper.h"
 #include "vtkSMViewProxy.h"
@@ -71,7 +73,19 @@ void vtkSMCSVExporterProxy::Write()
     exporter->SetFieldDelimiter("\t");
   }
   vtkObjectBase* obj = this->View->GetClientSideObject();
-  if (vtkSpreadSheetView* sview = vtkSpreadSheetView::SafeDownCast(obj))
+  if (vtkSpreadSheetView::SafeDownCast(obj) &&
+    vtkSMPropertyHelper(this, "WritePerProcess", /*quiet*/ true).GetAsInt() == 1)
+  {
+    // each data server process writes its own rows, nothing is streamed to
+    // the client.
+    vtkClientServerStream stream;
+    stream << vtkClientServerStream::Invoke << VTKOBJECT(this) << "SetFieldDelimiter"
+           << exporter->GetFieldDelimiter() << vtkClientServerStream::End;
+    stream << vtkClientServerStream::Invoke << VTKOBJECT(this->View) << "ExportLocalRows"
+           << VTKOBJECT(this) << vtkClientServerStream::End;
+    this->ExecuteStream(stream, false, vtkPVSession::DATA_SERVER);
+  }
+  else if (vtkSpreadSheetView* sview = vtkSpreadSheetView::SafeDownCast(obj))
   {
     sview->Export(exporter);
   }
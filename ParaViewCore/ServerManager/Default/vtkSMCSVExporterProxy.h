@@ -20,6 +20,10 @@
  * vtkSMCSVExporterProxy is used to export the certain views to a CSV file.
  * Currently, we support vtkSpreadSheetView and vtkPVXYChartView (which includes
  * Bar/Line/Quartile/Parallel Coordinates views).
+ *
+ * When the `WritePerProcess` property is set, a spreadsheet view is exported
+ * on the data server instead: each process writes its local rows to its own
+ * file, see vtkSpreadSheetView::ExportLocalRows.
 */
 
 #ifndef vtkSMCSVExporterProxy_h
@@ -0,0 +1,151 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    TestFrameTimerLog.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkClientServerStream.h"
+#include "vtkInitializationHelper.h"
+#include "vtkNew.h"
+#include "vtkPVFrameTimerLog.h"
+#include "vtkPVFrameTimerLogInformation.h"
+#include "vtkPVSession.h"
+#include "vtkProcessModule.h"
+#include "vtkSMSession.h"
+#include "vtkTimerLog.h"
+
+#include "vtk_jsoncpp.h"
+#include <cmath>
+#include <memory>
+#include <string>
+
+#define myassert(condition, message)                                                               \
+  if ((condition))                                                                                 \
+  {                                                                                                \
+    cout << message << " -- SUCCESS" << endl;                                                      \
+  }                                                                                                \
+  else                                                                                             \
+  {                                                                                                \
+    cout << message << " -- FAILED" << endl;                                                       \
+    return EXIT_FAILURE;                                                                           \
+  }
+
+namespace
+{
+bool IsClose(double value, double expected)
+{
+  return std::abs(value - expected) < 1e-9;
+}
+
+// Returns the number of complete events named `name` in `events`.
+int CountEvents(const Json::Value& events, const char* name)
+{
+  int count = 0;
+  for (const Json::Value& event : events)
+  {
+    count += (event["ph"].asString() == "X" && event["name"].asString() == name) ? 1 : 0;
+  }
+  return count;
+}
+}
+
+int TestFrameTimerLog(int argc, char* argv[])
+{
+  (void)argc;
+
+  vtkInitializationHelper::Initialize(argv[0], vtkProcessModule::PROCESS_CLIENT);
+  vtkNew<vtkSMSession> session;
+  vtkProcessModule::GetProcessModule()->RegisterSession(session.Get());
+
+  // Two frames with known spans: the first one interactive, with an update
+  // and a render containing a composite and two transfers.
+  vtkPVFrameTimerLog::Clear();
+  const double t0 = vtkTimerLog::GetUniversalTime() - 1.0;
+  vtkPVFrameTimerLog::AddSpan(vtkPVFrameTimerLog::UPDATE, t0, 0.01);
+  vtkPVFrameTimerLog::AddSpan(vtkPVFrameTimerLog::RENDER, t0 + 0.01, 0.02);
+  vtkPVFrameTimerLog::AddSpan(vtkPVFrameTimerLog::COMPOSITE, t0 + 0.011, 0.005, 1000);
+  vtkPVFrameTimerLog::AddSpan(vtkPVFrameTimerLog::TRANSFER, t0 + 0.016, 0.001, 100);
+  vtkPVFrameTimerLog::AddSpan(vtkPVFrameTimerLog::TRANSFER, t0 + 0.017, 0.002, 200);
+  vtkPVFrameTimerLog::EndFrame(true);
+  vtkPVFrameTimerLog::AddSpan(vtkPVFrameTimerLog::RENDER, t0 + 0.5, 0.03);
+  vtkPVFrameTimerLog::EndFrame(false);
+  myassert(vtkPVFrameTimerLog::GetNumberOfFrames() == 2, "Record frames");
+
+  vtkNew<vtkPVFrameTimerLogInformation> info;
+  session->GatherInformation(vtkPVSession::CLIENT, info.Get(), 0);
+  myassert(info->GetNumberOfProcesses() == 1, "Gather frames");
+  myassert(info->GetNumberOfFrames(0) == 2, "Frame count");
+  myassert(info->GetFrameInteractive(0, 0) && !info->GetFrameInteractive(0, 1),
+    "Interactive frames");
+  myassert(IsClose(info->GetFrameStartTime(0, 0), t0) &&
+      info->GetFrameEndTime(0, 0) >= info->GetFrameStartTime(0, 0),
+    "Frame times");
+  myassert(IsClose(info->GetStageTime(0, 0, vtkPVFrameTimerLog::UPDATE), 0.01) &&
+      IsClose(info->GetStageTime(0, 0, vtkPVFrameTimerLog::RENDER), 0.02) &&
+      IsClose(info->GetStageTime(0, 0, vtkPVFrameTimerLog::TRANSFER), 0.003) &&
+      IsClose(info->GetStageTime(0, 0, vtkPVFrameTimerLog::DELIVERY), 0.0) &&
+      IsClose(info->GetStageTime(0, 1, vtkPVFrameTimerLog::RENDER), 0.03),
+    "Stage times");
+  myassert(info->GetStageBytes(0, 0, vtkPVFrameTimerLog::COMPOSITE) == 1000 &&
+      info->GetStageBytes(0, 0, vtkPVFrameTimerLog::TRANSFER) == 300 &&
+      info->GetStageBytes(0, 1, vtkPVFrameTimerLog::TRANSFER) == 0,
+    "Stage bytes");
+
+  // Merge a serialized copy, as done when gathering from the servers.
+  vtkClientServerStream stream;
+  info->CopyToStream(&stream);
+  vtkNew<vtkPVFrameTimerLogInformation> other;
+  other->CopyFromStream(&stream);
+  info->AddInformation(other.Get());
+  myassert(info->GetNumberOfProcesses() == 2 && info->GetNumberOfFrames(1) == 2 &&
+      info->GetProcessType(1) == info->GetProcessType(0) &&
+      IsClose(info->GetStageTime(1, 0, vtkPVFrameTimerLog::TRANSFER), 0.003) &&
+      info->GetStageBytes(1, 0, vtkPVFrameTimerLog::TRANSFER) == 300,
+    "Merge serialized frames");
+
+  // The trace has a metadata event per process, and a complete event per
+  // frame and per span.
+  const std::string trace = info->GetChromeTrace();
+  Json::CharReaderBuilder builder;
+  Json::Value root;
+  std::unique_ptr<Json::CharReader> reader(builder.newCharReader());
+  myassert(reader->parse(trace.c_str(), trace.c_str() + trace.size(), &root, nullptr),
+    "Parse Chrome trace");
+  const Json::Value& events = root["traceEvents"];
+  myassert(events.isArray() && events.size() == 2 * (1 + 2 + 6), "Number of trace events");
+  myassert(CountEvents(events, "Frame") == 4 &&
+      CountEvents(events, vtkPVFrameTimerLog::GetStageName(vtkPVFrameTimerLog::RENDER)) == 4 &&
+      CountEvents(events, vtkPVFrameTimerLog::GetStageName(vtkPVFrameTimerLog::TRANSFER)) == 4,
+    "Trace event names");
+  bool valid = true;
+  for (const Json::Value& event : events)
+  {
+    valid = valid && event["pid"].isInt() && event["ph"].isString();
+    if (event["ph"].asString() == "X")
+    {
+      valid = valid && event["ts"].isDouble() && event["dur"].isDouble() &&
+        event["dur"].asDouble() >= 0.0;
+    }
+  }
+  myassert(valid, "Trace event fields");
+
+  // Older frames are discarded.
+  vtkPVFrameTimerLog::SetMaxNumberOfFrames(1);
+  myassert(vtkPVFrameTimerLog::GetNumberOfFrames() == 1 &&
+      !vtkPVFrameTimerLog::GetFrameInteractive(0),
+    "Discard older frames");
+  vtkPVFrameTimerLog::SetMaxNumberOfFrames(100);
+  vtkPVFrameTimerLog::Clear();
+
+  vtkProcessModule::GetProcessModule()->UnRegisterSession(session.Get());
+  vtkInitializationHelper::Finalize();
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,73 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    TestImageReductionFactor.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkSMRenderViewProxy.h"
+
+#include <cstdlib>
+
+#define TEST_ASSERT(x)                                                                             \
+  if (!(x))                                                                                        \
+  {                                                                                                \
+    cerr << "ERROR: failed at " << __LINE__ << "!" << endl;                                        \
+    return EXIT_FAILURE;                                                                           \
+  }
+
+namespace
+{
+int Compute(int factor, double averageRenderTime, double frameRate)
+{
+  return vtkSMRenderViewProxy::ComputeImageReductionFactor(factor, averageRenderTime, frameRate);
+}
+}
+
+// Tests how vtkSMRenderViewProxy picks the image reduction factor of
+// interactive renders for the "TargetInteractiveFrameRate" property, from
+// synthetic render times.
+int TestImageReductionFactor(int, char* [])
+{
+  // Renders four times too slow for 10 fps need half the pixels along each
+  // axis, renders four times too fast need twice as many.
+  TEST_ASSERT(Compute(2, 0.4, 10.0) == 4);
+  TEST_ASSERT(Compute(4, 0.025, 10.0) == 2);
+  TEST_ASSERT(Compute(1, 1.0, 4.0) == 2);
+
+  // Factors off by less than 20% are kept.
+  TEST_ASSERT(Compute(2, 0.1, 10.0) == 2);
+  TEST_ASSERT(Compute(2, 0.13, 10.0) == 2);
+  TEST_ASSERT(Compute(2, 0.075, 10.0) == 2);
+  TEST_ASSERT(Compute(2, 0.16, 10.0) == 3);
+
+  // Factors are clamped to [1, 20].
+  TEST_ASSERT(Compute(10, 10.0, 30.0) == 20);
+  TEST_ASSERT(Compute(20, 1.0, 60.0) == 20);
+  TEST_ASSERT(Compute(4, 0.001, 10.0) == 1);
+  TEST_ASSERT(Compute(1, 0.001, 10.0) == 1);
+
+  // Without render times or target frame rate, the factor is unchanged.
+  TEST_ASSERT(Compute(3, 0.0, 10.0) == 3);
+  TEST_ASSERT(Compute(3, 0.5, 0.0) == 3);
+
+  // Renders taking 0.9 s at full resolution settle on a factor of 3 for 10 fps,
+  // whatever the factor they start from.
+  for (int start = 1; start <= 20; ++start)
+  {
+    int factor = start;
+    for (int cc = 0; cc < 10; ++cc)
+    {
+      factor = Compute(factor, 0.9 / (factor * factor), 10.0);
+    }
+    TEST_ASSERT(factor == 3);
+  }
+  return EXIT_SUCCESS;
+}
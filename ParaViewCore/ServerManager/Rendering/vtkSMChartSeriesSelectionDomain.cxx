@@ -26,6 +26,7 @@
 #include "vtkPVDataSetAttributesInformation.h"
 #include "vtkPVXMLElement.h"
 #include "vtkSMArrayListDomain.h"
+#include "vtkSMOutputPort.h"
 #include "vtkSMSourceProxy.h"
 #include "vtkSMStringVectorProperty.h"
 #include "vtkSMUncheckedPropertyHelper.h"
@@ -147,6 +148,25 @@ vtkPVDataInformation* vtkSMChartSeriesSelectionDomain::GetInputInformation()
   return nullptr;
 }
 
+//----------------------------------------------------------------------------
+vtkPVDataInformation* vtkSMChartSeriesSelectionDomain::GetCompleteInputInformation()
+{
+  vtkSMProperty* inputProperty = this->GetRequiredProperty("Input");
+  assert(inputProperty);
+
+  vtkSMUncheckedPropertyHelper helper(inputProperty);
+  if (helper.GetNumberOfElements() > 0)
+  {
+    vtkSMSourceProxy* sp = vtkSMSourceProxy::SafeDownCast(helper.GetAsProxy(0));
+    vtkSMOutputPort* port = sp ? sp->GetOutputPort(helper.GetOutputPort()) : nullptr;
+    if (port)
+    {
+      return port->GetCompleteDataInformation();
+    }
+  }
+  return nullptr;
+}
+
 //----------------------------------------------------------------------------
 int vtkSMChartSeriesSelectionDomain::ReadXMLAttributes(
   vtkSMProperty* prop, vtkPVXMLElement* element)
@@ -236,6 +256,15 @@ void vtkSMChartSeriesSelectionDomain::Update(vtkSMProperty*)
 
   vtkSMUncheckedPropertyHelper compositeIndexHelper(compositeIndex);
   unsigned int numElems = compositeIndexHelper.GetNumberOfElements();
+  if (numElems > 0)
+  {
+    // the input information may only summarize blocks, fetch the arrays of all
+    // blocks at once.
+    if (vtkPVDataInformation* completeInfo = this->GetCompleteInputInformation())
+    {
+      dataInfo = completeInfo;
+    }
+  }
   for (unsigned int cc = 0; cc < numElems; cc++)
   {
     vtkPVDataInformation* childInfo =
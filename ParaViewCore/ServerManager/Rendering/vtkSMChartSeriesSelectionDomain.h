@@ -112,6 +112,12 @@ protected:
    */
   vtkPVDataInformation* GetInputInformation();
 
+  /**
+   * Returns the datainformation for the current input including the arrays of
+   * all blocks, if possible.
+   */
+  vtkPVDataInformation* GetCompleteInputInformation();
+
   /**
    * Process any specific XML definition tags.
    */
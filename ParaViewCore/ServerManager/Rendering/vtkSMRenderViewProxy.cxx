@@ -64,10 +64,12 @@
 #include "vtkSelection.h"
 #include "vtkSelectionNode.h"
 #include "vtkSmartPointer.h"
+#include "vtkTimerLog.h"
 #include "vtkTransform.h"
 #include "vtkWeakPointer.h"
 
 #include <cassert>
+#include <cmath>
 #include <map>
 
 vtkStandardNewMacro(vtkSMRenderViewProxy);
@@ -79,6 +81,9 @@ vtkSMRenderViewProxy::vtkSMRenderViewProxy()
   this->NewMasterObserverId = 0;
   this->DeliveryManager = NULL;
   this->NeedsUpdateLOD = true;
+  this->AdaptiveImageReductionFactor = 0;
+  this->AverageInteractiveRenderTime = 0.0;
+  this->InteractiveRenderStartTime = -1.0;
   this->InteractorHelper->SetViewProxy(this);
 }
 
@@ -250,12 +255,97 @@ vtkTypeUInt32 vtkSMRenderViewProxy::PreRender(bool interactive)
     this->UpdateLOD();
   }
   this->DeliveryManager->Deliver(interactive);
-  return interactive ? rv->GetInteractiveRenderProcesses() : rv->GetStillRenderProcesses();
+  vtkTypeUInt32 location =
+    interactive ? rv->GetInteractiveRenderProcesses() : rv->GetStillRenderProcesses();
+  this->AdaptImageReductionFactor(interactive, location);
+  return location;
+}
+
+//-----------------------------------------------------------------------------
+void vtkSMRenderViewProxy::AdaptImageReductionFactor(bool interactive, vtkTypeUInt32 location)
+{
+  this->InteractiveRenderStartTime = -1.0;
+
+  const double frameRate =
+    vtkSMPropertyHelper(this, "TargetInteractiveFrameRate", /*quiet=*/true).GetAsDouble();
+  if (frameRate <= 0.0)
+  {
+    if (this->AdaptiveImageReductionFactor != 0)
+    {
+      // restore the factor chosen by the user.
+      this->AdaptiveImageReductionFactor = 0;
+      this->AverageInteractiveRenderTime = 0.0;
+      this->UpdateProperty("ImageReductionFactor", 1);
+    }
+    return;
+  }
+
+  // image reduction only applies to remote renders.
+  if (!interactive || location == vtkPVSession::CLIENT)
+  {
+    return;
+  }
+
+  int factor = this->AdaptiveImageReductionFactor;
+  if (factor == 0)
+  {
+    factor = vtkSMPropertyHelper(this, "ImageReductionFactor").GetAsInt();
+  }
+  else
+  {
+    const int next = vtkSMRenderViewProxy::ComputeImageReductionFactor(
+      factor, this->AverageInteractiveRenderTime, frameRate);
+    if (next != factor)
+    {
+      // the previous renders no longer tell how long the next ones take.
+      factor = next;
+      this->AverageInteractiveRenderTime = 0.0;
+    }
+  }
+  this->AdaptiveImageReductionFactor = factor;
+
+  // Sent on every interactive render, since pushing the "ImageReductionFactor"
+  // property overrides it.
+  vtkClientServerStream stream;
+  stream << vtkClientServerStream::Invoke << VTKOBJECT(this)
+         << "SetInteractiveRenderImageReductionFactor" << factor << vtkClientServerStream::End;
+  this->ExecuteStream(stream, false, location);
+
+  this->InteractiveRenderStartTime = vtkTimerLog::GetUniversalTime();
+}
+
+//-----------------------------------------------------------------------------
+int vtkSMRenderViewProxy::ComputeImageReductionFactor(
+  int factor, double averageRenderTime, double frameRate)
+{
+  if (averageRenderTime <= 0.0 || frameRate <= 0.0)
+  {
+    return factor;
+  }
+
+  // Compositing, compressing and sending the image scale with the number of
+  // pixels i.e. with 1/factor^2. Only change the factor when it is off by
+  // more than 20% to avoid oscillating between two factors.
+  const double ideal = factor * std::sqrt(averageRenderTime * frameRate);
+  if (ideal > 1.2 * factor || ideal * 1.2 < factor)
+  {
+    return vtkMath::ClampValue(static_cast<int>(std::round(ideal)), 1, 20);
+  }
+  return factor;
 }
 
 //-----------------------------------------------------------------------------
 void vtkSMRenderViewProxy::PostRender(bool interactive)
 {
+  if (interactive && this->InteractiveRenderStartTime >= 0.0)
+  {
+    const double elapsed = vtkTimerLog::GetUniversalTime() - this->InteractiveRenderStartTime;
+    this->AverageInteractiveRenderTime = this->AverageInteractiveRenderTime > 0.0
+      ? 0.5 * (this->AverageInteractiveRenderTime + elapsed)
+      : elapsed;
+    this->InteractiveRenderStartTime = -1.0;
+  }
+
   vtkSMProxy* cameraProxy = this->GetSubProxy("ActiveCamera");
   cameraProxy->UpdatePropertyInformation();
   this->SynchronizeCameraProperties();
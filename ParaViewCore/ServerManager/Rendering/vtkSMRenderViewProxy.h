@@ -228,6 +228,16 @@ public:
   void SetValueRenderingMode(int mode);
   //@}
 
+  /**
+   * Returns the image reduction factor for the next interactive render, given
+   * the \c factor used by the previous ones, the average time in seconds they
+   * took, and the target frame rate. The time is assumed to scale with the
+   * number of pixels, i.e. with 1/factor^2. The factor is only changed when it
+   * is off by more than 20%, and is clamped to [1, 20]. \c factor is returned
+   * as is when \c averageRenderTime or \c frameRate are not positive.
+   */
+  static int ComputeImageReductionFactor(int factor, double averageRenderTime, double frameRate);
+
 protected:
   vtkSMRenderViewProxy();
   ~vtkSMRenderViewProxy() override;
@@ -257,6 +267,14 @@ protected:
   vtkTypeUInt32 PreRender(bool interactive) override;
   void PostRender(bool interactive) override;
 
+  /**
+   * When the "TargetInteractiveFrameRate" property is set, picks the image
+   * reduction factor for the next remote interactive render from the time the
+   * previous ones took, and starts timing the render. Still renders are not
+   * affected since they use "StillRenderImageReductionFactor".
+   */
+  void AdaptImageReductionFactor(bool interactive, vtkTypeUInt32 location);
+
   /**
    * Fetches the LastSelection from the data-server and then converts it to a
    * selection source proxy and returns that.
@@ -287,6 +305,12 @@ protected:
   vtkSMDataDeliveryManager* DeliveryManager;
   bool NeedsUpdateLOD;
 
+  // State for AdaptImageReductionFactor(). The factor is 0 when the view uses
+  // the "ImageReductionFactor" property as is.
+  int AdaptiveImageReductionFactor;
+  double AverageInteractiveRenderTime;
+  double InteractiveRenderStartTime;
+
 private:
   vtkSMRenderViewProxy(const vtkSMRenderViewProxy&) = delete;
   void operator=(const vtkSMRenderViewProxy&) = delete;
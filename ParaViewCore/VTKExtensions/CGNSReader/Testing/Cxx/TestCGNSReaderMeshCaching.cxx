@@ -77,6 +77,9 @@ int TestCGNSReaderMeshCaching(int argc, char* argv[])
 
   // Check Mesh Data pointer did not change between loadings
   vtk_assert(da == db);
+  // Check that solution arrays from the previous loading were not kept with
+  // the cached mesh
+  vtk_assert(ds->GetCellData()->GetArray("Pressure") == nullptr);
   // Check that caching mesh implies lower loading time
   // vtk_assert(hot_timing < cold_timing);
   cout << "Expected timings: " << hot_timing << " < " << cold_timing << endl;
@@ -0,0 +1,126 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    TestCGNSReaderSplitZones.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkCGNSReader.h"
+#include "vtkCellData.h"
+#include "vtkDataObjectTreeIterator.h"
+#include "vtkDataSetAttributes.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkSmartPointer.h"
+#include "vtkStructuredGrid.h"
+#include "vtkTestUtilities.h"
+#include "vtkUnsignedCharArray.h"
+
+#include <string>
+
+#define vtk_assert(x)                                                                              \
+  if (!(x))                                                                                        \
+  {                                                                                                \
+    cerr << "On line " << __LINE__ << " ERROR: Condition FAILED!! : " << #x << endl;               \
+    return EXIT_FAILURE;                                                                           \
+  }
+
+namespace
+{
+struct ZoneCounts
+{
+  int Grids = 0;
+  int GridsWithGhosts = 0;
+  vtkIdType Cells = 0;
+  vtkIdType GhostCells = 0;
+};
+
+ZoneCounts CountCells(vtkMultiBlockDataSet* mb)
+{
+  ZoneCounts counts;
+  auto iter = vtkSmartPointer<vtkDataObjectTreeIterator>::Take(mb->NewTreeIterator());
+  for (iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextItem())
+  {
+    vtkStructuredGrid* sgrid = vtkStructuredGrid::SafeDownCast(iter->GetCurrentDataObject());
+    if (!sgrid || sgrid->GetNumberOfCells() == 0)
+    {
+      continue;
+    }
+    counts.Grids++;
+    counts.Cells += sgrid->GetNumberOfCells();
+    vtkUnsignedCharArray* ghosts = vtkUnsignedCharArray::SafeDownCast(
+      sgrid->GetCellData()->GetArray(vtkDataSetAttributes::GhostArrayName()));
+    if (ghosts)
+    {
+      counts.GridsWithGhosts++;
+      for (vtkIdType cc = 0; cc < ghosts->GetNumberOfTuples(); ++cc)
+      {
+        if (ghosts->GetValue(cc) & vtkDataSetAttributes::DUPLICATECELL)
+        {
+          counts.GhostCells++;
+        }
+      }
+    }
+  }
+  return counts;
+}
+}
+
+int TestCGNSReaderSplitZones(int argc, char* argv[])
+{
+  char* fname =
+    vtkTestUtilities::ExpandDataFileName(argc, argv, "Testing/Data/VisItBridge/5blocks.cgns");
+  std::string blocks = fname ? fname : "";
+  delete[] fname;
+
+  vtkNew<vtkCGNSReader> reader;
+  reader->SetFileName(blocks.c_str());
+  reader->Update();
+  const ZoneCounts whole = CountCells(reader->GetOutput());
+  vtk_assert(whole.Grids > 0);
+  vtk_assert(whole.GridsWithGhosts == 0);
+
+  // Without splitting, the pieces after the last zone are empty.
+  const int numberOfPieces = 2 * whole.Grids;
+  reader->UpdatePiece(numberOfPieces - 1, numberOfPieces, 0);
+  vtk_assert(CountCells(reader->GetOutput()).Grids == 0);
+
+  // Each zone is split in two slabs: every piece gets a part of a zone, and
+  // the pieces read every cell exactly once.
+  reader->SplitStructuredZonesOn();
+  vtkIdType cells = 0;
+  for (int piece = 0; piece < numberOfPieces; ++piece)
+  {
+    reader->UpdatePiece(piece, numberOfPieces, 0);
+    const ZoneCounts counts = CountCells(reader->GetOutput());
+    vtk_assert(counts.Grids == 1);
+    vtk_assert(counts.Cells < whole.Cells);
+    vtk_assert(counts.GridsWithGhosts == 0);
+    cells += counts.Cells;
+  }
+  vtk_assert(cells == whole.Cells);
+
+  // With a ghost level, each slab gets a layer of ghost cells from the other
+  // slab of its zone, and the non-ghost cells still cover the zones once.
+  cells = 0;
+  for (int piece = 0; piece < numberOfPieces; ++piece)
+  {
+    reader->UpdatePiece(piece, numberOfPieces, 1);
+    const ZoneCounts counts = CountCells(reader->GetOutput());
+    vtk_assert(counts.Grids == 1);
+    vtk_assert(counts.GridsWithGhosts == 1);
+    vtk_assert(counts.GhostCells > 0);
+    cells += counts.Cells - counts.GhostCells;
+  }
+  vtk_assert(cells == whole.Cells);
+
+  cout << __FILE__ << " tests passed." << endl;
+  return EXIT_SUCCESS;
+}
@@ -29,6 +29,7 @@
 #include "vtkCellData.h"
 #include "vtkCharArray.h"
 #include "vtkDataArraySelection.h"
+#include "vtkDataSetAttributes.h"
 #include "vtkDoubleArray.h"
 #include "vtkErrorCode.h"
 #include "vtkExtractGrid.h"
@@ -50,6 +51,7 @@
 #include "vtkStructuredGrid.h"
 #include "vtkTypeInt32Array.h"
 #include "vtkTypeInt64Array.h"
+#include "vtkUnsignedCharArray.h"
 #include "vtkUnsignedIntArray.h"
 #include "vtkUnstructuredGrid.h"
 #include "vtkVertex.h"
@@ -359,8 +361,91 @@ public:
   }
 
   static std::string GenerateMeshKey(const char* basename, const char* zonename);
+
+  /**
+   * Computes the sub-extent (VTK conventions) of the zone to read for the
+   * current zone piece, including ghost levels. `ghosts` is filled with the
+   * axis that was split and the number of ghost cell layers added on the
+   * low and high sides. Returns false if the piece is empty.
+   */
+  static bool GetZonePieceVOI(
+    int cellDim, const cgsize_t* zsize, vtkCGNSReader* self, int* voi, int* ghosts);
+
+  /**
+   * Flag the ghost cell layers described by `ghosts` (as returned by
+   * GetZonePieceVOI) as duplicate cells.
+   */
+  static void AddGhostCells(vtkStructuredGrid* sgrid, const int* ghosts);
 };
 
+//----------------------------------------------------------------------------
+bool vtkCGNSReader::vtkPrivate::GetZonePieceVOI(
+  int cellDim, const cgsize_t* zsize, vtkCGNSReader* self, int* voi, int* ghosts)
+{
+  // split along the dimension with the most cells.
+  int axis = 0;
+  for (int n = 0; n < 6; n++)
+  {
+    voi[n] = 0;
+  }
+  for (int n = 0; n < cellDim; n++)
+  {
+    voi[2 * n + 1] = static_cast<int>(zsize[n] - 1);
+    if (zsize[n] > zsize[axis])
+    {
+      axis = n;
+    }
+  }
+
+  const vtkIdType nCells = static_cast<vtkIdType>(zsize[axis] - 1);
+  const vtkIdType start = (nCells * self->ZonePiece) / self->NumberOfZonePieces;
+  const vtkIdType end = (nCells * (self->ZonePiece + 1)) / self->NumberOfZonePieces;
+  if (start >= end)
+  {
+    return false;
+  }
+
+  const vtkIdType ghostStart = std::max<vtkIdType>(start - self->NumberOfGhostLevels, 0);
+  const vtkIdType ghostEnd = std::min<vtkIdType>(end + self->NumberOfGhostLevels, nCells);
+  voi[2 * axis] = static_cast<int>(ghostStart);
+  voi[2 * axis + 1] = static_cast<int>(ghostEnd);
+  ghosts[0] = axis;
+  ghosts[1] = static_cast<int>(start - ghostStart);
+  ghosts[2] = static_cast<int>(ghostEnd - end);
+  return true;
+}
+
+//----------------------------------------------------------------------------
+void vtkCGNSReader::vtkPrivate::AddGhostCells(vtkStructuredGrid* sgrid, const int* ghosts)
+{
+  if (!sgrid || (ghosts[1] == 0 && ghosts[2] == 0))
+  {
+    return;
+  }
+
+  int dims[3];
+  sgrid->GetDimensions(dims);
+  int cellDims[3];
+  for (int n = 0; n < 3; n++)
+  {
+    cellDims[n] = std::max(dims[n] - 1, 1);
+  }
+
+  const vtkIdType nCells = sgrid->GetNumberOfCells();
+  vtkNew<vtkUnsignedCharArray> ghostArray;
+  ghostArray->SetName(vtkDataSetAttributes::GhostArrayName());
+  ghostArray->SetNumberOfTuples(nCells);
+  for (vtkIdType cellId = 0; cellId < nCells; cellId++)
+  {
+    const vtkIdType ijk[3] = { cellId % cellDims[0], (cellId / cellDims[0]) % cellDims[1],
+      cellId / (static_cast<vtkIdType>(cellDims[0]) * cellDims[1]) };
+    const vtkIdType index = ijk[ghosts[0]];
+    const bool ghost = index < ghosts[1] || index >= cellDims[ghosts[0]] - ghosts[2];
+    ghostArray->SetValue(cellId, ghost ? vtkDataSetAttributes::DUPLICATECELL : 0);
+  }
+  sgrid->GetCellData()->AddArray(ghostArray);
+}
+
 //----------------------------------------------------------------------------
 vtkCGNSReader::vtkCGNSReader()
   : PointDataArraySelection()
@@ -382,6 +467,10 @@ vtkCGNSReader::vtkCGNSReader()
   this->CreateEachSolutionAsBlock = 0;
   this->IgnoreFlowSolutionPointers = false;
   this->DistributeBlocks = true;
+  this->SplitStructuredZones = false;
+  this->ZonePiece = 0;
+  this->NumberOfZonePieces = 1;
+  this->NumberOfGhostLevels = 0;
   this->IgnoreSILChangeEvents = false;
   this->CacheMesh = false;
   this->CacheConnectivity = false;
@@ -1433,9 +1522,21 @@ int vtkCGNSReader::GetCurvilinearZone(
   const char* basename = this->Internal->GetBase(base).name;
   const char* zonename = this->Internal->GetBase(base).zones[zone].name;
 
-  vtkSmartPointer<vtkDataObject> zoneDO = sil->ReadGridForZone(basename, zonename)
-    ? vtkPrivate::readCurvilinearZone(base, zone, cellDim, physicalDim, zsize, nullptr, this)
+  // When the zone is split between pieces, only read our slab of it.
+  const bool splitZone = this->NumberOfZonePieces > 1;
+  int pieceVOI[6];
+  int pieceGhosts[3] = { 0, 0, 0 };
+  const bool emptyPiece =
+    splitZone && !vtkPrivate::GetZonePieceVOI(cellDim, zsize, this, pieceVOI, pieceGhosts);
+
+  vtkSmartPointer<vtkDataObject> zoneDO = (sil->ReadGridForZone(basename, zonename) && !emptyPiece)
+    ? vtkPrivate::readCurvilinearZone(
+        base, zone, cellDim, physicalDim, zsize, splitZone ? pieceVOI : nullptr, this)
     : vtkSmartPointer<vtkDataObject>();
+  if (splitZone)
+  {
+    vtkPrivate::AddGhostCells(vtkStructuredGrid::SafeDownCast(zoneDO), pieceGhosts);
+  }
   mbase->SetBlock(zone, zoneDO.Get());
 
   //----------------------------------------------------------------------------
@@ -1482,9 +1583,21 @@ int vtkCGNSReader::GetCurvilinearZone(
             if (sil->ReadPatch(basename, zonename, binfo.Name))
             {
               const unsigned int idx = patchesMB->GetNumberOfBlocks();
-              vtkSmartPointer<vtkDataSet> ds = zoneGrid
-                ? binfo.CreateDataSet(cellDim, zoneGrid)
-                : vtkPrivate::readBCDataSet(binfo, base, zone, cellDim, physicalDim, zsize, this);
+              vtkSmartPointer<vtkDataSet> ds;
+              if (splitZone)
+              {
+                // patches of a split zone are read by the first piece only, the
+                // others keep an empty block to preserve the output structure.
+                ds = this->ZonePiece == 0
+                  ? vtkPrivate::readBCDataSet(binfo, base, zone, cellDim, physicalDim, zsize, this)
+                  : vtkSmartPointer<vtkDataSet>();
+              }
+              else
+              {
+                ds = zoneGrid
+                  ? binfo.CreateDataSet(cellDim, zoneGrid)
+                  : vtkPrivate::readBCDataSet(binfo, base, zone, cellDim, physicalDim, zsize, this);
+              }
               vtkPrivate::AddIsPatchArray(ds, true);
               patchesMB->SetBlock(idx, ds);
 
@@ -1876,24 +1989,25 @@ int vtkCGNSReader::GetUnstructuredZone(
     // else create new grid
     const char* basename = this->Internal->GetBase(base).name;
     const char* zonename = this->Internal->GetBase(base).zones[zone].name;
-    // build a key /basename/zonename
-    std::ostringstream query;
-    query << "/" << basename << "/" << zonename << "/core";
-    keyConnect = query.str();
+    // build a key /basename/zonename/core
+    keyConnect = vtkPrivate::GenerateMeshKey(basename, zonename) + "/core";
 
-    ugrid = this->ConnectivitiesCache.Find(keyConnect);
-    if (ugrid.Get() != nullptr)
+    vtkSmartPointer<vtkUnstructuredGrid> cachedGrid = this->ConnectivitiesCache.Find(keyConnect);
+    if (cachedGrid.Get() != nullptr)
     {
-      if ((ugrid->GetNumberOfCells() != numCoreCells && !hasNGon) ||
-        (ugrid->GetNumberOfCells() != zsize[1] && hasNGon))
+      if ((cachedGrid->GetNumberOfCells() != numCoreCells && !hasNGon) ||
+        (cachedGrid->GetNumberOfCells() != zsize[1] && hasNGon))
       {
         vtkWarningMacro(<< "Connectivities from the cache have"
                            " a different number of cells from"
                            " those being read, ditching the cache");
-        ugrid = nullptr;
       }
       else
       {
+        // Share the cached connectivity in a new grid so that the solution
+        // arrays of this time step are not attached to the cached mesh.
+        ugrid = vtkSmartPointer<vtkUnstructuredGrid>::New();
+        ugrid->CopyStructure(cachedGrid);
         ugrid->SetPoints(points.Get());
       }
     }
@@ -2354,7 +2468,9 @@ int vtkCGNSReader::GetUnstructuredZone(
     }
     if (caching)
     {
-      this->ConnectivitiesCache.Insert(keyConnect, ugrid);
+      vtkNew<vtkUnstructuredGrid> cachedGrid;
+      cachedGrid->CopyStructure(ugrid);
+      this->ConnectivitiesCache.Insert(keyConnect, cachedGrid.Get());
     }
   }
   //
@@ -2418,170 +2534,197 @@ int vtkCGNSReader::GetUnstructuredZone(
 
       mpatch->GetMetaData(static_cast<unsigned int>(bndNum))
         ->Set(vtkCompositeDataSet::NAME(), sectionInfoList[sec].name);
-      elementSize = end - start + 1; // Bnd Volume + Bnd
-      if (start < zsize[1])
-      {
-        vtkErrorMacro(<< "ERROR:: Internal Section\n");
+      // Boundary patches connectivity is time invariant as well.
+      vtkSmartPointer<vtkUnstructuredGrid> bndugrid;
+      std::string keyPatch;
+      if (caching)
+      {
+        const char* zonename = this->Internal->GetBase(base).zones[zone].name;
+        keyPatch = vtkPrivate::GenerateMeshKey(basename, zonename) + "/patch/" +
+          sectionInfoList[sec].name;
+        vtkSmartPointer<vtkUnstructuredGrid> cachedPatch = this->ConnectivitiesCache.Find(keyPatch);
+        if (cachedPatch.Get() != nullptr)
+        {
+          bndugrid = vtkSmartPointer<vtkUnstructuredGrid>::New();
+          bndugrid->CopyStructure(cachedPatch);
+          bndugrid->SetPoints(points);
+        }
       }
 
-      int* bndCellsTypes = new int[elementSize];
-      if (bndCellsTypes == 0)
+      if (bndugrid.Get() == nullptr)
       {
-        vtkErrorMacro(<< "Could not allocate memory for connectivity\n");
-        return 1;
-      }
-
-      cgsize_t eDataSize = 0;
-      cgsize_t EltsEnd = elementSize + start - 1;
-      eDataSize = sectionInfoList[sec].eDataSize;
-
-      vtkDebugMacro(<< "Element data size for sec " << sec << " is: " << eDataSize << "\n");
-      //
-      cgsize_t elementBndSize = 0;
-      elementBndSize = eDataSize;
-      vtkIdTypeArray* IdBndArray_ptr = vtkIdTypeArray::New();
-      vtkIdType* bndElements = NULL;
-
-      double cgioSectionId;
-      cgioSectionId = elemIdList[sec];
-      //
-      if (elemType != CGNS_ENUMV(MIXED) && elemType != CGNS_ENUMV(NGON_n) &&
-        elemType != CGNS_ENUMV(NFACE_n))
-      {
-        // All cells are of the same type.
-        int numPointsPerCell = 0;
-        int cellType;
-        bool higherOrderWarning;
-        bool reOrderElements;
-        //
-        if (cg_npe(elemType, &numPointsPerCell) || numPointsPerCell == 0)
+        elementSize = end - start + 1; // Bnd Volume + Bnd
+        if (start < zsize[1])
         {
-          vtkErrorMacro(<< "Invalid numPointsPerCell\n");
+          vtkErrorMacro(<< "ERROR:: Internal Section\n");
         }
 
-        cellType = CGNSRead::GetVTKElemType(elemType, higherOrderWarning, reOrderElements);
-        //
-        for (vtkIdType i = 0; i < elementSize; ++i)
+        int* bndCellsTypes = new int[elementSize];
+        if (bndCellsTypes == 0)
         {
-          bndCellsTypes[i] = cellType;
-        }
-        //
-        elementBndSize = (numPointsPerCell + 1) * elementSize;
-        IdBndArray_ptr->SetNumberOfValues(elementBndSize);
-        bndElements = IdBndArray_ptr->GetPointer(0);
-        if (bndElements == 0)
-        {
-          vtkErrorMacro(<< "Could not allocate memory for bnd connectivity\n");
+          vtkErrorMacro(<< "Could not allocate memory for connectivity\n");
           return 1;
         }
 
-        if (eDataSize != numPointsPerCell * elementSize)
+        cgsize_t eDataSize = 0;
+        cgsize_t EltsEnd = elementSize + start - 1;
+        eDataSize = sectionInfoList[sec].eDataSize;
+
+        vtkDebugMacro(<< "Element data size for sec " << sec << " is: " << eDataSize << "\n");
+        //
+        cgsize_t elementBndSize = 0;
+        elementBndSize = eDataSize;
+        vtkIdTypeArray* IdBndArray_ptr = vtkIdTypeArray::New();
+        vtkIdType* bndElements = NULL;
+
+        double cgioSectionId;
+        cgioSectionId = elemIdList[sec];
+        //
+        if (elemType != CGNS_ENUMV(MIXED) && elemType != CGNS_ENUMV(NGON_n) &&
+          elemType != CGNS_ENUMV(NFACE_n))
         {
-          vtkErrorMacro(<< "Wrong elements dimensions\n");
-        }
+          // All cells are of the same type.
+          int numPointsPerCell = 0;
+          int cellType;
+          bool higherOrderWarning;
+          bool reOrderElements;
+          //
+          if (cg_npe(elemType, &numPointsPerCell) || numPointsPerCell == 0)
+          {
+            vtkErrorMacro(<< "Invalid numPointsPerCell\n");
+          }
 
-        // pointer on start !!
-        vtkIdType* locElements = &(bndElements[0]);
+          cellType = CGNSRead::GetVTKElemType(elemType, higherOrderWarning, reOrderElements);
+          //
+          for (vtkIdType i = 0; i < elementSize; ++i)
+          {
+            bndCellsTypes[i] = cellType;
+          }
+          //
+          elementBndSize = (numPointsPerCell + 1) * elementSize;
+          IdBndArray_ptr->SetNumberOfValues(elementBndSize);
+          bndElements = IdBndArray_ptr->GetPointer(0);
+          if (bndElements == 0)
+          {
+            vtkErrorMacro(<< "Could not allocate memory for bnd connectivity\n");
+            return 1;
+          }
 
-        cgsize_t memDim[2];
-        cgsize_t npe = numPointsPerCell;
+          if (eDataSize != numPointsPerCell * elementSize)
+          {
+            vtkErrorMacro(<< "Wrong elements dimensions\n");
+          }
 
-        srcStart[0] = 1;
-        srcStart[1] = 1;
+          // pointer on start !!
+          vtkIdType* locElements = &(bndElements[0]);
 
-        srcEnd[0] = (EltsEnd - start + 1) * npe;
-        srcStride[0] = 1;
+          cgsize_t memDim[2];
+          cgsize_t npe = numPointsPerCell;
 
-        memStart[0] = 2;
-        memStart[1] = 1;
-        memEnd[0] = npe + 1;
-        memEnd[1] = EltsEnd - start + 1;
-        memStride[0] = 1;
-        memStride[1] = 1;
-        memDim[0] = npe + 1;
-        memDim[1] = EltsEnd - start + 1;
+          srcStart[0] = 1;
+          srcStart[1] = 1;
 
-        CGNSRead::get_section_connectivity(this->cgioNum, cgioSectionId, 2, srcStart, srcEnd,
-          srcStride, memStart, memEnd, memStride, memDim, locElements);
+          srcEnd[0] = (EltsEnd - start + 1) * npe;
+          srcStride[0] = 1;
 
-        // Add numptspercell and do -1 on indexes
-        for (vtkIdType icell = 0; icell < elementSize; ++icell)
-        {
-          vtkIdType pos = icell * (numPointsPerCell + 1);
-          locElements[pos] = static_cast<vtkIdType>(numPointsPerCell);
-          for (vtkIdType ip = 0; ip < numPointsPerCell; ip++)
+          memStart[0] = 2;
+          memStart[1] = 1;
+          memEnd[0] = npe + 1;
+          memEnd[1] = EltsEnd - start + 1;
+          memStride[0] = 1;
+          memStride[1] = 1;
+          memDim[0] = npe + 1;
+          memDim[1] = EltsEnd - start + 1;
+
+          CGNSRead::get_section_connectivity(this->cgioNum, cgioSectionId, 2, srcStart, srcEnd,
+            srcStride, memStart, memEnd, memStride, memDim, locElements);
+
+          // Add numptspercell and do -1 on indexes
+          for (vtkIdType icell = 0; icell < elementSize; ++icell)
           {
-            pos++;
-            locElements[pos] = locElements[pos] - 1;
+            vtkIdType pos = icell * (numPointsPerCell + 1);
+            locElements[pos] = static_cast<vtkIdType>(numPointsPerCell);
+            for (vtkIdType ip = 0; ip < numPointsPerCell; ip++)
+            {
+              pos++;
+              locElements[pos] = locElements[pos] - 1;
+            }
           }
         }
-      }
-      else if (elemType == CGNS_ENUMV(MIXED))
-      {
-        //
-        // all cells are of the same type.
-        int numPointsPerCell = 0;
-        int cellType;
-        bool higherOrderWarning;
-        bool reOrderElements;
-        // pointer on start !!
+        else if (elemType == CGNS_ENUMV(MIXED))
+        {
+          //
+          // all cells are of the same type.
+          int numPointsPerCell = 0;
+          int cellType;
+          bool higherOrderWarning;
+          bool reOrderElements;
+          // pointer on start !!
 
-        IdBndArray_ptr->SetNumberOfValues(elementBndSize);
-        bndElements = IdBndArray_ptr->GetPointer(0);
+          IdBndArray_ptr->SetNumberOfValues(elementBndSize);
+          bndElements = IdBndArray_ptr->GetPointer(0);
 
-        if (bndElements == 0)
-        {
-          vtkErrorMacro(<< "Could not allocate memory for bnd connectivity\n");
-          return 1;
-        }
-        //
-        vtkIdType* localElements = &(bndElements[0]);
+          if (bndElements == 0)
+          {
+            vtkErrorMacro(<< "Could not allocate memory for bnd connectivity\n");
+            return 1;
+          }
+          //
+          vtkIdType* localElements = &(bndElements[0]);
 
-        cgsize_t memDim[2];
+          cgsize_t memDim[2];
 
-        srcStart[0] = 1;
-        srcEnd[0] = eDataSize;
-        srcStride[0] = 1;
+          srcStart[0] = 1;
+          srcEnd[0] = eDataSize;
+          srcStride[0] = 1;
 
-        memStart[0] = 1;
-        memStart[1] = 1;
-        memEnd[0] = eDataSize;
-        memEnd[1] = 1;
-        memStride[0] = 1;
-        memStride[1] = 1;
-        memDim[0] = eDataSize;
-        memDim[1] = 1;
+          memStart[0] = 1;
+          memStart[1] = 1;
+          memEnd[0] = eDataSize;
+          memEnd[1] = 1;
+          memStride[0] = 1;
+          memStride[1] = 1;
+          memDim[0] = eDataSize;
+          memDim[1] = 1;
 
-        CGNSRead::get_section_connectivity(this->cgioNum, cgioSectionId, 1, srcStart, srcEnd,
-          srcStride, memStart, memEnd, memStride, memDim, localElements);
-        vtkIdType pos = 0;
-        for (vtkIdType icell = 0; icell < elementSize; ++icell)
-        {
-          elemType = static_cast<CGNS_ENUMT(ElementType_t)>(localElements[pos]);
-          cg_npe(elemType, &numPointsPerCell);
-          cellType = CGNSRead::GetVTKElemType(elemType, higherOrderWarning, reOrderElements);
-          bndCellsTypes[icell] = cellType;
-          localElements[pos] = static_cast<vtkIdType>(numPointsPerCell);
-          pos++;
-          for (vtkIdType ip = 0; ip < numPointsPerCell; ip++)
+          CGNSRead::get_section_connectivity(this->cgioNum, cgioSectionId, 1, srcStart, srcEnd,
+            srcStride, memStart, memEnd, memStride, memDim, localElements);
+          vtkIdType pos = 0;
+          for (vtkIdType icell = 0; icell < elementSize; ++icell)
           {
-            localElements[ip + pos] = localElements[ip + pos] - 1;
+            elemType = static_cast<CGNS_ENUMT(ElementType_t)>(localElements[pos]);
+            cg_npe(elemType, &numPointsPerCell);
+            cellType = CGNSRead::GetVTKElemType(elemType, higherOrderWarning, reOrderElements);
+            bndCellsTypes[icell] = cellType;
+            localElements[pos] = static_cast<vtkIdType>(numPointsPerCell);
+            pos++;
+            for (vtkIdType ip = 0; ip < numPointsPerCell; ip++)
+            {
+              localElements[ip + pos] = localElements[ip + pos] - 1;
+            }
+            pos += numPointsPerCell;
           }
-          pos += numPointsPerCell;
         }
-      }
 
-      // Create Cell Array
-      vtkCellArray* bndCells = vtkCellArray::New();
-      bndCells->SetCells(elementSize, IdBndArray_ptr);
-      IdBndArray_ptr->Delete();
-      // Set up ugrid
-      // Create an unstructured grid to contain the points.
-      vtkUnstructuredGrid* bndugrid = vtkUnstructuredGrid::New();
-      bndugrid->SetPoints(points);
-      bndugrid->SetCells(bndCellsTypes, bndCells);
-      bndCells->Delete();
-      delete[] bndCellsTypes;
+        // Create Cell Array
+        vtkCellArray* bndCells = vtkCellArray::New();
+        bndCells->SetCells(elementSize, IdBndArray_ptr);
+        IdBndArray_ptr->Delete();
+        // Set up ugrid
+        // Create an unstructured grid to contain the points.
+        bndugrid = vtkSmartPointer<vtkUnstructuredGrid>::New();
+        bndugrid->SetPoints(points);
+        bndugrid->SetCells(bndCellsTypes, bndCells);
+        bndCells->Delete();
+        delete[] bndCellsTypes;
+
+        if (caching)
+        {
+          vtkNew<vtkUnstructuredGrid> cachedPatch;
+          cachedPatch->CopyStructure(bndugrid);
+          this->ConnectivitiesCache.Insert(keyPatch, cachedPatch.Get());
+        }
+      }
 
       //
       // Add ispatch 0=false/1=true as field data
@@ -2603,7 +2746,6 @@ int vtkCGNSReader::GetUnstructuredZone(
         }
       }
       mpatch->SetBlock(bndNum, bndugrid);
-      bndugrid->Delete();
       bndNum++;
     }
     mzone->SetBlock(1, mpatch);
@@ -2722,6 +2864,45 @@ int vtkCGNSReader::RequestData(vtkInformation* vtkNotUsed(request),
     }
   }
 
+  // When there are more pieces than zones, each zone is split between a group
+  // of consecutive pieces instead of leaving the extra pieces empty.
+  this->ZonePiece = 0;
+  this->NumberOfZonePieces = 1;
+  this->NumberOfGhostLevels = 0;
+  if (this->SplitStructuredZones && numZones > 0 && numProcessors > numZones)
+  {
+    const int globalZone = static_cast<int>(
+      (static_cast<vtkIdType>(processNumber) * numZones) / numProcessors);
+    int firstPiece = -1;
+    int numberOfPieces = 0;
+    for (int piece = 0; piece < numProcessors; ++piece)
+    {
+      if ((static_cast<vtkIdType>(piece) * numZones) / numProcessors == globalZone)
+      {
+        firstPiece = firstPiece < 0 ? piece : firstPiece;
+        numberOfPieces++;
+      }
+    }
+    this->ZonePiece = processNumber - firstPiece;
+    this->NumberOfZonePieces = numberOfPieces;
+    this->NumberOfGhostLevels =
+      outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_NUMBER_OF_GHOST_LEVELS());
+
+    int accumulated = 0;
+    for (int bb = 0; bb < numBases; bb++)
+    {
+      duo_t zoneRange;
+      const int baseZones = this->Internal->GetBase(bb).nzones;
+      if (globalZone >= accumulated && globalZone < accumulated + baseZones)
+      {
+        zoneRange[0] = globalZone - accumulated;
+        zoneRange[1] = zoneRange[0] + 1;
+      }
+      accumulated += baseZones;
+      baseToZoneRange[bb] = zoneRange;
+    }
+  }
+
   // Bnd Sections Not implemented yet for parallel
   if (numProcessors > 1)
   {
@@ -3012,6 +3193,11 @@ int vtkCGNSReader::RequestData(vtkInformation* vtkNotUsed(request),
           break;
         }
         case CGNS_ENUMV(Unstructured):
+          if (this->ZonePiece != 0)
+          {
+            // unstructured zones are not split, the first piece reads it.
+            break;
+          }
           ier = GetUnstructuredZone(numBase, zone, cellDim, physicalDim, zsize, mbase);
           if (ier != CG_OK)
           {
@@ -3141,6 +3327,7 @@ void vtkCGNSReader::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "CreateEachSolutionAsBlock: " << this->CreateEachSolutionAsBlock << endl;
   os << indent << "IgnoreFlowSolutionPointers: " << this->IgnoreFlowSolutionPointers << endl;
   os << indent << "DistributeBlocks: " << this->DistributeBlocks << endl;
+  os << indent << "SplitStructuredZones: " << this->SplitStructuredZones << endl;
   os << indent << "Controller: " << this->Controller << endl;
 }
 
@@ -212,6 +212,19 @@ public:
   vtkGetMacro(DistributeBlocks, bool);
   vtkBooleanMacro(DistributeBlocks, bool);
 
+  /**
+   * When the reader is asked for more pieces than there are zones, split each
+   * structured zone between a group of pieces, each one reading a slab of the
+   * zone (along its largest dimension) using partial reads, instead of leaving
+   * the extra pieces empty. Requested ghost levels are honored by extending the
+   * slabs and flagging the extra cells as duplicate ghost cells. Unstructured
+   * zones are still read by a single piece of their group.
+   * Default is false.
+   */
+  vtkSetMacro(SplitStructuredZones, bool);
+  vtkGetMacro(SplitStructuredZones, bool);
+  vtkBooleanMacro(SplitStructuredZones, bool);
+
   //@{
   /**
    * This reader can cache the mesh points if they are time invariant.
@@ -305,6 +318,7 @@ private:
   int CreateEachSolutionAsBlock; // debug option to create
   bool IgnoreFlowSolutionPointers;
   bool DistributeBlocks;
+  bool SplitStructuredZones;
   bool CacheMesh;
   bool CacheConnectivity;
 
@@ -316,6 +330,12 @@ private:
   unsigned int NumberOfBases;
   int ActualTimeStep;
 
+  // Piece of the zone being read, when zones are split between pieces
+  // (see SplitStructuredZones).
+  int ZonePiece;
+  int NumberOfZonePieces;
+  int NumberOfGhostLevels;
+
   class vtkPrivate;
   friend class vtkPrivate;
 
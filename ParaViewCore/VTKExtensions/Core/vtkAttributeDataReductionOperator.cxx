@@ -0,0 +1,239 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    vtkAttributeDataReductionOperator.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkAttributeDataReductionOperator.h"
+
+#include "vtkAttributeDataReductionFilter.h"
+#include "vtkCellData.h"
+#include "vtkDataArray.h"
+#include "vtkDataSet.h"
+#include "vtkDoubleArray.h"
+#include "vtkObjectFactory.h"
+#include "vtkPointData.h"
+#include "vtkSmartPointer.h"
+#include "vtkTable.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace
+{
+// Returns the attributes of `data` to reduce, in a stable order.
+std::vector<vtkDataSetAttributes*> vtkGetReducedAttributes(vtkDataObject* data, int attributeType)
+{
+  std::vector<vtkDataSetAttributes*> attributes;
+  if (vtkDataSet* ds = vtkDataSet::SafeDownCast(data))
+  {
+    if (attributeType & vtkAttributeDataReductionFilter::POINT_DATA)
+    {
+      attributes.push_back(ds->GetPointData());
+    }
+    if (attributeType & vtkAttributeDataReductionFilter::CELL_DATA)
+    {
+      attributes.push_back(ds->GetCellData());
+    }
+  }
+  else if (vtkTable* table = vtkTable::SafeDownCast(data))
+  {
+    if (attributeType & vtkAttributeDataReductionFilter::ROW_DATA)
+    {
+      attributes.push_back(table->GetRowData());
+    }
+  }
+  return attributes;
+}
+
+// FNV-1a, used to compare array layouts across processes.
+void vtkHashBytes(vtkTypeUInt32& hash, const void* bytes, size_t length)
+{
+  const unsigned char* cbytes = static_cast<const unsigned char*>(bytes);
+  for (size_t cc = 0; cc < length; ++cc)
+  {
+    hash = (hash ^ cbytes[cc]) * 16777619u;
+  }
+}
+}
+
+vtkStandardNewMacro(vtkAttributeDataReductionOperator);
+//-----------------------------------------------------------------------------
+vtkAttributeDataReductionOperator::vtkAttributeDataReductionOperator()
+{
+  this->AttributeType = vtkAttributeDataReductionFilter::POINT_DATA |
+    vtkAttributeDataReductionFilter::CELL_DATA | vtkAttributeDataReductionFilter::ROW_DATA;
+  this->ReductionType = vtkAttributeDataReductionFilter::ADD;
+}
+
+//-----------------------------------------------------------------------------
+vtkAttributeDataReductionOperator::~vtkAttributeDataReductionOperator()
+{
+}
+
+//-----------------------------------------------------------------------------
+bool vtkAttributeDataReductionOperator::Pack(vtkDataObject* data, vtkDoubleArray* buffer)
+{
+  std::vector<vtkDataSetAttributes*> attributes =
+    vtkGetReducedAttributes(data, this->AttributeType);
+  if (attributes.empty())
+  {
+    return false;
+  }
+
+  vtkIdType size = 0;
+  for (vtkDataSetAttributes* dsa : attributes)
+  {
+    for (int cc = 0, max = dsa->GetNumberOfArrays(); cc < max; ++cc)
+    {
+      if (vtkDataArray* array = dsa->GetArray(cc))
+      {
+        size += array->GetNumberOfValues();
+      }
+    }
+  }
+
+  buffer->SetNumberOfComponents(1);
+  buffer->SetNumberOfTuples(size);
+  double* values = buffer->GetPointer(0);
+  for (vtkDataSetAttributes* dsa : attributes)
+  {
+    for (int cc = 0, max = dsa->GetNumberOfArrays(); cc < max; ++cc)
+    {
+      vtkDataArray* array = dsa->GetArray(cc);
+      if (!array)
+      {
+        continue;
+      }
+      const int numComps = array->GetNumberOfComponents();
+      for (vtkIdType tuple = 0, numTuples = array->GetNumberOfTuples(); tuple < numTuples; ++tuple)
+      {
+        for (int comp = 0; comp < numComps; ++comp)
+        {
+          *values++ = array->GetComponent(tuple, comp);
+        }
+      }
+    }
+  }
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+vtkTypeUInt32 vtkAttributeDataReductionOperator::GetLayoutSignature(vtkDataObject* data)
+{
+  vtkTypeUInt32 hash = 2166136261u;
+  for (vtkDataSetAttributes* dsa : vtkGetReducedAttributes(data, this->AttributeType))
+  {
+    for (int cc = 0, max = dsa->GetNumberOfArrays(); cc < max; ++cc)
+    {
+      vtkDataArray* array = dsa->GetArray(cc);
+      if (!array)
+      {
+        continue;
+      }
+      const char* name = array->GetName() ? array->GetName() : "";
+      vtkHashBytes(hash, name, strlen(name) + 1);
+      const vtkIdType layout[2] = { array->GetNumberOfTuples(), array->GetNumberOfComponents() };
+      vtkHashBytes(hash, layout, sizeof(layout));
+    }
+  }
+  return hash;
+}
+
+//-----------------------------------------------------------------------------
+void vtkAttributeDataReductionOperator::InitializeBuffer(double* buffer, vtkIdType size)
+{
+  double identity = 0.0;
+  switch (this->ReductionType)
+  {
+    case vtkAttributeDataReductionFilter::MAX:
+      identity = VTK_DOUBLE_MIN;
+      break;
+    case vtkAttributeDataReductionFilter::MIN:
+      identity = VTK_DOUBLE_MAX;
+      break;
+  }
+  std::fill_n(buffer, size, identity);
+}
+
+//-----------------------------------------------------------------------------
+void vtkAttributeDataReductionOperator::Combine(
+  const double* source, double* target, vtkIdType size)
+{
+  switch (this->ReductionType)
+  {
+    case vtkAttributeDataReductionFilter::ADD:
+      for (vtkIdType cc = 0; cc < size; ++cc)
+      {
+        target[cc] += source[cc];
+      }
+      break;
+
+    case vtkAttributeDataReductionFilter::MAX:
+      for (vtkIdType cc = 0; cc < size; ++cc)
+      {
+        target[cc] = std::max(target[cc], source[cc]);
+      }
+      break;
+
+    case vtkAttributeDataReductionFilter::MIN:
+      for (vtkIdType cc = 0; cc < size; ++cc)
+      {
+        target[cc] = std::min(target[cc], source[cc]);
+      }
+      break;
+  }
+}
+
+//-----------------------------------------------------------------------------
+void vtkAttributeDataReductionOperator::Unpack(
+  vtkDoubleArray* buffer, vtkDataObject* data, vtkDataObject* output)
+{
+  output->ShallowCopy(data);
+
+  // arrays are shared with `data` after the shallow copy, replace the reduced
+  // ones with new arrays.
+  const double* values = buffer->GetPointer(0);
+  for (vtkDataSetAttributes* dsa : vtkGetReducedAttributes(output, this->AttributeType))
+  {
+    for (int cc = 0, max = dsa->GetNumberOfArrays(); cc < max; ++cc)
+    {
+      vtkDataArray* array = dsa->GetArray(cc);
+      if (!array)
+      {
+        continue;
+      }
+      vtkSmartPointer<vtkDataArray> reduced;
+      reduced.TakeReference(array->NewInstance());
+      reduced->DeepCopy(array);
+      reduced->SetName(array->GetName());
+      const int numComps = reduced->GetNumberOfComponents();
+      for (vtkIdType tuple = 0, numTuples = reduced->GetNumberOfTuples(); tuple < numTuples;
+           ++tuple)
+      {
+        for (int comp = 0; comp < numComps; ++comp)
+        {
+          reduced->SetComponent(tuple, comp, *values++);
+        }
+      }
+      dsa->AddArray(reduced);
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+void vtkAttributeDataReductionOperator::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "AttributeType: " << this->AttributeType << endl;
+  os << indent << "ReductionType: " << this->ReductionType << endl;
+}
@@ -0,0 +1,77 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    vtkAttributeDataReductionOperator.h
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkAttributeDataReductionOperator
+ * @brief   Sums, maxes or mins attribute arrays across processes.
+ *
+ * vtkAttributeDataReductionOperator is the vtkReductionOperator counterpart of
+ * vtkAttributeDataReductionFilter. It reduces the values of the point, cell
+ * and/or row data arrays of datasets with the same structure on all
+ * processes, without gathering the datasets. All other attributes are taken
+ * from the local dataset.
+ *
+ * @sa vtkAttributeDataReductionFilter, vtkReductionFilter
+*/
+
+#ifndef vtkAttributeDataReductionOperator_h
+#define vtkAttributeDataReductionOperator_h
+
+#include "vtkPVVTKExtensionsCoreModule.h" // needed for export macro
+#include "vtkReductionOperator.h"
+
+class VTKPVVTKEXTENSIONSCORE_EXPORT vtkAttributeDataReductionOperator : public vtkReductionOperator
+{
+public:
+  static vtkAttributeDataReductionOperator* New();
+  vtkTypeMacro(vtkAttributeDataReductionOperator, vtkReductionOperator);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  //@{
+  /**
+   * Set the attributes to reduce, using vtkAttributeDataReductionFilter's
+   * AttributeTypes. Default is (POINT_DATA|CELL_DATA|ROW_DATA).
+   */
+  vtkSetMacro(AttributeType, int);
+  vtkGetMacro(AttributeType, int);
+  //@}
+
+  //@{
+  /**
+   * Set the reduction type, using vtkAttributeDataReductionFilter's
+   * ReductionTypes. Default is ADD.
+   */
+  vtkSetMacro(ReductionType, int);
+  vtkGetMacro(ReductionType, int);
+  //@}
+
+  bool Pack(vtkDataObject* data, vtkDoubleArray* buffer) override;
+  vtkTypeUInt32 GetLayoutSignature(vtkDataObject* data) override;
+  void InitializeBuffer(double* buffer, vtkIdType size) override;
+  void Combine(const double* source, double* target, vtkIdType size) override;
+  void Unpack(vtkDoubleArray* buffer, vtkDataObject* data, vtkDataObject* output) override;
+
+protected:
+  vtkAttributeDataReductionOperator();
+  ~vtkAttributeDataReductionOperator() override;
+
+  int AttributeType;
+  int ReductionType;
+
+private:
+  vtkAttributeDataReductionOperator(const vtkAttributeDataReductionOperator&) = delete;
+  void operator=(const vtkAttributeDataReductionOperator&) = delete;
+};
+
+#endif
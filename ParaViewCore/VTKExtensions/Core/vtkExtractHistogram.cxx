@@ -14,9 +14,11 @@
 =========================================================================*/
 #include "vtkExtractHistogram.h"
 
+#include "vtkArrayDispatch.h"
 #include "vtkCellData.h"
 #include "vtkCompositeDataIterator.h"
 #include "vtkCompositeDataSet.h"
+#include "vtkDataArrayAccessor.h"
 #include "vtkDataSet.h"
 #include "vtkDoubleArray.h"
 #include "vtkGraph.h"
@@ -27,10 +29,14 @@
 #include "vtkMath.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkTable.h"
+#include "vtkUnsignedCharArray.h"
 
+#include <algorithm>
 #include <map>
 #include <string>
 #include <vector>
@@ -39,7 +45,12 @@ struct vtkEHInternals
 {
   vtkEHInternals()
     : FieldAssociation(-1)
+    , RangeValid(false)
+    , RangeInputMTime(0)
+    , RangeFilterMTime(0)
   {
+    this->Range[0] = VTK_DOUBLE_MAX;
+    this->Range[1] = -VTK_DOUBLE_MAX;
   }
   struct ArrayValuesType
   {
@@ -50,6 +61,13 @@ struct vtkEHInternals
   typedef std::map<std::string, ArrayValuesType> ArrayMapType;
   ArrayMapType ArrayValues;
   int FieldAssociation;
+
+  // The input array range determined by the last execution. It is reused
+  // while neither the input nor the filter have been modified.
+  double Range[2];
+  bool RangeValid;
+  vtkMTimeType RangeInputMTime;
+  vtkMTimeType RangeFilterMTime;
 };
 
 vtkStandardNewMacro(vtkExtractHistogram);
@@ -213,6 +231,14 @@ bool vtkExtractHistogram::GetInputArrayRange(vtkInformationVector** inputVector,
   return true;
 }
 
+//-----------------------------------------------------------------------------
+bool vtkExtractHistogram::CanReuseInputArrayRange(vtkDataObject* input)
+{
+  return this->Internal->RangeValid && input &&
+    this->Internal->RangeInputMTime == input->GetMTime() &&
+    this->Internal->RangeFilterMTime == this->GetMTime();
+}
+
 //-----------------------------------------------------------------------------
 bool vtkExtractHistogram::InitializeBinExtents(
   vtkInformationVector** inputVector, vtkDoubleArray* bin_extents, double& min, double& max)
@@ -224,11 +250,17 @@ bool vtkExtractHistogram::InitializeBinExtents(
   // Keeping the column name constant causes less issues in the GUI.
   bin_extents->SetName("bin_extents");
 
+  vtkDataObject* input = vtkDataObject::GetData(inputVector[0], 0);
   if (this->UseCustomBinRanges)
   {
     range[0] = this->CustomBinRanges[0];
     range[1] = this->CustomBinRanges[1];
   }
+  else if (this->CanReuseInputArrayRange(input))
+  {
+    range[0] = this->Internal->Range[0];
+    range[1] = this->Internal->Range[1];
+  }
   else if (!this->GetInputArrayRange(inputVector, range) || (range[0] > range[1]))
   {
     // We don't flag this as error since the array may just be missing for
@@ -236,8 +268,17 @@ bool vtkExtractHistogram::InitializeBinExtents(
     vtkDebugMacro("Could not determine array range. "
                   "The chosen array or component may not be available or "
                   "has invalid range");
+    this->Internal->RangeValid = false;
     return false;
   }
+  else
+  {
+    this->Internal->Range[0] = range[0];
+    this->Internal->Range[1] = range[1];
+    this->Internal->RangeValid = true;
+    this->Internal->RangeInputMTime = input ? input->GetMTime() : 0;
+    this->Internal->RangeFilterMTime = this->GetMTime();
+  }
 
   // Calculate the extents of each bin, based on the range of values in the
   // input ...
@@ -283,6 +324,125 @@ inline int vtkExtractHistogramClamp(int value, int min, int max)
   return value;
 }
 
+namespace
+{
+// Counts the values of an array into bins. Each thread counts into its own
+// bins, which are added to Bins at the end of every vtkSMPTools::For.
+template <typename ArrayT>
+class vtkExtractHistogramBinFunctor
+{
+  ArrayT* Array;
+  vtkUnsignedCharArray* Ghosts;
+  unsigned char GhostMask;
+  int Component;
+  int BinCount;
+  double Min;
+  double Offset;
+  double BinDelta;
+  vtkSMPThreadLocal<std::vector<vtkIdType> > LocalBins;
+
+public:
+  std::vector<vtkIdType> Bins;
+
+  vtkExtractHistogramBinFunctor(ArrayT* array, vtkUnsignedCharArray* ghosts,
+    unsigned char ghostMask, int component, int binCount, double min, double offset,
+    double binDelta)
+    : Array(array)
+    , Ghosts(ghosts)
+    , GhostMask(ghostMask)
+    , Component(component)
+    , BinCount(binCount)
+    , Min(min)
+    , Offset(offset)
+    , BinDelta(binDelta)
+    , Bins(binCount, 0)
+  {
+  }
+
+  void Initialize() { this->LocalBins.Local().assign(this->BinCount, 0); }
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    vtkDataArrayAccessor<ArrayT> accessor(this->Array);
+    std::vector<vtkIdType>& bins = this->LocalBins.Local();
+    const int numComps = this->Array->GetNumberOfComponents();
+    const unsigned char* ghosts = this->Ghosts ? this->Ghosts->GetPointer(0) : nullptr;
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      if (ghosts && (ghosts[i] & this->GhostMask))
+      {
+        continue;
+      }
+      double value;
+      // if component is equal to the number of components, then the magnitude was requested.
+      if (this->Component == numComps)
+      {
+        value = 0;
+        for (int j = 0; j < numComps; ++j)
+        {
+          const double comp = static_cast<double>(accessor.Get(i, j));
+          value += comp * comp;
+        }
+        value = sqrt(value);
+      }
+      else
+      {
+        value = static_cast<double>(accessor.Get(i, this->Component));
+      }
+      int index = static_cast<int>((value - this->Min + this->Offset) / this->BinDelta);
+
+      // If the value is equal to max, include it in the last bin.
+      ++bins[::vtkExtractHistogramClamp(index, 0, this->BinCount - 1)];
+    }
+  }
+
+  void Reduce()
+  {
+    for (auto iter = this->LocalBins.begin(); iter != this->LocalBins.end(); ++iter)
+    {
+      for (int cc = 0; cc < this->BinCount; ++cc)
+      {
+        this->Bins[cc] += (*iter)[cc];
+      }
+      // threads that take no part in the next batch must not be counted again.
+      std::fill(iter->begin(), iter->end(), 0);
+    }
+  }
+};
+
+struct vtkExtractHistogramBinWorker
+{
+  vtkExtractHistogram* Self;
+  vtkUnsignedCharArray* Ghosts;
+  unsigned char GhostMask;
+  int Component;
+  int BinCount;
+  double Min;
+  double Offset;
+  double BinDelta;
+  std::vector<vtkIdType> Bins;
+
+  template <typename ArrayT>
+  void operator()(ArrayT* array)
+  {
+    vtkExtractHistogramBinFunctor<ArrayT> functor(array, this->Ghosts, this->GhostMask,
+      this->Component, this->BinCount, this->Min, this->Offset, this->BinDelta);
+
+    // the values are binned in batches so that progress is reported from
+    // this thread between them.
+    const vtkIdType numTuples = array->GetNumberOfTuples();
+    const vtkIdType batchSize = std::max<vtkIdType>(numTuples / 10, 100000);
+    for (vtkIdType begin = 0; begin < numTuples; begin += batchSize)
+    {
+      const vtkIdType end = std::min(begin + batchSize, numTuples);
+      vtkSMPTools::For(begin, end, functor);
+      this->Self->UpdateProgress(0.10 + 0.90 * end / numTuples);
+    }
+    this->Bins.swap(functor.Bins);
+  }
+};
+}
+
 //-----------------------------------------------------------------------------
 void vtkExtractHistogram::BinAnArray(
   vtkDataArray* data_array, vtkIntArray* bin_values, double min, double max, vtkFieldData* field)
@@ -300,12 +460,50 @@ void vtkExtractHistogram::BinAnArray(
     (max - min) / (this->CenterBinsAroundMinAndMax ? (this->BinCount - 1) : this->BinCount);
   double half_delta = bin_delta / 2.0;
 
+  // Ghost values are counted by the process owning them.
+  const unsigned char ghostMask = vtkPointData::SafeDownCast(field)
+    ? vtkDataSetAttributes::DUPLICATEPOINT
+    : vtkDataSetAttributes::DUPLICATECELL;
+  vtkUnsignedCharArray* ghosts = field
+    ? vtkUnsignedCharArray::SafeDownCast(field->GetArray(vtkDataSetAttributes::GhostArrayName()))
+    : nullptr;
+  if (ghosts && ghosts->GetNumberOfTuples() != num_of_tuples)
+  {
+    ghosts = nullptr;
+  }
+
+  if (!this->CalculateAverages)
+  {
+    vtkExtractHistogramBinWorker worker;
+    worker.Self = this;
+    worker.Ghosts = ghosts;
+    worker.GhostMask = ghostMask;
+    worker.Component = this->Component;
+    worker.BinCount = this->BinCount;
+    worker.Min = min;
+    worker.Offset = this->CenterBinsAroundMinAndMax ? half_delta : 0.;
+    worker.BinDelta = bin_delta;
+    if (!vtkArrayDispatch::Dispatch::Execute(data_array, worker))
+    {
+      worker(data_array);
+    }
+    for (int cc = 0; cc < this->BinCount; ++cc)
+    {
+      bin_values->SetValue(cc, bin_values->GetValue(cc) + static_cast<int>(worker.Bins[cc]));
+    }
+    return;
+  }
+
   for (int i = 0; i != num_of_tuples; ++i)
   {
     if (i % 1000 == 0)
     {
       this->UpdateProgress(0.10 + 0.90 * i / num_of_tuples);
     }
+    if (ghosts && (ghosts->GetValue(i) & ghostMask))
+    {
+      continue;
+    }
     double value;
     // if component is equal to the number of components, then the magnitude was requested.
     if (this->Component == data_array->GetNumberOfComponents())
@@ -114,6 +114,13 @@ protected:
    */
   virtual bool GetInputArrayRange(vtkInformationVector** inputVector, double range[2]);
 
+  /**
+   * Returns true if the range determined by the previous execution can be
+   * used again, i.e. neither the input nor this filter have been modified
+   * since.
+   */
+  virtual bool CanReuseInputArrayRange(vtkDataObject* input);
+
   int FillInputPortInformation(int port, vtkInformation* info) override;
 
   int RequestData(vtkInformation* request, vtkInformationVector** inputVector,
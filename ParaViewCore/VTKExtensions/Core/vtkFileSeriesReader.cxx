@@ -27,6 +27,7 @@
 #include "vtkClientServerInterpreter.h"
 #include "vtkClientServerInterpreterInitializer.h"
 #include "vtkClientServerStream.h"
+#include "vtkDataObject.h"
 #include "vtkGenericDataObjectReader.h"
 #include "vtkInformation.h"
 #include "vtkInformationIntegerKey.h"
@@ -45,10 +46,15 @@
 #define VTK_CREATE(type, name) vtkSmartPointer<type> name = vtkSmartPointer<type>::New()
 
 #include <algorithm>
+#include <atomic>
 #include <ctype.h> // for isprint().
+#include <fstream>
+#include <list>
 #include <map>
+#include <memory>
 #include <set>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "vtk_jsoncpp.h"
@@ -70,6 +76,7 @@ public:
   int GetIndexForTime(double time);
   int ChooseInput(vtkInformation* outInfo);
   std::vector<double> GetTimesForInput(int inputId, vtkInformation* outInfo);
+  bool HasSingleTimeStep(int index);
 
 private:
   static vtkInformationIntegerKey* INDEX();
@@ -307,6 +314,14 @@ std::vector<double> vtkFileSeriesReaderTimeRanges::GetTimesForInput(
   return times;
 }
 
+//-----------------------------------------------------------------------------
+bool vtkFileSeriesReaderTimeRanges::HasSingleTimeStep(int index)
+{
+  std::map<int, vtkSmartPointer<vtkInformation> >::iterator itr = this->InputLookup.find(index);
+  return itr != this->InputLookup.end() &&
+    itr->second->Length(vtkStreamingDemandDrivenPipeline::TIME_STEPS()) == 1;
+}
+
 namespace
 {
 // Helper class used to ensure that ProcessRequest() never results in change
@@ -362,6 +377,55 @@ private:
 };
 }
 
+//=============================================================================
+namespace
+{
+// Size of the reads issued when warming up files.
+const std::streamsize WARM_CHUNK_SIZE = 1 << 20;
+
+// Identifies one output produced by the internal reader. Steps are keyed by
+// the file they come from and its modification time on disk, so that they
+// stay valid when the file list is reordered and are not reused once the file
+// is rewritten. Changes to the internal reader's settings clear the cache.
+struct vtkFileSeriesStepKey
+{
+  std::string FileName;
+  long FileTime;
+  bool HasTime;
+  double Time;
+  int Piece;
+  int NumberOfPieces;
+  int GhostLevels;
+
+  // The requested time is ignored for files with a single time step.
+  vtkFileSeriesStepKey(const std::string& fname, vtkInformation* outInfo, bool useTime)
+    : FileName(fname)
+    , FileTime(vtksys::SystemTools::ModifiedTime(fname))
+    , HasTime(useTime && outInfo->Has(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP()) != 0)
+    , Time(this->HasTime ? outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP())
+                         : 0.0)
+    , Piece(outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_PIECE_NUMBER()))
+    , NumberOfPieces(outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_NUMBER_OF_PIECES()))
+    , GhostLevels(outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_NUMBER_OF_GHOST_LEVELS()))
+  {
+  }
+
+  bool operator==(const vtkFileSeriesStepKey& other) const
+  {
+    return this->FileName == other.FileName && this->FileTime == other.FileTime &&
+      this->HasTime == other.HasTime && (!this->HasTime || this->Time == other.Time) &&
+      this->Piece == other.Piece && this->NumberOfPieces == other.NumberOfPieces &&
+      this->GhostLevels == other.GhostLevels;
+  }
+};
+
+struct vtkFileSeriesCachedStep
+{
+  vtkFileSeriesStepKey Key;
+  vtkSmartPointer<vtkDataObject> Data;
+};
+}
+
 //=============================================================================
 struct vtkFileSeriesReaderInternals
 {
@@ -370,6 +434,166 @@ struct vtkFileSeriesReaderInternals
   std::vector<double> TimeValues;
   bool FileNameIsSet;
   vtkFileSeriesReaderTimeRanges* TimeRanges;
+
+  // Outputs of previously read steps, most recently used first.
+  std::list<vtkFileSeriesCachedStep> Cache;
+  int LastReadIndex = -1;
+
+  std::thread WarmThread;
+  std::atomic<bool> AbortWarming{ false };
+
+  // Step being read ahead by the prefetch reader on PrefetchThread, and the
+  // last one it read.
+  std::thread PrefetchThread;
+  std::unique_ptr<vtkFileSeriesStepKey> PrefetchKey;
+  int PrefetchStatus = 0;
+  std::unique_ptr<vtkFileSeriesStepKey> PrefetchedKey;
+  vtkSmartPointer<vtkDataObject> Prefetched;
+
+  ~vtkFileSeriesReaderInternals()
+  {
+    this->StopWarming();
+    this->WaitForPrefetch(nullptr);
+  }
+
+  vtkDataObject* FindCachedStep(const vtkFileSeriesStepKey& key, int cacheSize)
+  {
+    if (this->PrefetchedKey && *this->PrefetchedKey == key)
+    {
+      // keep the prefetched step around once it is used, when caching.
+      if (cacheSize > 0)
+      {
+        this->Cache.push_front(vtkFileSeriesCachedStep{ key, this->Prefetched });
+        this->TrimCache(cacheSize);
+      }
+      return this->Prefetched;
+    }
+    for (auto iter = this->Cache.begin(); iter != this->Cache.end(); ++iter)
+    {
+      if (iter->Key == key)
+      {
+        this->Cache.splice(this->Cache.begin(), this->Cache, iter);
+        return this->Cache.front().Data;
+      }
+    }
+    return nullptr;
+  }
+
+  bool HasCachedFile(const std::string& fname) const
+  {
+    if (this->PrefetchedKey && this->PrefetchedKey->FileName == fname)
+    {
+      return true;
+    }
+    for (const auto& step : this->Cache)
+    {
+      if (step.Key.FileName == fname)
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void CacheStep(const vtkFileSeriesStepKey& key, vtkDataObject* output, int cacheSize)
+  {
+    this->Cache.push_front(vtkFileSeriesCachedStep{ key, this->Copy(output) });
+    this->TrimCache(cacheSize);
+  }
+
+  void TrimCache(int cacheSize)
+  {
+    while (this->Cache.size() > static_cast<size_t>(cacheSize))
+    {
+      this->Cache.pop_back();
+    }
+  }
+
+  // Forget every step read so far, e.g. when the internal reader's settings
+  // change.
+  void ClearSteps()
+  {
+    this->Cache.clear();
+    this->PrefetchedKey.reset();
+    this->Prefetched = nullptr;
+    if (this->PrefetchThread.joinable())
+    {
+      this->PrefetchThread.join();
+    }
+    this->PrefetchKey.reset();
+  }
+
+  static vtkSmartPointer<vtkDataObject> Copy(vtkDataObject* output)
+  {
+    vtkSmartPointer<vtkDataObject> copy;
+    copy.TakeReference(output->NewInstance());
+    copy->ShallowCopy(output);
+    return copy;
+  }
+
+  // Wait for the step being prefetched, if any, and keep its output. Once
+  // this returns, the prefetch reader is no longer used by another thread.
+  void WaitForPrefetch(vtkAlgorithm* reader)
+  {
+    if (!this->PrefetchThread.joinable())
+    {
+      return;
+    }
+    this->PrefetchThread.join();
+    if (this->PrefetchKey && this->PrefetchStatus && reader && reader->GetOutputDataObject(0))
+    {
+      this->PrefetchedKey = std::move(this->PrefetchKey);
+      this->Prefetched = this->Copy(reader->GetOutputDataObject(0));
+    }
+    this->PrefetchKey.reset();
+  }
+
+  // Read a step with the prefetch reader on a background thread. The reader
+  // must be a separate instance from the internal reader, with its file name
+  // already set. Only the background thread uses it until WaitForPrefetch().
+  void StartPrefetch(vtkAlgorithm* reader, const vtkFileSeriesStepKey& key)
+  {
+    this->WaitForPrefetch(reader);
+    this->PrefetchKey.reset(new vtkFileSeriesStepKey(key));
+    this->PrefetchStatus = 0;
+    this->PrefetchThread = std::thread([this, reader]() {
+      this->PrefetchStatus = reader->UpdatePiece(this->PrefetchKey->Piece,
+        this->PrefetchKey->NumberOfPieces, this->PrefetchKey->GhostLevels);
+    });
+  }
+
+  void StopWarming()
+  {
+    if (this->WarmThread.joinable())
+    {
+      this->AbortWarming = true;
+      this->WarmThread.join();
+    }
+    this->AbortWarming = false;
+  }
+
+  // Read the given files on a background thread and discard the bytes. This
+  // only warms up the operating system's file cache; the internal reader is
+  // not thread safe and is never touched from the warming thread.
+  void StartWarming(const std::vector<std::string>& files)
+  {
+    this->StopWarming();
+    if (files.empty())
+    {
+      return;
+    }
+    this->WarmThread = std::thread([this, files]() {
+      std::vector<char> buffer(static_cast<size_t>(WARM_CHUNK_SIZE));
+      for (const auto& fname : files)
+      {
+        std::ifstream file(fname.c_str(), std::ios::in | std::ios::binary);
+        while (file && !this->AbortWarming)
+        {
+          file.read(buffer.data(), WARM_CHUNK_SIZE);
+        }
+      }
+    });
+  }
 };
 
 //=============================================================================
@@ -386,6 +610,10 @@ vtkFileSeriesReader::vtkFileSeriesReader()
   this->UseJsonMetaFile = false;
 
   this->IgnoreReaderTime = false;
+  this->CacheSize = 0;
+  this->WarmOSFileCache = false;
+  this->PrefetchNextStep = false;
+  this->PrefetchReader = nullptr;
 }
 
 //-----------------------------------------------------------------------------
@@ -393,6 +621,32 @@ vtkFileSeriesReader::~vtkFileSeriesReader()
 {
   delete this->Internal->TimeRanges;
   delete this->Internal;
+  this->Internal = nullptr;
+  this->SetPrefetchReader(nullptr);
+}
+
+//-----------------------------------------------------------------------------
+void vtkFileSeriesReader::SetPrefetchReader(vtkAlgorithm* reader)
+{
+  if (this->PrefetchReader == reader)
+  {
+    return;
+  }
+  if (this->Internal)
+  {
+    this->Internal->ClearSteps();
+  }
+  vtkAlgorithm* previous = this->PrefetchReader;
+  this->PrefetchReader = reader;
+  if (reader)
+  {
+    reader->Register(this);
+  }
+  if (previous)
+  {
+    previous->UnRegister(this);
+  }
+  this->Modified();
 }
 
 //----------------------------------------------------------------------------
@@ -499,6 +753,14 @@ int vtkFileSeriesReader::ProcessRequest(
 
   if (this->Reader)
   {
+    // Cached steps are only valid for the settings of the internal reader
+    // they were read with. Its MTime differs from the one recorded at the end
+    // of the previous pass only if something other than us modified it.
+    if (this->Reader->GetMTime() != this->FileNameMTime)
+    {
+      this->Internal->ClearSteps();
+    }
+
     // We want to suppress the modification time change in the Reader.  See
     // vtkFileSeriesReader::GetMTime() for details on how this works.
     this->BeforeFileNameMTime = this->GetMTime();
@@ -706,14 +968,78 @@ int vtkFileSeriesReader::RequestData(
   vtkInformation* outInfo = outputVector->GetInformationObject(requestFromPort);
   this->Internal->TimeRanges->GetInputTimeInfo(this->_FileIndex, outInfo);
 
-  int retVal = this->Reader->ProcessRequest(request, inputVector, outputVector);
+  int index = static_cast<int>(this->_FileIndex);
+  const std::string fname = this->GetFileName(index) ? this->GetFileName(index) : "";
+  vtkFileSeriesStepKey key(fname, outInfo, !this->Internal->TimeRanges->HasSingleTimeStep(index));
+  vtkDataObject* output = outInfo->Get(vtkDataObject::DATA_OBJECT());
+
+  // Collect the step read ahead, if any, it may be the one requested. The
+  // prefetch reader is not used by another thread after this.
+  this->Internal->WaitForPrefetch(this->PrefetchReader);
+
+  int retVal;
+  vtkDataObject* cached = output ? this->Internal->FindCachedStep(key, this->CacheSize) : nullptr;
+  if (cached)
+  {
+    output->ShallowCopy(cached);
+    retVal = 1;
+  }
+  else
+  {
+    retVal = this->Reader->ProcessRequest(request, inputVector, outputVector);
+    if (retVal && this->CacheSize > 0 && output)
+    {
+      this->Internal->CacheStep(key, output, this->CacheSize);
+    }
+    else
+    {
+      this->Internal->TrimCache(this->CacheSize);
+    }
+  }
 
-  if (this->GetNumberOfFileNames() > 0)
+  int numFiles = static_cast<int>(this->GetNumberOfFileNames());
+  if (numFiles > 0)
   {
     // Now restore the information.
     this->Internal->TimeRanges->GetAggregateTimeInfo(outInfo);
   }
 
+  // Look ahead in the direction we are moving in.
+  int step = index < this->Internal->LastReadIndex ? -1 : 1;
+  if (this->PrefetchNextStep && this->PrefetchReader && this->PrefetchReader != this->Reader)
+  {
+    // Read the next step with the prefetch reader while the current one is
+    // processed. Only files with a single time step are read ahead, since the
+    // time that will be requested from the others is not known.
+    int next = index + step;
+    if (next >= 0 && next < numFiles && this->Internal->TimeRanges->HasSingleTimeStep(next))
+    {
+      vtkFileSeriesStepKey nextKey(this->GetFileName(next), outInfo, false);
+      if (!this->Internal->HasCachedFile(nextKey.FileName))
+      {
+        this->ReaderSetFileName(this->PrefetchReader, nextKey.FileName.c_str());
+        this->Internal->StartPrefetch(this->PrefetchReader, nextKey);
+      }
+    }
+  }
+
+  if (this->WarmOSFileCache && numFiles > 1)
+  {
+    // Warm up the files of the neighbouring steps, starting with the one in the
+    // direction we are moving in.
+    std::vector<std::string> files;
+    for (int neighbor : { index + step, index - step })
+    {
+      if (neighbor >= 0 && neighbor < numFiles &&
+        !this->Internal->HasCachedFile(this->GetFileName(neighbor)))
+      {
+        files.push_back(this->GetFileName(neighbor));
+      }
+    }
+    this->Internal->StartWarming(files);
+  }
+  this->Internal->LastReadIndex = index;
+
   return retVal;
 }
 
@@ -963,6 +1289,10 @@ void vtkFileSeriesReader::PrintSelf(ostream& os, vtkIndent indent)
      << endl;
   os << indent << "UseMetaFile: " << this->UseMetaFile << endl;
   os << indent << "IgnoreReaderTime: " << this->IgnoreReaderTime << endl;
+  os << indent << "CacheSize: " << this->CacheSize << endl;
+  os << indent << "WarmOSFileCache: " << this->WarmOSFileCache << endl;
+  os << indent << "PrefetchNextStep: " << this->PrefetchNextStep << endl;
+  os << indent << "PrefetchReader: " << this->PrefetchReader << endl;
 }
 
 //-----------------------------------------------------------------------------
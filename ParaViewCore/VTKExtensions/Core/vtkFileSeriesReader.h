@@ -153,6 +153,61 @@ public:
   vtkBooleanMacro(IgnoreReaderTime, bool);
   //@}
 
+  //@{
+  /**
+   * Number of time steps whose output is kept in memory after being read.
+   * Revisiting a cached step, e.g. when looping an animation or scrubbing
+   * back and forth, returns the cached output without re-reading the file.
+   * Steps are identified by their file and its modification time, and the
+   * cache is cleared when the settings of the internal reader change.
+   * 0 (default) disables caching.
+   */
+  vtkSetClampMacro(CacheSize, int, 0, VTK_INT_MAX);
+  vtkGetMacro(CacheSize, int);
+  //@}
+
+  //@{
+  /**
+   * When on, after a step is read the files of the neighbouring steps are
+   * read on a background thread and the bytes discarded, so that the
+   * operating system has them in its file cache by the time they are
+   * requested. This only overlaps disk I/O with rendering: the steps are not
+   * decoded ahead of time, see PrefetchNextStep for that. It helps series on
+   * slow or network file systems and does nothing for files that are already
+   * in the operating system's cache. Off by default.
+   */
+  vtkGetMacro(WarmOSFileCache, bool);
+  vtkSetMacro(WarmOSFileCache, bool);
+  vtkBooleanMacro(WarmOSFileCache, bool);
+  //@}
+
+  //@{
+  /**
+   * When on and a PrefetchReader is set, after a step is read the next step,
+   * in the direction the time is moving in, is read by the PrefetchReader on a
+   * background thread. When that step is requested, its output is used
+   * without reading the file again. Only series whose files have a single
+   * time step each are read ahead. Off by default.
+   */
+  vtkGetMacro(PrefetchNextStep, bool);
+  vtkSetMacro(PrefetchNextStep, bool);
+  vtkBooleanMacro(PrefetchNextStep, bool);
+  //@}
+
+  //@{
+  /**
+   * Second instance of the internal reader class, used to read steps ahead
+   * of time (see PrefetchNextStep). It must be configured like the internal
+   * reader, e.g. by sharing its properties, and must not be used by anything
+   * else: it executes on a background thread between two requests of this
+   * reader. Changing its settings while a step is read ahead is only safe
+   * for plain setters; the step read ahead is then discarded, since the
+   * internal reader changes as well.
+   */
+  void SetPrefetchReader(vtkAlgorithm*);
+  vtkGetObjectMacro(PrefetchReader, vtkAlgorithm);
+  //@}
+
   // Expose number of files, first filename and current file number as
   // information keys for potential use in the internal reader
   static vtkInformationIntegerKey* FILE_SERIES_NUMBER_OF_FILES();
@@ -232,6 +287,10 @@ protected:
   void CopyRealFileNamesFromFileNames();
 
   bool IgnoreReaderTime;
+  int CacheSize;
+  bool WarmOSFileCache;
+  bool PrefetchNextStep;
+  vtkAlgorithm* PrefetchReader;
 
   int ChooseInput(vtkInformation*);
 
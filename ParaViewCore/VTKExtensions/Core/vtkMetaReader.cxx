@@ -55,14 +55,20 @@ vtkMetaReader::~vtkMetaReader()
 //----------------------------------------------------------------------------
 void vtkMetaReader::ReaderSetFileName(const char* name)
 {
-  if (this->Reader && this->FileNameMethod)
+  this->ReaderSetFileName(this->Reader, name);
+}
+
+//-----------------------------------------------------------------------------
+void vtkMetaReader::ReaderSetFileName(vtkAlgorithm* reader, const char* name)
+{
+  if (reader && this->FileNameMethod)
   {
     vtkClientServerInterpreter* interpreter =
       vtkClientServerInterpreterInitializer::GetGlobalInterpreter();
 
     // Build stream request
     vtkClientServerStream stream;
-    stream << vtkClientServerStream::Invoke << this->Reader << this->FileNameMethod << name
+    stream << vtkClientServerStream::Invoke << reader << this->FileNameMethod << name
            << vtkClientServerStream::End;
 
     // Process stream and delete interpreter
@@ -107,6 +107,11 @@ protected:
   vtkGetMacro(_FileIndex, vtkIdType);
 
   void ReaderSetFileName(const char* filename);
+  /**
+   * Set the file name of another instance of the internal reader class, using
+   * FileNameMethod.
+   */
+  void ReaderSetFileName(vtkAlgorithm* reader, const char* filename);
   int ReaderCanReadFile(const char* filename);
 
   /**
@@ -15,6 +15,7 @@
 #include "vtkPExtractHistogram.h"
 
 #include "vtkAttributeDataReductionFilter.h"
+#include "vtkAttributeDataReductionOperator.h"
 #include "vtkCellData.h"
 #include "vtkCommunicator.h"
 #include "vtkDataSet.h"
@@ -23,6 +24,7 @@
 #include "vtkInformationVector.h"
 #include "vtkIntArray.h"
 #include "vtkMultiProcessController.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkReductionFilter.h"
 #include "vtkSmartPointer.h"
@@ -70,6 +72,25 @@ bool vtkPExtractHistogram::GetInputArrayRange(vtkInformationVector** inputVector
   return true;
 }
 
+//-----------------------------------------------------------------------------
+bool vtkPExtractHistogram::CanReuseInputArrayRange(vtkDataObject* input)
+{
+  const bool canReuse = this->Superclass::CanReuseInputArrayRange(input);
+  if (!this->Controller || this->Controller->GetNumberOfProcesses() <= 1)
+  {
+    return canReuse;
+  }
+
+  int local = canReuse ? 1 : 0;
+  int global = 0;
+  if (!this->Controller->AllReduce(&local, &global, 1, vtkCommunicator::MIN_OP))
+  {
+    vtkErrorMacro("Parallel communication error. Could not reduce range status.");
+    return false;
+  }
+  return global == 1;
+}
+
 //-----------------------------------------------------------------------------
 int vtkPExtractHistogram::RequestData(
   vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
@@ -93,11 +114,44 @@ int vtkPExtractHistogram::RequestData(
     // Nothing to do if there is no data
     return 1;
   }
+
+  bool isRoot = (this->Controller->GetLocalProcessId() == 0);
+  if (!this->CalculateAverages)
+  {
+    // Only the bin counts need to be summed up on the root node.
+    vtkIntArray* binValues =
+      vtkIntArray::SafeDownCast(output->GetRowData()->GetArray("bin_values"));
+    vtkNew<vtkIntArray> reduced;
+    reduced->SetNumberOfTuples(this->BinCount);
+    if (!this->Controller->Reduce(binValues->GetPointer(0), reduced->GetPointer(0),
+          this->BinCount, vtkCommunicator::SUM_OP, 0))
+    {
+      vtkErrorMacro("Parallel communication error. Could not reduce bin values.");
+      return 0;
+    }
+    if (isRoot)
+    {
+      binValues->DeepCopy(reduced);
+      binValues->SetName("bin_values");
+    }
+    else
+    {
+      output->Initialize();
+    }
+    return 1;
+  }
+
   // Now we need to collect and reduce data from all nodes on the root.
   vtkSmartPointer<vtkReductionFilter> reduceFilter = vtkSmartPointer<vtkReductionFilter>::New();
   reduceFilter->SetController(this->Controller);
 
-  bool isRoot = (this->Controller->GetLocalProcessId() == 0);
+  // All histograms have the same rows, so the arrays are summed without
+  // gathering the tables, unless the arrays differ between nodes.
+  vtkNew<vtkAttributeDataReductionOperator> op;
+  op->SetAttributeType(vtkAttributeDataReductionFilter::ROW_DATA);
+  op->SetReductionType(vtkAttributeDataReductionFilter::ADD);
+  reduceFilter->SetReductionOperator(op.Get());
+
   if (isRoot)
   {
     // PostGatherHelper needs to be set only on the root node.
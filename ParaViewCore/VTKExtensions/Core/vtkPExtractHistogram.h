@@ -17,7 +17,9 @@
  * @brief   Extract histogram for parallel dataset.
  *
  * vtkPExtractHistogram is vtkExtractHistogram subclass for parallel datasets.
- * It gathers the histogram data on the root node.
+ * It gathers the histogram data on the root node. Bin counts are summed with
+ * a fixed-size reduction; the table gathering reduction is only used when
+ * CalculateAverages is on.
 */
 
 #ifndef vtkPExtractHistogram_h
@@ -54,6 +56,12 @@ protected:
    */
   bool GetInputArrayRange(vtkInformationVector** inputVector, double range[2]) override;
 
+  /**
+   * Overridden to only reuse the range when it can be reused on all
+   * processes.
+   */
+  bool CanReuseInputArrayRange(vtkDataObject* input) override;
+
   int RequestData(vtkInformation* request, vtkInformationVector** inputVector,
     vtkInformationVector* outputVector) override;
 
@@ -23,6 +23,7 @@ PURPOSE.  See the above copyright notice for more information.
 #include "vtkInformationObjectBaseKey.h"
 #include "vtkInformationVector.h"
 #include "vtkObjectFactory.h"
+#include "vtkPVPipelineProfiler.h"
 #include "vtkPVPostFilterExecutive.h"
 
 #include <assert.h>
@@ -82,6 +83,28 @@ void vtkPVCompositeDataPipeline::CopyDefaultInformation(vtkInformation* request,
   }
 }
 
+//----------------------------------------------------------------------------
+int vtkPVCompositeDataPipeline::ExecuteData(
+  vtkInformation* request, vtkInformationVector** inInfoVec, vtkInformationVector* outInfoVec)
+{
+  if (!vtkPVPipelineProfiler::GetEnabled())
+  {
+    return this->Superclass::ExecuteData(request, inInfoVec, outInfoVec);
+  }
+
+  vtkPVPipelineProfiler::StartExecute(this->Algorithm);
+  const int result = this->Superclass::ExecuteData(request, inInfoVec, outInfoVec);
+
+  vtkTypeInt64 memory = 0;
+  for (int cc = 0, max = outInfoVec->GetNumberOfInformationObjects(); cc < max; ++cc)
+  {
+    vtkDataObject* output = outInfoVec->GetInformationObject(cc)->Get(vtkDataObject::DATA_OBJECT());
+    memory += output ? output->GetActualMemorySize() : 0;
+  }
+  vtkPVPipelineProfiler::EndExecute(this->Algorithm, memory);
+  return result;
+}
+
 //----------------------------------------------------------------------------
 void vtkPVCompositeDataPipeline::ResetPipelineInformation(int port, vtkInformation* info)
 {
@@ -23,6 +23,8 @@
  *     algorithms are passed along to the input vtkPVPostFilter, if one exists.
  *     vtkPVPostFilter is used to automatically extract components or generated
  *     derived arrays such as magnitude array for vectors.
+ * \li Profiling :- when vtkPVPipelineProfiler is enabled, it records the time
+ *     spent executing the algorithm and the size of its outputs.
 */
 
 #ifndef vtkPVCompositeDataPipeline_h
@@ -46,6 +48,10 @@ protected:
   void CopyDefaultInformation(vtkInformation* request, int direction,
     vtkInformationVector** inInfoVec, vtkInformationVector* outInfoVec) override;
 
+  // Record the execution in vtkPVPipelineProfiler, when enabled.
+  int ExecuteData(vtkInformation* request, vtkInformationVector** inInfoVec,
+    vtkInformationVector* outInfoVec) override;
+
   // Remove update/whole extent when resetting pipeline information.
   void ResetPipelineInformation(int port, vtkInformation*) override;
 
@@ -0,0 +1,224 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    vtkPVPipelineProfiler.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkPVPipelineProfiler.h"
+
+#include "vtkAlgorithm.h"
+#include "vtkInformation.h"
+#include "vtkInformationStringKey.h"
+#include "vtkObjectFactory.h"
+#include "vtkTimerLog.h"
+
+#include <atomic>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace
+{
+struct vtkRecord
+{
+  std::string Stack;
+  int Calls = 0;
+  double Time = 0.0;
+  vtkTypeInt64 Memory = 0;
+};
+
+struct vtkExecution
+{
+  vtkAlgorithm* Algorithm;
+  double Start;
+  double NestedTime;
+};
+
+struct vtkProfile
+{
+  std::atomic<bool> Enabled{ false };
+  std::mutex Mutex;
+  // a deque so that GetRecordStack() pointers survive new records.
+  std::deque<vtkRecord> Records;
+  std::map<std::string, size_t> Index;
+
+  vtkRecord& GetRecord(const std::string& stack)
+  {
+    auto iter = this->Index.find(stack);
+    if (iter == this->Index.end())
+    {
+      iter = this->Index.insert(std::make_pair(stack, this->Records.size())).first;
+      this->Records.push_back(vtkRecord());
+      this->Records.back().Stack = stack;
+    }
+    return this->Records[iter->second];
+  }
+
+  const vtkRecord* GetRecord(int idx) const
+  {
+    return (idx >= 0 && idx < static_cast<int>(this->Records.size())) ? &this->Records[idx]
+                                                                       : nullptr;
+  }
+};
+
+vtkProfile& GetProfile()
+{
+  static vtkProfile profile;
+  return profile;
+}
+
+// executions in progress on the calling thread, outermost first.
+std::vector<vtkExecution>& GetExecutionStack()
+{
+  static thread_local std::vector<vtkExecution> stack;
+  return stack;
+}
+
+std::string GetLabel(vtkAlgorithm* algo)
+{
+  vtkInformation* info = algo->GetInformation();
+  if (info && info->Has(vtkPVPipelineProfiler::LABEL()))
+  {
+    return info->Get(vtkPVPipelineProfiler::LABEL());
+  }
+  return algo->GetClassName();
+}
+}
+
+vtkInformationKeyMacro(vtkPVPipelineProfiler, LABEL, String);
+vtkStandardNewMacro(vtkPVPipelineProfiler);
+//----------------------------------------------------------------------------
+vtkPVPipelineProfiler::vtkPVPipelineProfiler()
+{
+}
+
+//----------------------------------------------------------------------------
+vtkPVPipelineProfiler::~vtkPVPipelineProfiler()
+{
+}
+
+//----------------------------------------------------------------------------
+void vtkPVPipelineProfiler::SetEnabled(bool val)
+{
+  GetProfile().Enabled = val;
+}
+
+//----------------------------------------------------------------------------
+bool vtkPVPipelineProfiler::GetEnabled()
+{
+  return GetProfile().Enabled;
+}
+
+//----------------------------------------------------------------------------
+void vtkPVPipelineProfiler::Clear()
+{
+  vtkProfile& profile = GetProfile();
+  std::lock_guard<std::mutex> lock(profile.Mutex);
+  profile.Records.clear();
+  profile.Index.clear();
+}
+
+//----------------------------------------------------------------------------
+void vtkPVPipelineProfiler::StartExecute(vtkAlgorithm* algo)
+{
+  GetExecutionStack().push_back(vtkExecution{ algo, vtkTimerLog::GetUniversalTime(), 0.0 });
+}
+
+//----------------------------------------------------------------------------
+void vtkPVPipelineProfiler::EndExecute(vtkAlgorithm* algo, vtkTypeInt64 memory)
+{
+  std::vector<vtkExecution>& stack = GetExecutionStack();
+  if (stack.empty() || stack.back().Algorithm != algo)
+  {
+    // profiling was enabled while the algorithm was executing.
+    return;
+  }
+
+  const vtkExecution execution = stack.back();
+  stack.pop_back();
+
+  const double duration = vtkTimerLog::GetUniversalTime() - execution.Start;
+  if (!stack.empty())
+  {
+    stack.back().NestedTime += duration;
+  }
+
+  // labels are only looked up now since the algorithm (or its proxy) may set
+  // them while executing.
+  std::string label;
+  for (const vtkExecution& parent : stack)
+  {
+    label += GetLabel(parent.Algorithm);
+    label += ";";
+  }
+  label += GetLabel(algo);
+
+  vtkProfile& profile = GetProfile();
+  std::lock_guard<std::mutex> lock(profile.Mutex);
+  vtkRecord& record = profile.GetRecord(label);
+  record.Calls++;
+  record.Time += duration - execution.NestedTime;
+  record.Memory = memory;
+}
+
+//----------------------------------------------------------------------------
+int vtkPVPipelineProfiler::GetNumberOfRecords()
+{
+  vtkProfile& profile = GetProfile();
+  std::lock_guard<std::mutex> lock(profile.Mutex);
+  return static_cast<int>(profile.Records.size());
+}
+
+//----------------------------------------------------------------------------
+const char* vtkPVPipelineProfiler::GetRecordStack(int idx)
+{
+  vtkProfile& profile = GetProfile();
+  std::lock_guard<std::mutex> lock(profile.Mutex);
+  const vtkRecord* record = profile.GetRecord(idx);
+  return record ? record->Stack.c_str() : nullptr;
+}
+
+//----------------------------------------------------------------------------
+int vtkPVPipelineProfiler::GetRecordCalls(int idx)
+{
+  vtkProfile& profile = GetProfile();
+  std::lock_guard<std::mutex> lock(profile.Mutex);
+  const vtkRecord* record = profile.GetRecord(idx);
+  return record ? record->Calls : 0;
+}
+
+//----------------------------------------------------------------------------
+double vtkPVPipelineProfiler::GetRecordTime(int idx)
+{
+  vtkProfile& profile = GetProfile();
+  std::lock_guard<std::mutex> lock(profile.Mutex);
+  const vtkRecord* record = profile.GetRecord(idx);
+  return record ? record->Time : 0.0;
+}
+
+//----------------------------------------------------------------------------
+vtkTypeInt64 vtkPVPipelineProfiler::GetRecordMemory(int idx)
+{
+  vtkProfile& profile = GetProfile();
+  std::lock_guard<std::mutex> lock(profile.Mutex);
+  const vtkRecord* record = profile.GetRecord(idx);
+  return record ? record->Memory : 0;
+}
+
+//----------------------------------------------------------------------------
+void vtkPVPipelineProfiler::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Enabled: " << vtkPVPipelineProfiler::GetEnabled() << endl;
+  os << indent << "NumberOfRecords: " << vtkPVPipelineProfiler::GetNumberOfRecords() << endl;
+}
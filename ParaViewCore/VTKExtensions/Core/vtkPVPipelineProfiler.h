@@ -0,0 +1,101 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    vtkPVPipelineProfiler.h
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkPVPipelineProfiler
+ * @brief   records the time spent executing each algorithm.
+ *
+ * vtkPVPipelineProfiler keeps, on each process, the number of executions, the
+ * time spent and the output memory size of every algorithm executed by
+ * vtkPVCompositeDataPipeline (and subclasses) while profiling is enabled.
+ *
+ * Algorithms are identified by the LABEL() key in their information, or by
+ * their class name when not set. Executions nested in the execution of another
+ * algorithm, e.g. internal pipelines, are recorded separately under a stack
+ * made of the labels of all the algorithms being executed, separated by `;`.
+ * The time recorded is exclusive of nested executions.
+ *
+ * Since all the state is static, any instance can be used to control the
+ * profiler. The `misc, PipelineProfiler` proxy does so on all processes. Use
+ * vtkPVPipelineProfilerInformation to gather the records.
+ *
+ * @sa vtkPVPipelineProfilerInformation
+ */
+
+#ifndef vtkPVPipelineProfiler_h
+#define vtkPVPipelineProfiler_h
+
+#include "vtkObject.h"
+#include "vtkPVVTKExtensionsCoreModule.h" // needed for export macro
+
+class vtkAlgorithm;
+class vtkInformationStringKey;
+
+class VTKPVVTKEXTENSIONSCORE_EXPORT vtkPVPipelineProfiler : public vtkObject
+{
+public:
+  static vtkPVPipelineProfiler* New();
+  vtkTypeMacro(vtkPVPipelineProfiler, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  //@{
+  /**
+   * Enable/disable profiling. Disabled by default.
+   */
+  static void SetEnabled(bool val);
+  static bool GetEnabled();
+  //@}
+
+  /**
+   * Discards all records.
+   */
+  static void Clear();
+
+  /**
+   * Key used to label an algorithm in the records, set in the algorithm's
+   * information.
+   */
+  static vtkInformationStringKey* LABEL();
+
+  //@{
+  /**
+   * Called by the executive around the execution of an algorithm.
+   * `memory` is the size of the outputs in kibibytes.
+   */
+  static void StartExecute(vtkAlgorithm* algo);
+  static void EndExecute(vtkAlgorithm* algo, vtkTypeInt64 memory);
+  //@}
+
+  //@{
+  /**
+   * Access the records. The time is in seconds, and the memory is the size in
+   * kibibytes of the outputs of the last execution.
+   */
+  static int GetNumberOfRecords();
+  static const char* GetRecordStack(int idx);
+  static int GetRecordCalls(int idx);
+  static double GetRecordTime(int idx);
+  static vtkTypeInt64 GetRecordMemory(int idx);
+  //@}
+
+protected:
+  vtkPVPipelineProfiler();
+  ~vtkPVPipelineProfiler() override;
+
+private:
+  vtkPVPipelineProfiler(const vtkPVPipelineProfiler&) = delete;
+  void operator=(const vtkPVPipelineProfiler&) = delete;
+};
+
+#endif
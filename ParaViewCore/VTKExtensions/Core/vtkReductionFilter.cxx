@@ -16,8 +16,10 @@
 
 #include "vtkCellData.h"
 #include "vtkCharArray.h"
+#include "vtkCommunicator.h"
 #include "vtkDataObjectTypes.h"
 #include "vtkDataSet.h"
+#include "vtkDoubleArray.h"
 #include "vtkGenericDataObjectReader.h"
 #include "vtkGenericDataObjectWriter.h"
 #include "vtkIdTypeArray.h"
@@ -25,11 +27,13 @@
 #include "vtkInformation.h"
 #include "vtkInformationExecutivePortKey.h"
 #include "vtkInformationVector.h"
+#include "vtkMultiProcessController.h"
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPVInstantiator.h"
 #include "vtkPointData.h"
 #include "vtkRectilinearGrid.h"
+#include "vtkReductionOperator.h"
 #include "vtkSelection.h"
 #include "vtkSelectionSerializer.h"
 #include "vtkSmartPointer.h"
@@ -40,14 +44,41 @@
 #include "vtkToolkits.h"
 #include "vtkTrivialProducer.h"
 
+#include <cassert>
 #include <sstream>
 #include <sstream>
 #include <vector>
 
+namespace
+{
+// Adapts a vtkReductionOperator to the communicator's reduction API.
+class vtkReductionFilterOperation : public vtkCommunicator::Operation
+{
+public:
+  vtkReductionFilterOperation(vtkReductionOperator* op)
+    : Operator(op)
+  {
+  }
+
+  void Function(const void* A, void* B, vtkIdType length, int datatype) override
+  {
+    assert(datatype == VTK_DOUBLE);
+    (void)datatype;
+    this->Operator->Combine(static_cast<const double*>(A), static_cast<double*>(B), length);
+  }
+
+  int Commutative() override { return this->Operator->IsCommutative() ? 1 : 0; }
+
+private:
+  vtkReductionOperator* Operator;
+};
+}
+
 vtkStandardNewMacro(vtkReductionFilter);
 vtkCxxSetObjectMacro(vtkReductionFilter, Controller, vtkMultiProcessController);
 vtkCxxSetObjectMacro(vtkReductionFilter, PreGatherHelper, vtkAlgorithm);
 vtkCxxSetObjectMacro(vtkReductionFilter, PostGatherHelper, vtkAlgorithm);
+vtkCxxSetObjectMacro(vtkReductionFilter, ReductionOperator, vtkReductionOperator);
 
 //-----------------------------------------------------------------------------
 vtkReductionFilter::vtkReductionFilter()
@@ -56,6 +87,7 @@ vtkReductionFilter::vtkReductionFilter()
   this->SetController(vtkMultiProcessController::GetGlobalController());
   this->PreGatherHelper = 0;
   this->PostGatherHelper = 0;
+  this->ReductionOperator = 0;
   this->PassThrough = -1;
   this->GenerateProcessIds = 0;
   this->ReductionMode = vtkReductionFilter::REDUCE_ALL_TO_ONE;
@@ -67,6 +99,7 @@ vtkReductionFilter::~vtkReductionFilter()
 {
   this->SetPreGatherHelper(0);
   this->SetPostGatherHelper(0);
+  this->SetReductionOperator(0);
   this->SetController(0);
 }
 
@@ -367,6 +400,12 @@ void vtkReductionFilter::Reduce(vtkDataObject* input, vtkDataObject* output)
     }
   }
 
+  if (this->ReductionOperator && this->PassThrough < 0 && !this->GenerateProcessIds &&
+    !vtkSelection::SafeDownCast(preOutput) && this->ReduceWithOperator(preOutput, output))
+  {
+    return;
+  }
+
   std::vector<vtkSmartPointer<vtkDataObject> > data_sets;
   std::vector<vtkSmartPointer<vtkDataObject> > receiveData(numProcs);
 
@@ -436,6 +475,81 @@ void vtkReductionFilter::Reduce(vtkDataObject* input, vtkDataObject* output)
     this->PostProcess(output, &data_sets[0], static_cast<unsigned int>(data_sets.size()));
   }
 }
+
+//-----------------------------------------------------------------------------
+bool vtkReductionFilter::ReduceWithOperator(vtkDataObject* preOutput, vtkDataObject* output)
+{
+  vtkMultiProcessController* controller = this->Controller;
+  const int myId = controller->GetLocalProcessId();
+  const bool allToAll = this->ReductionMode == vtkReductionFilter::REDUCE_ALL_TO_ALL;
+  const bool producesResult = allToAll || myId == this->ReductionProcessId;
+
+  vtkNew<vtkDoubleArray> buffer;
+  const bool packed = preOutput && this->ReductionOperator->Pack(preOutput, buffer.Get());
+
+  // All processes must agree on the buffer layout before reducing. Processes
+  // without data do not constrain it, unless they need a data object to
+  // unpack the result into. The minima are obtained as negated maxima, so a
+  // single collective is needed.
+  vtkTypeInt64 layout[5] = { VTK_TYPE_INT64_MIN, VTK_TYPE_INT64_MIN, VTK_TYPE_INT64_MIN,
+    VTK_TYPE_INT64_MIN, 0 };
+  if (packed)
+  {
+    const vtkTypeInt64 size = buffer->GetNumberOfTuples();
+    const vtkTypeInt64 signature = this->ReductionOperator->GetLayoutSignature(preOutput);
+    layout[0] = size;
+    layout[1] = signature;
+    layout[2] = -size;
+    layout[3] = -signature;
+  }
+  else if (preOutput || producesResult)
+  {
+    layout[4] = 1;
+  }
+  vtkTypeInt64 globalLayout[5];
+  if (!controller->AllReduce(layout, globalLayout, 5, vtkCommunicator::MAX_OP))
+  {
+    vtkErrorMacro("Parallel communication error. Could not reduce buffer layouts.");
+    return false;
+  }
+  if (globalLayout[4] != 0 || globalLayout[0] == VTK_TYPE_INT64_MIN ||
+    globalLayout[0] != -globalLayout[2] || globalLayout[1] != -globalLayout[3])
+  {
+    return false;
+  }
+
+  const vtkIdType size = static_cast<vtkIdType>(globalLayout[0]);
+  if (!packed)
+  {
+    buffer->SetNumberOfTuples(size);
+    this->ReductionOperator->InitializeBuffer(buffer->GetPointer(0), size);
+  }
+
+  vtkNew<vtkDoubleArray> reduced;
+  reduced->SetNumberOfTuples(size);
+  vtkReductionFilterOperation operation(this->ReductionOperator);
+  const int status = allToAll
+    ? controller->AllReduce(buffer->GetPointer(0), reduced->GetPointer(0), size, &operation)
+    : controller->Reduce(
+        buffer->GetPointer(0), reduced->GetPointer(0), size, &operation, this->ReductionProcessId);
+  if (!status)
+  {
+    vtkErrorMacro("Parallel communication error. Could not reduce buffers.");
+    return true;
+  }
+
+  if (producesResult)
+  {
+    this->ReductionOperator->Unpack(reduced.Get(), preOutput, output);
+  }
+  else if (preOutput && this->ReductionMode == vtkReductionFilter::REDUCE_ALL_TO_ONE)
+  {
+    vtkSmartPointer<vtkDataObject> inputs[1] = { preOutput };
+    this->PostProcess(output, inputs, 1);
+  }
+  return true;
+}
+
 //----------------------------------------------------------------------------
 int vtkReductionFilter::GatherSelection(vtkSelection* sendData,
   std::vector<vtkSmartPointer<vtkDataObject> >& receiveData, int destProcessId)
@@ -483,6 +597,7 @@ void vtkReductionFilter::PrintSelf(ostream& os, vtkIndent indent)
   this->Superclass::PrintSelf(os, indent);
   os << indent << "PreGatherHelper: " << this->PreGatherHelper << endl;
   os << indent << "PostGatherHelper: " << this->PostGatherHelper << endl;
+  os << indent << "ReductionOperator: " << this->ReductionOperator << endl;
   os << indent << "Controller: " << this->Controller << endl;
   os << indent << "PassThrough: " << this->PassThrough << endl;
   os << indent << "GenerateProcessIds: " << this->GenerateProcessIds << endl;
@@ -28,6 +28,11 @@
  * In addition to doing reduction the PassThrough variable lets you choose
  * to pass through the results of any one node instead of aggregating all of
  * them together.
+ *
+ * When a ReductionOperator is set, reductions with a fixed-size result are
+ * done by reducing buffers packed by the operator instead of gathering the
+ * data objects. The filter falls back to gathering when the operator cannot
+ * handle the data of all processes.
 */
 
 #ifndef vtkReductionFilter_h
@@ -39,6 +44,7 @@
 #include <vector>                         //  needed for std::vector
 
 class vtkMultiProcessController;
+class vtkReductionOperator;
 class vtkSelection;
 class VTKPVVTKEXTENSIONSCORE_EXPORT vtkReductionFilter : public vtkDataObjectAlgorithm
 {
@@ -102,6 +108,18 @@ public:
    */
   void SetController(vtkMultiProcessController*);
 
+  //@{
+  /**
+   * Get/Set the reduction operator. When set, the operator reduces the
+   * pre-reduction results of all nodes in place of gathering them and running
+   * the PostGatherHelper, as long as all nodes pack buffers of the same layout.
+   * The operator must be set on all nodes. Not used for selections, with
+   * PassThrough or with GenerateProcessIds.
+   */
+  void SetReductionOperator(vtkReductionOperator*);
+  vtkGetObjectMacro(ReductionOperator, vtkReductionOperator);
+  //@}
+
   //@{
   /**
    * Get/Set the PassThrough flag which (when set to a nonnegative number N)
@@ -147,6 +165,12 @@ protected:
   void PostProcess(
     vtkDataObject* output, vtkSmartPointer<vtkDataObject> inputs[], unsigned int num_inputs);
 
+  /**
+   * Reduces `preOutput` using the ReductionOperator. Returns false, on all
+   * processes, if the data must be gathered instead.
+   */
+  bool ReduceWithOperator(vtkDataObject* preOutput, vtkDataObject* output);
+
   /**
    * Gather for vtkSelection
    * sendData is a vtkSelection while receiveData is a vector of NumberOfProcesses
@@ -157,6 +181,7 @@ protected:
 
   vtkAlgorithm* PreGatherHelper;
   vtkAlgorithm* PostGatherHelper;
+  vtkReductionOperator* ReductionOperator;
   vtkMultiProcessController* Controller;
   int PassThrough;
   int GenerateProcessIds;
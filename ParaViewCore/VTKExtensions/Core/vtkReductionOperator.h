@@ -0,0 +1,93 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    vtkReductionOperator.h
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkReductionOperator
+ * @brief   Abstract fixed-size reduction for vtkReductionFilter.
+ *
+ * vtkReductionOperator describes reductions whose result has a fixed size,
+ * such as sums, minima, maxima or bin counts. Instead of gathering complete
+ * data objects to the root, vtkReductionFilter asks the operator to pack the
+ * values to reduce from each process into a buffer of doubles, reduces the
+ * buffers with the operator's associative Combine() and lets the operator
+ * unpack the result into the output.
+ *
+ * All processes having data must pack buffers of the same size and layout,
+ * as reported by GetLayoutSignature(). Otherwise, vtkReductionFilter falls
+ * back to gathering data objects.
+ *
+ * @sa vtkReductionFilter, vtkAttributeDataReductionOperator
+*/
+
+#ifndef vtkReductionOperator_h
+#define vtkReductionOperator_h
+
+#include "vtkObject.h"
+#include "vtkPVVTKExtensionsCoreModule.h" // needed for export macro
+
+class vtkDataObject;
+class vtkDoubleArray;
+
+class VTKPVVTKEXTENSIONSCORE_EXPORT vtkReductionOperator : public vtkObject
+{
+public:
+  vtkTypeMacro(vtkReductionOperator, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * Packs the values of `data` to reduce into `buffer`. Returns false if
+   * `data` cannot be reduced by this operator.
+   */
+  virtual bool Pack(vtkDataObject* data, vtkDoubleArray* buffer) = 0;
+
+  /**
+   * Returns a value identifying the layout of the buffer packed for `data`.
+   * Buffers are only combined when all processes report the same signature.
+   * The default implementation returns 0.
+   */
+  virtual vtkTypeUInt32 GetLayoutSignature(vtkDataObject* data);
+
+  /**
+   * Fills a buffer with the identity of Combine(). This is used for processes
+   * that have no data to reduce.
+   */
+  virtual void InitializeBuffer(double* buffer, vtkIdType size) = 0;
+
+  /**
+   * Combines `source` into `target`. The operation must be associative.
+   */
+  virtual void Combine(const double* source, double* target, vtkIdType size) = 0;
+
+  /**
+   * Returns true if Combine() is commutative. Default is true.
+   */
+  virtual bool IsCommutative() { return true; }
+
+  /**
+   * Produces `output` from the reduced `buffer`. `data` is the local data the
+   * buffer was packed from; all values not part of the reduction are taken
+   * from it.
+   */
+  virtual void Unpack(vtkDoubleArray* buffer, vtkDataObject* data, vtkDataObject* output) = 0;
+
+protected:
+  vtkReductionOperator();
+  ~vtkReductionOperator() override;
+
+private:
+  vtkReductionOperator(const vtkReductionOperator&) = delete;
+  void operator=(const vtkReductionOperator&) = delete;
+};
+
+#endif
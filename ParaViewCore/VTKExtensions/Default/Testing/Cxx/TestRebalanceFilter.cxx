@@ -0,0 +1,198 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    TestRebalanceFilter.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkCellType.h"
+#include "vtkCompositeDataIterator.h"
+#include "vtkMPIController.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkPoints.h"
+#include "vtkRebalanceFilter.h"
+#include "vtkSmartPointer.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <cstdlib>
+#include <vector>
+
+// All checks use values that are the same on all ranks, so that all ranks fail
+// together instead of waiting for each other.
+#define TASSERT(x)                                                                                 \
+  if (!(x))                                                                                        \
+  {                                                                                                \
+    cerr << "ERROR: failed at " << __LINE__ << "!" << endl;                                        \
+    return false;                                                                                  \
+  }
+
+namespace
+{
+// Returns an unstructured grid with `numCells` vertices.
+vtkSmartPointer<vtkUnstructuredGrid> GetGrid(vtkIdType numCells)
+{
+  vtkNew<vtkPoints> points;
+  vtkSmartPointer<vtkUnstructuredGrid> ug = vtkSmartPointer<vtkUnstructuredGrid>::New();
+  ug->Allocate(numCells);
+  for (vtkIdType cc = 0; cc < numCells; ++cc)
+  {
+    vtkIdType id = points->InsertNextPoint(cc, 0.0, 0.0);
+    ug->InsertNextCell(VTK_VERTEX, 1, &id);
+  }
+  ug->SetPoints(points.GetPointer());
+  return ug;
+}
+
+// Returns the number of cells of each rank in `dobj`.
+std::vector<vtkIdType> GetCellCounts(vtkMultiProcessController* controller, vtkDataObject* dobj)
+{
+  vtkIdType count = 0;
+  if (vtkCompositeDataSet* cd = vtkCompositeDataSet::SafeDownCast(dobj))
+  {
+    vtkSmartPointer<vtkCompositeDataIterator> iter;
+    iter.TakeReference(cd->NewIterator());
+    for (iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextItem())
+    {
+      count += vtkDataSet::SafeDownCast(iter->GetCurrentDataObject())->GetNumberOfCells();
+    }
+  }
+  else
+  {
+    count = vtkDataSet::SafeDownCast(dobj)->GetNumberOfCells();
+  }
+
+  std::vector<vtkIdType> counts(controller->GetNumberOfProcesses());
+  controller->AllGather(&count, counts.data(), 1);
+  return counts;
+}
+
+// Returns true if all counts are within one cell of the mean.
+bool IsBalanced(const std::vector<vtkIdType>& counts)
+{
+  vtkIdType total = 0;
+  for (vtkIdType count : counts)
+  {
+    total += count;
+  }
+  const double mean = static_cast<double>(total) / counts.size();
+  for (vtkIdType count : counts)
+  {
+    if (count < mean - 1.0 || count > mean + 1.0)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool TestUnstructuredGrid(vtkMultiProcessController* controller)
+{
+  const int myId = controller->GetLocalProcessId();
+  vtkSmartPointer<vtkUnstructuredGrid> input = GetGrid(myId == 0 ? 1000 : 10);
+
+  vtkNew<vtkRebalanceFilter> rebalance;
+  rebalance->SetInputData(input);
+  rebalance->Update();
+
+  const std::vector<vtkIdType> counts =
+    GetCellCounts(controller, rebalance->GetOutputDataObject(0));
+  TASSERT(rebalance->GetInputImbalance() > rebalance->GetImbalanceThreshold());
+  TASSERT(rebalance->GetOutputImbalance() <= rebalance->GetImbalanceThreshold());
+  TASSERT(IsBalanced(counts));
+  return true;
+}
+
+// Every rank has a piece of the same leaf: the cells of the leaf are split.
+bool TestSharedLeaf(vtkMultiProcessController* controller)
+{
+  const int myId = controller->GetLocalProcessId();
+  vtkNew<vtkMultiBlockDataSet> input;
+  input->SetBlock(0, GetGrid(myId == 0 ? 1000 : 10));
+
+  vtkNew<vtkRebalanceFilter> rebalance;
+  rebalance->SetInputData(input.GetPointer());
+  rebalance->Update();
+
+  vtkMultiBlockDataSet* output =
+    vtkMultiBlockDataSet::SafeDownCast(rebalance->GetOutputDataObject(0));
+  const std::vector<vtkIdType> counts = GetCellCounts(controller, output);
+  TASSERT(output->GetNumberOfBlocks() == 1);
+  TASSERT(rebalance->GetInputImbalance() > rebalance->GetImbalanceThreshold());
+  TASSERT(rebalance->GetOutputImbalance() <= rebalance->GetImbalanceThreshold());
+  TASSERT(IsBalanced(counts));
+  return true;
+}
+
+// All leaves are on rank 0, other ranks have empty leaves: whole leaves are
+// moved into the empty positions.
+bool TestEmptyLeaves(vtkMultiProcessController* controller)
+{
+  const int numProcs = controller->GetNumberOfProcesses();
+  const int myId = controller->GetLocalProcessId();
+  const unsigned int numLeaves = 2 * numProcs;
+  vtkNew<vtkMultiBlockDataSet> input;
+  for (unsigned int cc = 0; cc < numLeaves; ++cc)
+  {
+    input->SetBlock(cc, GetGrid(myId == 0 ? 100 : 0));
+  }
+
+  vtkNew<vtkRebalanceFilter> rebalance;
+  rebalance->SetInputData(input.GetPointer());
+  rebalance->Update();
+
+  vtkMultiBlockDataSet* output =
+    vtkMultiBlockDataSet::SafeDownCast(rebalance->GetOutputDataObject(0));
+  int numMovedLeaves = 0, numSplitLeaves = 0;
+  for (unsigned int cc = 0; cc < output->GetNumberOfBlocks(); ++cc)
+  {
+    vtkDataSet* leaf = vtkDataSet::SafeDownCast(output->GetBlock(cc));
+    const vtkIdType numCells = leaf ? leaf->GetNumberOfCells() : 0;
+    numMovedLeaves += numCells == 100 ? 1 : 0;
+    numSplitLeaves += numCells != 0 && numCells != 100 ? 1 : 0;
+  }
+  std::vector<int> movedLeaves(numProcs), splitLeaves(numProcs);
+  controller->AllGather(&numMovedLeaves, movedLeaves.data(), 1);
+  controller->AllGather(&numSplitLeaves, splitLeaves.data(), 1);
+
+  const std::vector<vtkIdType> counts = GetCellCounts(controller, output);
+  TASSERT(output->GetNumberOfBlocks() == numLeaves);
+  TASSERT(rebalance->GetOutputImbalance() == 1.0);
+  for (int rank = 0; rank < numProcs; ++rank)
+  {
+    TASSERT(counts[rank] == 200);
+    TASSERT(movedLeaves[rank] == 2);
+    TASSERT(splitLeaves[rank] == 0);
+  }
+  return true;
+}
+}
+
+int TestRebalanceFilter(int argc, char* argv[])
+{
+  vtkNew<vtkMPIController> controller;
+  controller->Initialize(&argc, &argv);
+  vtkMultiProcessController::SetGlobalController(controller.GetPointer());
+
+  int retVal = EXIT_SUCCESS;
+  if (controller->GetNumberOfProcesses() < 2)
+  {
+    cout << "Nothing to rebalance on a single rank." << endl;
+  }
+  else if (!TestUnstructuredGrid(controller.GetPointer()) ||
+    !TestSharedLeaf(controller.GetPointer()) || !TestEmptyLeaves(controller.GetPointer()))
+  {
+    retVal = EXIT_FAILURE;
+  }
+
+  vtkMultiProcessController::SetGlobalController(nullptr);
+  controller->Finalize();
+  return retVal;
+}
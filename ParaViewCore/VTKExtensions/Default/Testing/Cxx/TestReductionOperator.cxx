@@ -0,0 +1,158 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    TestReductionOperator.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkAppendPolyData.h"
+#include "vtkAttributeDataReductionFilter.h"
+#include "vtkAttributeDataReductionOperator.h"
+#include "vtkCellArray.h"
+#include "vtkCommunicator.h"
+#include "vtkDoubleArray.h"
+#include "vtkMPIController.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkReductionFilter.h"
+#include "vtkSmartPointer.h"
+
+#include <cstdlib>
+
+namespace
+{
+// Returns `numPoints` vertices with a "Values" point array whose value i is
+// `offset + i`.
+vtkSmartPointer<vtkPolyData> GetData(vtkIdType numPoints, double offset)
+{
+  vtkNew<vtkPoints> points;
+  vtkNew<vtkCellArray> verts;
+  vtkNew<vtkDoubleArray> values;
+  values->SetName("Values");
+  for (vtkIdType cc = 0; cc < numPoints; ++cc)
+  {
+    vtkIdType id = points->InsertNextPoint(cc, 0.0, 0.0);
+    verts->InsertNextCell(1, &id);
+    values->InsertNextValue(offset + cc);
+  }
+
+  vtkSmartPointer<vtkPolyData> pd = vtkSmartPointer<vtkPolyData>::New();
+  pd->SetPoints(points.GetPointer());
+  pd->SetVerts(verts.GetPointer());
+  pd->GetPointData()->AddArray(values.GetPointer());
+  return pd;
+}
+
+// Reduces `input` with a vtkAttributeDataReductionOperator of the given type.
+// The post-gather helper appends the data, so that the gather path, taken
+// when the operator cannot be used, gives a different result.
+vtkSmartPointer<vtkPolyData> Reduce(
+  vtkMultiProcessController* controller, vtkPolyData* input, int reductionType, int reductionMode)
+{
+  vtkNew<vtkAttributeDataReductionOperator> op;
+  op->SetAttributeType(vtkAttributeDataReductionFilter::POINT_DATA);
+  op->SetReductionType(reductionType);
+  vtkNew<vtkAppendPolyData> append;
+
+  vtkNew<vtkReductionFilter> reduction;
+  reduction->SetController(controller);
+  reduction->SetReductionOperator(op.GetPointer());
+  reduction->SetPostGatherHelper(append.GetPointer());
+  reduction->SetReductionMode(reductionMode);
+  reduction->SetInputData(input);
+  reduction->Update();
+  return vtkPolyData::SafeDownCast(reduction->GetOutputDataObject(0));
+}
+
+// Returns true if `output` has `numPoints` values, the i-th being
+// `offset + scale * i`.
+bool CheckValues(vtkPolyData* output, vtkIdType numPoints, double offset, double scale)
+{
+  vtkDataArray* values = output ? output->GetPointData()->GetArray("Values") : nullptr;
+  if (!values || output->GetNumberOfPoints() != numPoints ||
+    values->GetNumberOfTuples() != numPoints)
+  {
+    cerr << "ERROR: expected " << numPoints << " values." << endl;
+    return false;
+  }
+  for (vtkIdType cc = 0; cc < numPoints; ++cc)
+  {
+    if (values->GetComponent(cc, 0) != offset + scale * cc)
+    {
+      cerr << "ERROR: value " << cc << " is " << values->GetComponent(cc, 0) << " instead of "
+           << offset + scale * cc << endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+// Returns true on all ranks if `ok` is true on all ranks.
+bool AllTrue(vtkMultiProcessController* controller, bool ok)
+{
+  int local = ok ? 1 : 0, global = 0;
+  controller->AllReduce(&local, &global, 1, vtkCommunicator::MIN_OP);
+  return global == 1;
+}
+}
+
+int TestReductionOperator(int argc, char* argv[])
+{
+  vtkNew<vtkMPIController> controller;
+  controller->Initialize(&argc, &argv);
+  vtkMultiProcessController::SetGlobalController(controller.GetPointer());
+
+  const int numProcs = controller->GetNumberOfProcesses();
+  const int myId = controller->GetLocalProcessId();
+  const vtkIdType numPoints = 5;
+  bool ok = true;
+
+  // Same layout on all ranks: the values are summed on the root.
+  vtkSmartPointer<vtkPolyData> output =
+    Reduce(controller.GetPointer(), GetData(numPoints, myId), vtkAttributeDataReductionFilter::ADD,
+      vtkReductionFilter::REDUCE_ALL_TO_ONE);
+  if (myId == 0 && !CheckValues(output, numPoints, numProcs * (numProcs - 1) / 2.0, numProcs))
+  {
+    cerr << "ERROR: unexpected sum." << endl;
+    ok = false;
+  }
+  ok = AllTrue(controller.GetPointer(), ok);
+
+  // Same layout on all ranks: all ranks get the maxima.
+  output = Reduce(controller.GetPointer(), GetData(numPoints, myId),
+    vtkAttributeDataReductionFilter::MAX, vtkReductionFilter::REDUCE_ALL_TO_ALL);
+  if (!CheckValues(output, numPoints, numProcs - 1, 1.0))
+  {
+    cerr << "ERROR: unexpected maxima." << endl;
+    ok = false;
+  }
+  ok = AllTrue(controller.GetPointer(), ok);
+
+  // Different layouts: the data of all ranks is gathered and appended instead,
+  // starting with the root's, unchanged.
+  output = Reduce(controller.GetPointer(), GetData(numPoints + myId, 0.0),
+    vtkAttributeDataReductionFilter::ADD, vtkReductionFilter::REDUCE_ALL_TO_ONE);
+  const vtkIdType numAppendedPoints = numProcs * numPoints + numProcs * (numProcs - 1) / 2;
+  vtkDataArray* values = output ? output->GetPointData()->GetArray("Values") : nullptr;
+  if (myId == 0 &&
+    (!values || output->GetNumberOfPoints() != numAppendedPoints ||
+      values->GetComponent(numPoints - 1, 0) != numPoints - 1))
+  {
+    cerr << "ERROR: mismatched layouts did not fall back to gathering." << endl;
+    ok = false;
+  }
+  ok = AllTrue(controller.GetPointer(), ok);
+
+  vtkMultiProcessController::SetGlobalController(nullptr);
+  controller->Finalize();
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
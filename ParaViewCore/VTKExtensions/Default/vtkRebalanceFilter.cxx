@@ -0,0 +1,442 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    vtkRebalanceFilter.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkRebalanceFilter.h"
+
+#include "vtkAppendFilter.h"
+#include "vtkCellData.h"
+#include "vtkCommunicator.h"
+#include "vtkCompositeDataIterator.h"
+#include "vtkCompositeDataSet.h"
+#include "vtkDataArray.h"
+#include "vtkDataSetAttributes.h"
+#include "vtkExtractCells.h"
+#include "vtkFieldData.h"
+#include "vtkIdList.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkMultiProcessController.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkSmartPointer.h"
+#include "vtkUnsignedCharArray.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <algorithm>
+#include <numeric>
+
+namespace
+{
+enum
+{
+  REBALANCE_TAG = 0x0729b1
+};
+
+// Returns the ratio of the maximum to the mean load.
+double GetImbalance(const std::vector<double>& loads)
+{
+  const double total = std::accumulate(loads.begin(), loads.end(), 0.0);
+  const double mean = total / loads.size();
+  return mean > 0.0 ? *std::max_element(loads.begin(), loads.end()) / mean : 1.0;
+}
+}
+
+vtkStandardNewMacro(vtkRebalanceFilter);
+vtkCxxSetObjectMacro(vtkRebalanceFilter, Controller, vtkMultiProcessController);
+//----------------------------------------------------------------------------
+vtkRebalanceFilter::vtkRebalanceFilter()
+  : Controller(nullptr)
+  , ImbalanceThreshold(1.1)
+  , InputImbalance(1.0)
+  , OutputImbalance(1.0)
+{
+  this->SetController(vtkMultiProcessController::GetGlobalController());
+}
+
+//----------------------------------------------------------------------------
+vtkRebalanceFilter::~vtkRebalanceFilter()
+{
+  this->SetController(nullptr);
+}
+
+//----------------------------------------------------------------------------
+int vtkRebalanceFilter::FillInputPortInformation(int, vtkInformation* info)
+{
+  info->Set(vtkAlgorithm::INPUT_REQUIRED_DATA_TYPE(), "vtkDataSet");
+  info->Append(vtkAlgorithm::INPUT_REQUIRED_DATA_TYPE(), "vtkCompositeDataSet");
+  return 1;
+}
+
+//----------------------------------------------------------------------------
+int vtkRebalanceFilter::RequestData(
+  vtkInformation*, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  vtkDataObject* input = vtkDataObject::GetData(inputVector[0], 0);
+  vtkDataObject* output = vtkDataObject::GetData(outputVector, 0);
+
+  this->InputImbalance = this->OutputImbalance = 1.0;
+  if (this->Controller == nullptr || this->Controller->GetNumberOfProcesses() <= 1)
+  {
+    output->ShallowCopy(input);
+    return 1;
+  }
+
+  // the data type is the same on all ranks, so all ranks take the same path.
+  if (vtkCompositeDataSet* cd = vtkCompositeDataSet::SafeDownCast(input))
+  {
+    this->RebalanceBlocks(cd, vtkCompositeDataSet::SafeDownCast(output));
+  }
+  else if (vtkUnstructuredGrid* ug = vtkUnstructuredGrid::SafeDownCast(input))
+  {
+    this->RebalanceCells(ug, vtkUnstructuredGrid::SafeDownCast(output));
+  }
+  else
+  {
+    vtkDebugMacro("Only composite datasets and unstructured grids are rebalanced.");
+    output->ShallowCopy(input);
+  }
+  return 1;
+}
+
+//----------------------------------------------------------------------------
+double vtkRebalanceFilter::ComputeCellCosts(vtkDataSet* ds, std::vector<double>& costs)
+{
+  const vtkIdType numCells = ds->GetNumberOfCells();
+  vtkDataArray* cellCosts = this->GetInputArrayToProcess(0, ds);
+  if (cellCosts && cellCosts->GetNumberOfTuples() != numCells)
+  {
+    // not a cell array.
+    cellCosts = nullptr;
+  }
+  vtkUnsignedCharArray* ghosts = vtkUnsignedCharArray::SafeDownCast(
+    ds->GetCellData()->GetArray(vtkDataSetAttributes::GhostArrayName()));
+
+  costs.resize(numCells);
+  double total = 0.0;
+  for (vtkIdType cc = 0; cc < numCells; ++cc)
+  {
+    const bool ghost =
+      ghosts && (ghosts->GetValue(cc) & vtkDataSetAttributes::DUPLICATECELL) != 0;
+    costs[cc] = ghost ? 0.0 : (cellCosts ? std::max(cellCosts->GetComponent(cc, 0), 0.0) : 1.0);
+    total += costs[cc];
+  }
+  return total;
+}
+
+//----------------------------------------------------------------------------
+void vtkRebalanceFilter::RebalanceBlocks(vtkCompositeDataSet* input, vtkCompositeDataSet* output)
+{
+  vtkMultiProcessController* controller = this->Controller;
+  const int numProcs = controller->GetNumberOfProcesses();
+  const int myId = controller->GetLocalProcessId();
+
+  // a leaf's cost is negative when the leaf is missing or has no cells on this
+  // rank: its position is free to receive the leaf from another rank.
+  // `splittable` is 1 for the leaves whose cells can be moved.
+  std::vector<vtkDataObject*> leaves;
+  std::vector<double> leafCosts;
+  std::vector<int> splittable;
+  vtkSmartPointer<vtkCompositeDataIterator> iter;
+  iter.TakeReference(input->NewIterator());
+  iter->SkipEmptyNodesOff();
+  for (iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextItem())
+  {
+    vtkDataObject* leaf = iter->GetCurrentDataObject();
+    vtkDataSet* ds = vtkDataSet::SafeDownCast(leaf);
+    const bool empty = !leaf || (ds && ds->GetNumberOfCells() == 0);
+    std::vector<double> cellCosts;
+    leaves.push_back(leaf);
+    leafCosts.push_back(empty ? -1.0 : (ds ? this->ComputeCellCosts(ds, cellCosts) : 0.0));
+    splittable.push_back(empty || vtkUnstructuredGrid::SafeDownCast(leaf) ? 1 : 0);
+  }
+
+  const vtkIdType numLeaves = static_cast<vtkIdType>(leaves.size());
+  vtkIdType range[2] = { numLeaves, -numLeaves }, globalRange[2];
+  controller->AllReduce(range, globalRange, 2, vtkCommunicator::MAX_OP);
+  if (globalRange[0] != -globalRange[1])
+  {
+    vtkWarningMacro("The composite dataset structure differs across ranks. Not rebalancing.");
+    output->ShallowCopy(input);
+    return;
+  }
+
+  // piece `rank * numLeaves + leaf` is the leaf of `rank` in the input.
+  std::vector<double> costs(numProcs * numLeaves);
+  controller->AllGather(leafCosts.data(), costs.data(), numLeaves);
+
+  std::vector<double> loads(numProcs, 0.0);
+  std::vector<int> location(costs.size(), -1);
+  std::vector<bool> occupied(costs.size(), false);
+  for (int rank = 0; rank < numProcs; ++rank)
+  {
+    for (vtkIdType leaf = 0; leaf < numLeaves; ++leaf)
+    {
+      const vtkIdType piece = rank * numLeaves + leaf;
+      if (costs[piece] >= 0.0)
+      {
+        loads[rank] += costs[piece];
+        location[piece] = rank;
+        occupied[piece] = true;
+      }
+    }
+  }
+  this->InputImbalance = GetImbalance(loads);
+
+  // greedily move pieces off the most loaded rank while it lowers its load.
+  // This is computed identically on all ranks.
+  while (GetImbalance(loads) > this->ImbalanceThreshold)
+  {
+    const int src = static_cast<int>(std::max_element(loads.begin(), loads.end()) - loads.begin());
+    double bestLoad = loads[src];
+    vtkIdType bestPiece = -1;
+    int bestDst = -1;
+    for (vtkIdType piece = 0; piece < static_cast<vtkIdType>(costs.size()); ++piece)
+    {
+      if (location[piece] != src || costs[piece] <= 0.0)
+      {
+        continue;
+      }
+      const vtkIdType leaf = piece % numLeaves;
+      int dst = -1;
+      for (int rank = 0; rank < numProcs; ++rank)
+      {
+        if (rank != src && !occupied[rank * numLeaves + leaf] &&
+          (dst == -1 || loads[rank] < loads[dst]))
+        {
+          dst = rank;
+        }
+      }
+      const double load =
+        dst == -1 ? loads[src] : std::max(loads[src] - costs[piece], loads[dst] + costs[piece]);
+      if (load < bestLoad)
+      {
+        bestLoad = load;
+        bestPiece = piece;
+        bestDst = dst;
+      }
+    }
+    if (bestPiece == -1)
+    {
+      break;
+    }
+
+    const vtkIdType leaf = bestPiece % numLeaves;
+    loads[src] -= costs[bestPiece];
+    loads[bestDst] += costs[bestPiece];
+    occupied[src * numLeaves + leaf] = false;
+    occupied[bestDst * numLeaves + leaf] = true;
+    location[bestPiece] = bestDst;
+  }
+
+  // empty leaves are kept unless a piece replaces them.
+  std::vector<vtkSmartPointer<vtkDataObject> > outputLeaves(numLeaves);
+  for (vtkIdType leaf = 0; leaf < numLeaves; ++leaf)
+  {
+    if (leaves[leaf] && (location[myId * numLeaves + leaf] == myId || leafCosts[leaf] < 0.0))
+    {
+      outputLeaves[leaf].TakeReference(leaves[leaf]->NewInstance());
+      outputLeaves[leaf]->ShallowCopy(leaves[leaf]);
+    }
+  }
+
+  // move the pieces in the same order on all ranks, which avoids deadlocks.
+  for (vtkIdType leaf = 0; leaf < numLeaves; ++leaf)
+  {
+    for (int rank = 0; rank < numProcs; ++rank)
+    {
+      const int dst = location[rank * numLeaves + leaf];
+      if (dst == -1 || dst == rank)
+      {
+        continue;
+      }
+      if (myId == rank)
+      {
+        controller->Send(leaves[leaf], dst, REBALANCE_TAG);
+      }
+      else if (myId == dst)
+      {
+        outputLeaves[leaf].TakeReference(controller->ReceiveDataObject(rank, REBALANCE_TAG));
+      }
+    }
+  }
+
+  // when moving whole pieces is not enough, typically because the same leaves
+  // are on all ranks, split the cells of each unstructured grid leaf evenly
+  // across ranks.
+  if (GetImbalance(loads) > this->ImbalanceThreshold)
+  {
+    std::vector<int> globalSplittable(numLeaves);
+    controller->AllReduce(
+      splittable.data(), globalSplittable.data(), numLeaves, vtkCommunicator::MIN_OP);
+    for (vtkIdType leaf = 0; leaf < numLeaves; ++leaf)
+    {
+      if (!globalSplittable[leaf])
+      {
+        continue;
+      }
+
+      vtkSmartPointer<vtkUnstructuredGrid> piece =
+        vtkUnstructuredGrid::SafeDownCast(outputLeaves[leaf]);
+      if (!piece)
+      {
+        piece = vtkSmartPointer<vtkUnstructuredGrid>::New();
+      }
+      std::vector<double> cellCosts;
+      double localCost = this->ComputeCellCosts(piece, cellCosts);
+      std::vector<double> leafLoads(numProcs);
+      controller->AllGather(&localCost, leafLoads.data(), 1);
+      if (std::accumulate(leafLoads.begin(), leafLoads.end(), 0.0) <= 0.0)
+      {
+        continue;
+      }
+
+      vtkNew<vtkUnstructuredGrid> split;
+      const std::vector<double> newLeafLoads =
+        this->SplitCells(piece, cellCosts, leafLoads, split.GetPointer());
+      for (int rank = 0; rank < numProcs; ++rank)
+      {
+        loads[rank] += newLeafLoads[rank] - leafLoads[rank];
+      }
+      if (outputLeaves[leaf] || split->GetNumberOfCells() > 0)
+      {
+        outputLeaves[leaf] = split.GetPointer();
+      }
+    }
+  }
+  this->OutputImbalance = GetImbalance(loads);
+
+  output->CopyStructure(input);
+  iter.TakeReference(output->NewIterator());
+  iter->SkipEmptyNodesOff();
+  vtkIdType leaf = 0;
+  for (iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextItem(), ++leaf)
+  {
+    output->SetDataSet(iter, outputLeaves[leaf]);
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkRebalanceFilter::RebalanceCells(vtkUnstructuredGrid* input, vtkUnstructuredGrid* output)
+{
+  vtkMultiProcessController* controller = this->Controller;
+  const int numProcs = controller->GetNumberOfProcesses();
+
+  std::vector<double> cellCosts;
+  double localCost = this->ComputeCellCosts(input, cellCosts);
+  std::vector<double> loads(numProcs);
+  controller->AllGather(&localCost, loads.data(), 1);
+
+  this->InputImbalance = this->OutputImbalance = GetImbalance(loads);
+  const double total = std::accumulate(loads.begin(), loads.end(), 0.0);
+  if (this->InputImbalance <= this->ImbalanceThreshold || total <= 0.0)
+  {
+    output->ShallowCopy(input);
+    return;
+  }
+
+  this->OutputImbalance = GetImbalance(this->SplitCells(input, cellCosts, loads, output));
+}
+
+//----------------------------------------------------------------------------
+std::vector<double> vtkRebalanceFilter::SplitCells(vtkUnstructuredGrid* input,
+  const std::vector<double>& cellCosts, const std::vector<double>& loads,
+  vtkUnstructuredGrid* output)
+{
+  vtkMultiProcessController* controller = this->Controller;
+  const int numProcs = controller->GetNumberOfProcesses();
+  const int myId = controller->GetLocalProcessId();
+
+  // split the cells of all ranks, in rank order, into ranges of equal cost.
+  const double total = std::accumulate(loads.begin(), loads.end(), 0.0);
+  const double rangeCost = total / numProcs;
+  double position = std::accumulate(loads.begin(), loads.begin() + myId, 0.0);
+  std::vector<vtkSmartPointer<vtkIdList> > cells(numProcs);
+  std::vector<double> newLoads(numProcs, 0.0);
+  for (auto& ids : cells)
+  {
+    ids = vtkSmartPointer<vtkIdList>::New();
+  }
+  for (vtkIdType cc = 0, max = static_cast<vtkIdType>(cellCosts.size()); cc < max; ++cc)
+  {
+    const int dst = std::min(
+      numProcs - 1, static_cast<int>((position + 0.5 * cellCosts[cc]) / rangeCost));
+    cells[dst]->InsertNextId(cc);
+    newLoads[dst] += cellCosts[cc];
+    position += cellCosts[cc];
+  }
+
+  std::vector<double> globalNewLoads(numProcs);
+  controller->AllReduce(newLoads.data(), globalNewLoads.data(), numProcs, vtkCommunicator::SUM_OP);
+
+  std::vector<vtkIdType> counts(numProcs), allCounts(numProcs * numProcs);
+  for (int rank = 0; rank < numProcs; ++rank)
+  {
+    counts[rank] = cells[rank]->GetNumberOfIds();
+  }
+  controller->AllGather(counts.data(), allCounts.data(), numProcs);
+
+  auto extract = [input](vtkIdList* ids) {
+    vtkNew<vtkExtractCells> extractor;
+    extractor->SetInputData(input);
+    extractor->SetCellList(ids);
+    extractor->Update();
+    return vtkSmartPointer<vtkDataObject>(extractor->GetOutputDataObject(0));
+  };
+
+  vtkNew<vtkAppendFilter> appender;
+  if (counts[myId] > 0)
+  {
+    appender->AddInputDataObject(extract(cells[myId]));
+  }
+
+  // move the cells in the same order on all ranks, which avoids deadlocks.
+  for (int src = 0; src < numProcs; ++src)
+  {
+    for (int dst = 0; dst < numProcs; ++dst)
+    {
+      if (src == dst || allCounts[src * numProcs + dst] == 0)
+      {
+        continue;
+      }
+      if (myId == src)
+      {
+        controller->Send(extract(cells[dst]).GetPointer(), dst, REBALANCE_TAG);
+      }
+      else if (myId == dst)
+      {
+        vtkSmartPointer<vtkDataObject> piece;
+        piece.TakeReference(controller->ReceiveDataObject(src, REBALANCE_TAG));
+        appender->AddInputDataObject(piece);
+      }
+    }
+  }
+
+  if (appender->GetNumberOfInputConnections(0) > 0)
+  {
+    appender->Update();
+    output->ShallowCopy(appender->GetOutput());
+  }
+  output->GetFieldData()->PassData(input->GetFieldData());
+  return globalNewLoads;
+}
+
+//----------------------------------------------------------------------------
+void vtkRebalanceFilter::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Controller: " << this->Controller << endl;
+  os << indent << "ImbalanceThreshold: " << this->ImbalanceThreshold << endl;
+  os << indent << "InputImbalance: " << this->InputImbalance << endl;
+  os << indent << "OutputImbalance: " << this->OutputImbalance << endl;
+}
@@ -0,0 +1,122 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    vtkRebalanceFilter.h
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkRebalanceFilter
+ * @brief   evens out the work across ranks.
+ *
+ * vtkRebalanceFilter measures the cost of the data on each rank and, if the
+ * most loaded rank exceeds the mean cost by more than ImbalanceThreshold,
+ * moves data between ranks so that downstream filters take about the same
+ * time on all ranks. The cost is the number of cells, or the sum of the cell
+ * array selected using SetInputArrayToProcess(). Ghost cells cost nothing.
+ *
+ * Composite datasets are rebalanced by moving whole leaf datasets between
+ * ranks, keeping the composite structure. A leaf is never moved to a rank
+ * that already has a non-empty dataset at the same position in the structure.
+ * If that is not enough, for instance when every rank has a piece of the same
+ * leaves, the cells of the unstructured grid leaves are split across ranks as
+ * below, one leaf at a time.
+ *
+ * Unstructured grids are rebalanced by moving cells: the cells of all ranks,
+ * in rank order, are split into contiguous ranges of equal cost, one per
+ * rank. This keeps neighboring cells together, and mostly moves cells to the
+ * neighboring ranks.
+ *
+ * Other datasets are passed through. Ghost arrays are passed along with the
+ * cells, but ghost cells are not regenerated for the new partitioning.
+ */
+
+#ifndef vtkRebalanceFilter_h
+#define vtkRebalanceFilter_h
+
+#include "vtkPVVTKExtensionsDefaultModule.h" //needed for exports
+#include "vtkPassInputTypeAlgorithm.h"
+
+#include <vector> // for std::vector
+
+class vtkCompositeDataSet;
+class vtkDataSet;
+class vtkMultiProcessController;
+class vtkUnstructuredGrid;
+
+class VTKPVVTKEXTENSIONSDEFAULT_EXPORT vtkRebalanceFilter : public vtkPassInputTypeAlgorithm
+{
+public:
+  static vtkRebalanceFilter* New();
+  vtkTypeMacro(vtkRebalanceFilter, vtkPassInputTypeAlgorithm);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  //@{
+  /**
+   * Get/Set the controller to use. By default, the global controller.
+   */
+  void SetController(vtkMultiProcessController*);
+  vtkGetObjectMacro(Controller, vtkMultiProcessController);
+  //@}
+
+  //@{
+  /**
+   * Get/Set the ratio of the maximum to the mean cost per rank above which
+   * the data is rebalanced. Default is 1.1.
+   */
+  vtkSetClampMacro(ImbalanceThreshold, double, 1.0, VTK_DOUBLE_MAX);
+  vtkGetMacro(ImbalanceThreshold, double);
+  //@}
+
+  //@{
+  /**
+   * Returns the ratio of the maximum to the mean cost per rank before and
+   * after the last execution.
+   */
+  vtkGetMacro(InputImbalance, double);
+  vtkGetMacro(OutputImbalance, double);
+  //@}
+
+protected:
+  vtkRebalanceFilter();
+  ~vtkRebalanceFilter() override;
+
+  int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
+  int FillInputPortInformation(int port, vtkInformation* info) override;
+
+  /**
+   * Fills `costs` with the cost of each cell of the dataset and returns their
+   * sum.
+   */
+  double ComputeCellCosts(vtkDataSet* ds, std::vector<double>& costs);
+
+  void RebalanceBlocks(vtkCompositeDataSet* input, vtkCompositeDataSet* output);
+  void RebalanceCells(vtkUnstructuredGrid* input, vtkUnstructuredGrid* output);
+
+  /**
+   * Moves the cells of `input` so that each rank gets a contiguous range of
+   * equal cost of the cells of all ranks, in rank order. `cellCosts` are the
+   * costs of the cells of `input` and `loads` the total cost on each rank.
+   * Returns the total cost on each rank in `output`.
+   */
+  std::vector<double> SplitCells(vtkUnstructuredGrid* input, const std::vector<double>& cellCosts,
+    const std::vector<double>& loads, vtkUnstructuredGrid* output);
+
+  vtkMultiProcessController* Controller;
+  double ImbalanceThreshold;
+  double InputImbalance;
+  double OutputImbalance;
+
+private:
+  vtkRebalanceFilter(const vtkRebalanceFilter&) = delete;
+  void operator=(const vtkRebalanceFilter&) = delete;
+};
+
+#endif
@@ -0,0 +1,128 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    TestCSVExporter.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+
+#include "vtkCSVExporter.h"
+#include "vtkCharArray.h"
+#include "vtkCommand.h"
+#include "vtkDoubleArray.h"
+#include "vtkFieldData.h"
+#include "vtkIntArray.h"
+#include "vtkNew.h"
+#include "vtkStringArray.h"
+#include "vtkTestUtilities.h"
+#include "vtkVariant.h"
+
+#include <sstream>
+#include <string>
+
+#define expect(x, msg)                                                                             \
+  if (!(x))                                                                                        \
+  {                                                                                                \
+    cerr << __LINE__ << ": " msg << endl;                                                          \
+    return EXIT_FAILURE;                                                                           \
+  }
+
+namespace
+{
+class ProgressObserver : public vtkCommand
+{
+public:
+  static ProgressObserver* New() { return new ProgressObserver; }
+  void Execute(vtkObject*, unsigned long, void* calldata) override
+  {
+    const double progress = *static_cast<double*>(calldata);
+    this->Increasing = this->Increasing && progress > this->Last;
+    this->Count++;
+    this->Last = progress;
+  }
+  int Count = 0;
+  double Last = 0.0;
+  bool Increasing = true;
+};
+}
+
+int TestCSVExporter(int argc, char* argv[])
+{
+  char* tempDir =
+    vtkTestUtilities::GetArgOrEnvOrDefault("-T", argc, argv, "VTK_TEMP_DIR", "Testing/Temporary");
+  const std::string fname = std::string(tempDir) + "/TestCSVExporter.csv";
+  delete[] tempDir;
+
+  const vtkIdType numRows = 100;
+  vtkNew<vtkDoubleArray> vectors;
+  vectors->SetName("Vectors");
+  vectors->SetNumberOfComponents(2);
+  vtkNew<vtkIntArray> ids;
+  ids->SetName("Ids");
+  vtkNew<vtkCharArray> flags;
+  flags->SetName("Flags");
+  vtkNew<vtkStringArray> labels;
+  labels->SetName("Labels");
+  vtkNew<vtkIntArray> hidden;
+  hidden->SetName("Hidden");
+  for (vtkIdType cc = 0; cc < numRows; cc++)
+  {
+    vectors->InsertNextTuple2(cc / 3.0, -1.0e-7 * cc);
+    ids->InsertNextValue(static_cast<int>(cc * 1000));
+    flags->InsertNextValue(static_cast<char>(cc % 2));
+    labels->InsertNextValue("label" + vtkVariant(cc).ToString());
+    hidden->InsertNextValue(0);
+  }
+  vtkNew<vtkFieldData> data;
+  data->AddArray(vectors.GetPointer());
+  data->AddArray(ids.GetPointer());
+  data->AddArray(flags.GetPointer());
+  data->AddArray(labels.GetPointer());
+  data->AddArray(hidden.GetPointer());
+
+  // Expected text, formatted a value at a time through vtkVariant.
+  std::ostringstream rows;
+  for (vtkIdType cc = 0; cc < numRows; cc++)
+  {
+    rows << vtkVariant(vectors->GetComponent(cc, 0)).ToString() << ","
+         << vtkVariant(vectors->GetComponent(cc, 1)).ToString() << ","
+         << vtkVariant(ids->GetValue(cc)).ToString() << ","
+         << vtkVariant(static_cast<int>(flags->GetValue(cc))).ToString() << ","
+         << labels->GetValue(cc) << "\n";
+  }
+  const std::string expected = "Vectors:0,Vectors:1,Ids,Flags,Labels\n" + rows.str() + rows.str();
+
+  vtkNew<vtkCSVExporter> exporter;
+  vtkNew<ProgressObserver> observer;
+  exporter->AddObserver(vtkCommand::ProgressEvent, observer.GetPointer());
+  exporter->SetFileName(fname.c_str());
+  exporter->SetRowsPerChunk(7);
+  exporter->SetColumnLabel("Hidden", nullptr);
+  exporter->SetTotalNumberOfRows(2 * numRows);
+  expect(exporter->Open(), "failed to open " << fname);
+  exporter->WriteHeader(data.GetPointer());
+
+  // Progress covers the rows of all the WriteData calls.
+  exporter->WriteData(data.GetPointer());
+  expect(observer->Count == 15, "expected one progress event per chunk, got " << observer->Count);
+  expect(observer->Last == 0.5, "progress is not 0.5 after half the rows");
+  exporter->WriteData(data.GetPointer());
+  exporter->Close();
+
+  expect(observer->Count == 30, "expected one progress event per chunk, got " << observer->Count);
+  expect(observer->Increasing, "progress did not increase with each chunk");
+  expect(observer->Last == 1.0, "progress did not reach 1.0");
+
+  ifstream file(fname.c_str());
+  std::ostringstream written;
+  written << file.rdbuf();
+  expect(written.str() == expected, "unexpected output:\n" << written.str());
+  return EXIT_SUCCESS;
+}
@@ -14,16 +14,141 @@
 =========================================================================*/
 #include "vtkCSVExporter.h"
 
+#include "vtkCommand.h"
 #include "vtkDataArray.h"
 #include "vtkFieldData.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
 
+#include <algorithm>
 #include <cassert>
+#include <locale>
 #include <map>
 #include <sstream>
 #include <string>
+#include <vector>
 #include <vtksys/SystemTools.hxx>
 
+namespace
+{
+// Values are written the way vtkVariant::ToString() does, except that char
+// types are written as integers to avoid weird characters in the output.
+template <typename T>
+void vtkCSVExporterPrint(std::ostream& stream, T value)
+{
+  stream << value;
+}
+void vtkCSVExporterPrint(std::ostream& stream, char value)
+{
+  stream << static_cast<int>(value);
+}
+void vtkCSVExporterPrint(std::ostream& stream, signed char value)
+{
+  stream << static_cast<int>(value);
+}
+void vtkCSVExporterPrint(std::ostream& stream, unsigned char value)
+{
+  stream << static_cast<int>(value);
+}
+
+template <typename T>
+void vtkCSVExporterPrintValue(std::ostream& stream, const void* data, vtkIdType index)
+{
+  vtkCSVExporterPrint(stream, static_cast<const T*>(data)[index]);
+}
+
+//----------------------------------------------------------------------------
+// Formats chunks of rows of the exported columns as text, one chunk per
+// thread.
+class vtkCSVExporterFormatter
+{
+public:
+  struct Column
+  {
+    vtkAbstractArray* Array;
+    // Set for data arrays with the standard memory layout, whose values are
+    // read directly. The other arrays go through vtkVariant.
+    void (*PrintValue)(std::ostream&, const void*, vtkIdType);
+    const void* Data;
+    int NumberOfComponents;
+  };
+
+  std::vector<Column> Columns;
+  std::string Delimiter;
+  vtkIdType FirstRow;
+  vtkIdType EndRow;
+  vtkIdType RowsPerChunk;
+  std::vector<std::string> Chunks;
+
+  void AddColumn(vtkAbstractArray* array)
+  {
+    Column column;
+    column.Array = array;
+    column.PrintValue = nullptr;
+    column.Data = nullptr;
+    column.NumberOfComponents = array->GetNumberOfComponents();
+    vtkDataArray* darray = vtkDataArray::SafeDownCast(array);
+    if (darray && darray->HasStandardMemoryLayout())
+    {
+      switch (darray->GetDataType())
+      {
+        vtkTemplateMacro(column.PrintValue = &vtkCSVExporterPrintValue<VTK_TT>);
+      }
+      column.Data = column.PrintValue ? darray->GetVoidPointer(0) : nullptr;
+    }
+    this->Columns.push_back(column);
+  }
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    std::ostringstream stream;
+    stream.imbue(std::locale::classic());
+    for (vtkIdType chunk = begin; chunk < end; ++chunk)
+    {
+      stream.str(std::string());
+      const vtkIdType rowBegin = this->FirstRow + chunk * this->RowsPerChunk;
+      const vtkIdType rowEnd = std::min(rowBegin + this->RowsPerChunk, this->EndRow);
+      for (vtkIdType row = rowBegin; row < rowEnd; ++row)
+      {
+        this->FormatRow(stream, row);
+      }
+      this->Chunks[chunk] = stream.str();
+    }
+  }
+
+private:
+  void FormatRow(std::ostream& stream, vtkIdType row)
+  {
+    bool first = true;
+    for (const Column& column : this->Columns)
+    {
+      for (int comp = 0; comp < column.NumberOfComponents; comp++)
+      {
+        if (!first)
+        {
+          stream << this->Delimiter;
+        }
+        const vtkIdType index = row * column.NumberOfComponents + comp;
+        if (column.PrintValue)
+        {
+          column.PrintValue(stream, column.Data, index);
+        }
+        else
+        {
+          vtkVariant value = column.Array->GetVariantValue(index);
+          value = (value.IsChar() || value.IsSignedChar() || value.IsUnsignedChar())
+            ? vtkVariant(value.ToInt())
+            : value;
+          stream << value.ToString().c_str();
+        }
+        first = false;
+      }
+    }
+    stream << "\n";
+  }
+};
+}
+
 class vtkCSVExporter::vtkInternals
 {
 public:
@@ -82,6 +207,9 @@ vtkCSVExporter::vtkCSVExporter()
   this->SetFieldDelimiter(",");
   this->Internals = new vtkInternals();
   this->Mode = STREAM_ROWS;
+  this->RowsPerChunk = 8192;
+  this->TotalNumberOfRows = 0;
+  this->NumberOfRowsWritten = 0;
 }
 
 //----------------------------------------------------------------------------
@@ -145,6 +273,7 @@ bool vtkCSVExporter::Open(vtkCSVExporter::ExporterModes mode)
     return false;
   }
   this->Mode = mode;
+  this->NumberOfRowsWritten = 0;
   return true;
 }
 
@@ -236,42 +365,51 @@ void vtkCSVExporter::WriteData(vtkFieldData* data)
     return;
   }
 
-  vtkIdType numTuples = data->GetNumberOfTuples();
-  int numArrays = data->GetNumberOfArrays();
-  for (vtkIdType tuple = 0; tuple < numTuples; tuple++)
+  vtkCSVExporterFormatter formatter;
+  formatter.Delimiter = this->FieldDelimiter ? this->FieldDelimiter : "";
+  formatter.RowsPerChunk = this->RowsPerChunk;
+  const int numArrays = data->GetNumberOfArrays();
+  for (int cc = 0; cc < numArrays; cc++)
   {
-    bool first = true;
-    for (int cc = 0; cc < numArrays; cc++)
+    vtkAbstractArray* array = data->GetAbstractArray(cc);
+    if (this->GetColumnLabel(array->GetName()) == nullptr)
     {
-      vtkAbstractArray* array = data->GetAbstractArray(cc);
-      auto name = array->GetName();
-      auto label = this->GetColumnLabel(name);
-      if (label == nullptr)
-      {
-        // skip columns with no names.
-        continue;
-      }
+      // skip columns with no names.
+      continue;
+    }
+    formatter.AddColumn(array);
+  }
 
-      int numComps = array->GetNumberOfComponents();
-      for (int comp = 0; comp < numComps; comp++)
-      {
-        if (!first)
-        {
-          (*this->FileStream) << this->FieldDelimiter;
-        }
-        vtkVariant value = array->GetVariantValue(tuple * numComps + comp);
+  // Rows are formatted a batch of chunks at a time, one chunk per thread, and
+  // the chunks of a batch are written in order. Keeping batches that small
+  // bounds the text held in memory and lets progress be reported, from this
+  // thread, about as often as a single chunk is formatted.
+  const vtkIdType numTuples = data->GetNumberOfTuples();
+  const vtkIdType numChunks = (numTuples + this->RowsPerChunk - 1) / this->RowsPerChunk;
+  const vtkIdType chunksPerBatch =
+    std::max(static_cast<vtkIdType>(vtkSMPTools::GetEstimatedNumberOfThreads()), vtkIdType(1));
+  for (vtkIdType batch = 0; batch < numChunks; batch += chunksPerBatch)
+  {
+    const vtkIdType batchSize = std::min(chunksPerBatch, numChunks - batch);
+    formatter.FirstRow = batch * this->RowsPerChunk;
+    formatter.EndRow = std::min(formatter.FirstRow + batchSize * this->RowsPerChunk, numTuples);
+    formatter.Chunks.assign(batchSize, std::string());
+    vtkSMPTools::For(0, batchSize, 1, formatter);
 
-        // to avoid weird characters in the output, cast char /
-        // signed char / unsigned char variables to integers
-        value = (value.IsChar() || value.IsSignedChar() || value.IsUnsignedChar())
-          ? vtkVariant(value.ToInt())
-          : value;
+    for (vtkIdType chunk = 0; chunk < batchSize; ++chunk)
+    {
+      const std::string& text = formatter.Chunks[chunk];
+      this->FileStream->write(text.c_str(), text.size());
 
-        (*this->FileStream) << value.ToString().c_str();
-        first = false;
-      }
+      const vtkIdType rowsInChunk =
+        std::min(this->RowsPerChunk, numTuples - (batch + chunk) * this->RowsPerChunk);
+      this->NumberOfRowsWritten += rowsInChunk;
+      double progress = (this->TotalNumberOfRows > 0)
+        ? static_cast<double>(this->NumberOfRowsWritten) / this->TotalNumberOfRows
+        : static_cast<double>(batch + chunk + 1) / numChunks;
+      progress = std::min(progress, 1.0);
+      this->InvokeEvent(vtkCommand::ProgressEvent, &progress);
     }
-    (*this->FileStream) << "\n";
   }
 }
 
@@ -308,4 +446,6 @@ void vtkCSVExporter::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "FileName: " << (this->FileName ? this->FileName : "(none)") << endl;
   os << indent << "FieldDelimiter: " << (this->FieldDelimiter ? this->FieldDelimiter : "(none)")
      << endl;
+  os << indent << "RowsPerChunk: " << this->RowsPerChunk << endl;
+  os << indent << "TotalNumberOfRows: " << this->TotalNumberOfRows << endl;
 }
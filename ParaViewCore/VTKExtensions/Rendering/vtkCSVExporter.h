@@ -34,6 +34,10 @@
  *
  * One has to pick which mode the exporter is operating in during the OpenFile()
  * call.
+ *
+ * In \c STREAM_ROWS mode, WriteData formats the rows in chunks of
+ * RowsPerChunk rows on multiple threads and writes the chunks in order. A
+ * ProgressEvent is fired after each chunk is written.
 */
 
 #ifndef vtkCSVExporter_h
@@ -69,6 +73,25 @@ public:
   vtkGetStringMacro(FieldDelimiter);
   //@}
 
+  //@{
+  /**
+   * Get/Set the number of rows formatted together by a thread in STREAM_ROWS
+   * mode (8192 by default).
+   */
+  vtkSetClampMacro(RowsPerChunk, vtkIdType, 1, VTK_ID_MAX);
+  vtkGetMacro(RowsPerChunk, vtkIdType);
+  //@}
+
+  //@{
+  /**
+   * Get/Set the number of rows that will be written in STREAM_ROWS mode. This
+   * is only used to report progress. When 0 (default), progress is reported
+   * for each WriteData call separately.
+   */
+  vtkSetMacro(TotalNumberOfRows, vtkIdType);
+  vtkGetMacro(TotalNumberOfRows, vtkIdType);
+  //@}
+
   enum ExporterModes
   {
     STREAM_ROWS,
@@ -130,6 +153,9 @@ protected:
   char* FieldDelimiter;
   ofstream* FileStream;
   ExporterModes Mode;
+  vtkIdType RowsPerChunk;
+  vtkIdType TotalNumberOfRows;
+  vtkIdType NumberOfRowsWritten;
 
 private:
   vtkCSVExporter(const vtkCSVExporter&) = delete;
@@ -20,6 +20,7 @@
 #include "vtkAppendArcLength.h"
 #include "vtkAppendRectilinearGrid.h"
 #include "vtkAttributeDataReductionFilter.h"
+#include "vtkAttributeDataReductionOperator.h"
 #include "vtkAttributeDataToTableFilter.h"
 #include "vtkBSPCutsGenerator.h"
 #include "vtkBlockDeliveryPreprocessor.h"
@@ -111,6 +112,7 @@
 #include "vtkPVLinearExtrusionFilter.h"
 #include "vtkPVMergeTables.h"
 #include "vtkPVNullSource.h"
+#include "vtkPVPipelineProfiler.h"
 #include "vtkPVPlane.h"
 #include "vtkPVPostFilter.h"
 #include "vtkPVPostFilterExecutive.h"
@@ -133,6 +135,7 @@
 #include "vtkPointHandleRepresentationSphere.h"
 #include "vtkPolyLineToRectilinearGridFilter.h"
 #include "vtkQuerySelectionSource.h"
+#include "vtkRebalanceFilter.h"
 #include "vtkRectilinearGridConnectivity.h"
 #include "vtkReductionFilter.h"
 #include "vtkSciVizStatistics.h"
@@ -201,6 +204,7 @@ int ParaViewCoreVTKExtensionsPrintSelf(int, char* [])
   PRINT_SELF(vtkAppendArcLength);
   PRINT_SELF(vtkAppendRectilinearGrid);
   PRINT_SELF(vtkAttributeDataReductionFilter);
+  PRINT_SELF(vtkAttributeDataReductionOperator);
   PRINT_SELF(vtkAttributeDataToTableFilter);
   PRINT_SELF(vtkBlockDeliveryPreprocessor);
   PRINT_SELF(vtkBSPCutsGenerator);
@@ -296,6 +300,7 @@ int ParaViewCoreVTKExtensionsPrintSelf(int, char* [])
   PRINT_SELF(vtkPVLODVolume);
   PRINT_SELF(vtkPVMergeTables);
   PRINT_SELF(vtkPVNullSource);
+  PRINT_SELF(vtkPVPipelineProfiler);
   PRINT_SELF(vtkPVPlane);
   PRINT_SELF(vtkPVPostFilter);
   PRINT_SELF(vtkPVPostFilterExecutive);
@@ -313,6 +318,7 @@ int ParaViewCoreVTKExtensionsPrintSelf(int, char* [])
   PRINT_SELF(vtkPVTrivialProducer);
   PRINT_SELF(vtkPVUpdateSuppressor);
   PRINT_SELF(vtkQuerySelectionSource);
+  PRINT_SELF(vtkRebalanceFilter);
   PRINT_SELF(vtkRectilinearGridConnectivity);
   PRINT_SELF(vtkReductionFilter);
   PRINT_SELF(vtkSciVizStatistics);
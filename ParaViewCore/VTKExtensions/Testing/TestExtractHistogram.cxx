@@ -13,13 +13,28 @@
 
 =========================================================================*/
 
+#include "vtkCallbackCommand.h"
 #include "vtkCellData.h"
+#include "vtkCommand.h"
 #include "vtkDoubleArray.h"
 #include "vtkExtractHistogram.h"
 #include "vtkIntArray.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
 #include "vtkSmartPointer.h"
 #include "vtkSphereSource.h"
 #include "vtkTable.h"
+#include "vtkUnsignedCharArray.h"
+
+namespace
+{
+void CountProgressEvents(vtkObject*, unsigned long, void* clientdata, void*)
+{
+  ++(*static_cast<int*>(clientdata));
+}
+}
 
 /// Test the output of the vtkExtractHistogram filter in a simple serial case
 int TestExtractHistogram(int, char* [])
@@ -92,5 +107,71 @@ int TestExtractHistogram(int, char* [])
     vtkGenericWarningMacro("incorrect bin value.");
     return 1;
   }
+
+  // Ghost points are not counted.
+  vtkNew<vtkPolyData> ghosted;
+  ghosted->ShallowCopy(sphere->GetOutput());
+  vtkNew<vtkUnsignedCharArray> ghosts;
+  ghosts->SetName(vtkDataSetAttributes::GhostArrayName());
+  ghosts->SetNumberOfTuples(ghosted->GetNumberOfPoints());
+  ghosts->FillComponent(0, 0);
+  ghosts->SetValue(0, vtkDataSetAttributes::DUPLICATEPOINT);
+  ghosts->SetValue(1, vtkDataSetAttributes::DUPLICATEPOINT);
+  ghosted->GetPointData()->AddArray(ghosts);
+
+  extraction->SetInputData(ghosted);
+  extraction->Update();
+  vtkIntArray* const ghosted_values =
+    vtkIntArray::SafeDownCast(extraction->GetOutput()->GetRowData()->GetArray((int)1));
+  int total = 0;
+  for (int cc = 0; ghosted_values && cc < bin_count; ++cc)
+  {
+    total += ghosted_values->GetValue(cc);
+  }
+  if (total != ghosted->GetNumberOfPoints() - 2)
+  {
+    vtkGenericWarningMacro("ghost points were counted.");
+    return 1;
+  }
+
+  // Large arrays are binned in several batches, with progress reported
+  // after each one.
+  const vtkIdType num_values = 250000;
+  vtkNew<vtkPolyData> large;
+  vtkNew<vtkPoints> points;
+  points->SetNumberOfPoints(num_values);
+  large->SetPoints(points);
+  vtkNew<vtkDoubleArray> values;
+  values->SetName("values");
+  values->SetNumberOfTuples(num_values);
+  for (vtkIdType cc = 0; cc < num_values; ++cc)
+  {
+    values->SetValue(cc, cc % bin_count);
+  }
+  large->GetPointData()->AddArray(values);
+
+  int progress_events = 0;
+  vtkNew<vtkCallbackCommand> progress;
+  progress->SetCallback(CountProgressEvents);
+  progress->SetClientData(&progress_events);
+  extraction->AddObserver(vtkCommand::ProgressEvent, progress);
+  extraction->SetInputData(large);
+  extraction->SetInputArrayToProcess(0, 0, 0, vtkDataSet::FIELD_ASSOCIATION_POINTS, "values");
+  extraction->Update();
+  vtkIntArray* const large_values =
+    vtkIntArray::SafeDownCast(extraction->GetOutput()->GetRowData()->GetArray((int)1));
+  for (int cc = 0; large_values && cc < bin_count; ++cc)
+  {
+    if (large_values->GetValue(cc) != num_values / bin_count + (cc < num_values % bin_count))
+    {
+      vtkGenericWarningMacro("incorrect bin value for batched binning.");
+      return 1;
+    }
+  }
+  if (!large_values || progress_events < 3)
+  {
+    vtkGenericWarningMacro("progress was not reported for each batch.");
+    return 1;
+  }
   return 0;
 }
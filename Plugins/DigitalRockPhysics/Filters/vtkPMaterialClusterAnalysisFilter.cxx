@@ -32,9 +32,10 @@
 
 #define BROADCAST_VALUES_TAG 621
 
+#include <algorithm>
 #include <array>
-#include <map>
-#include <set>
+#include <unordered_map>
+#include <vector>
 
 //----------------------------------------------------------------------------
 vtkStandardNewMacro(vtkPMaterialClusterAnalysisFilter);
@@ -60,44 +61,178 @@ void vtkPMaterialClusterAnalysisFilter::PrintSelf(ostream& os, vtkIndent indent)
 //----------------------------------------------------------------------------
 namespace
 {
-typedef std::map<int, std::pair<unsigned int, std::array<double, 3> > >
-  LabelValuesMap;                                    // cluster label -> { count, barycenter }
-typedef std::map<int, std::set<int> > LabelRanksMap; // cluster label -> { list of rank using it }
+// Label ranges smaller than the number of points divided by this factor are
+// accumulated in dense per-thread arrays indexed by label, larger ones in hash
+// tables. This bounds the dense accumulators to a few bytes per point.
+const vtkIdType DENSE_LABEL_RANGE_DIVISOR = 16;
 
 //----------------------------------------------------------------------------
-void Barycenter(unsigned int weight1, const double* point1, unsigned int weight2,
-  const double* point2, double* barycenter)
+// Per-cluster values stored in flat arrays sorted by label.
+struct ClusterValues
 {
-  double div = weight1 + weight2;
-  for (int i = 0; i < 3; i++)
+  std::vector<int> Labels;
+  std::vector<double> Volumes;
+  std::vector<double> Centers; // 3 components per cluster
+
+  size_t Size() const { return this->Labels.size(); }
+
+  void Clear()
   {
-    barycenter[i] = (point1[i] * weight1 + point2[i] * weight2) / div;
+    this->Labels.clear();
+    this->Volumes.clear();
+    this->Centers.clear();
   }
-}
+
+  void Reserve(size_t size)
+  {
+    this->Labels.reserve(size);
+    this->Volumes.reserve(size);
+    this->Centers.reserve(3 * size);
+  }
+
+  void Append(int label, double volume, const double* center)
+  {
+    this->Labels.push_back(label);
+    this->Volumes.push_back(volume);
+    this->Centers.insert(this->Centers.end(), center, center + 3);
+  }
+
+  // Returns the index of label, or -1 if it is not present.
+  vtkIdType Find(int label) const
+  {
+    auto iter = std::lower_bound(this->Labels.begin(), this->Labels.end(), label);
+    if (iter == this->Labels.end() || *iter != label)
+    {
+      return -1;
+    }
+    return static_cast<vtkIdType>(iter - this->Labels.begin());
+  }
+};
+
+//----------------------------------------------------------------------------
+// Accumulates { count, sum of x, sum of y, sum of z } for labels in a compact
+// range, without any per-label allocation.
+struct DenseAccumulator
+{
+  void Initialize(int minLabel, int maxLabel)
+  {
+    this->MinLabel = minLabel;
+    this->Sums.assign(4 * (static_cast<size_t>(maxLabel) - minLabel + 1), 0.);
+  }
+
+  void Add(int label, const double* point)
+  {
+    double* sums = &this->Sums[4 * static_cast<size_t>(label - this->MinLabel)];
+    sums[0] += 1.;
+    sums[1] += point[0];
+    sums[2] += point[1];
+    sums[3] += point[2];
+  }
+
+  void Merge(const DenseAccumulator& other)
+  {
+    for (size_t i = 0; i < this->Sums.size(); i++)
+    {
+      this->Sums[i] += other.Sums[i];
+    }
+  }
+
+  void Export(ClusterValues& values) const
+  {
+    values.Clear();
+    double center[3];
+    for (size_t i = 0; i < this->Sums.size(); i += 4)
+    {
+      double count = this->Sums[i];
+      if (count > 0.)
+      {
+        for (int c = 0; c < 3; c++)
+        {
+          center[c] = this->Sums[i + c + 1] / count;
+        }
+        values.Append(this->MinLabel + static_cast<int>(i / 4), count, center);
+      }
+    }
+  }
+
+  int MinLabel = 0;
+  std::vector<double> Sums;
+};
+
+//----------------------------------------------------------------------------
+// Same as DenseAccumulator for sparse label ranges.
+struct SparseAccumulator
+{
+  void Initialize(int, int) {}
+
+  void Add(int label, const double* point)
+  {
+    std::array<double, 4>& sums = this->Sums[label];
+    sums[0] += 1.;
+    sums[1] += point[0];
+    sums[2] += point[1];
+    sums[3] += point[2];
+  }
+
+  void Merge(const SparseAccumulator& other)
+  {
+    for (const auto& it : other.Sums)
+    {
+      std::array<double, 4>& sums = this->Sums[it.first];
+      for (int c = 0; c < 4; c++)
+      {
+        sums[c] += it.second[c];
+      }
+    }
+  }
+
+  void Export(ClusterValues& values) const
+  {
+    std::vector<int> labels;
+    labels.reserve(this->Sums.size());
+    for (const auto& it : this->Sums)
+    {
+      labels.push_back(it.first);
+    }
+    std::sort(labels.begin(), labels.end());
+
+    values.Clear();
+    values.Reserve(labels.size());
+    double center[3];
+    for (int label : labels)
+    {
+      const std::array<double, 4>& sums = this->Sums.find(label)->second;
+      for (int c = 0; c < 3; c++)
+      {
+        center[c] = sums[c + 1] / sums[0];
+      }
+      values.Append(label, sums[0], center);
+    }
+  }
+
+  std::unordered_map<int, std::array<double, 4> > Sums;
+};
 
 //----------------------------------------------------------------------------
-void AppendMapToTable(LabelValuesMap& lvMap, vtkTable* table)
+void ValuesToTable(const ClusterValues& values, vtkTable* table)
 {
+  vtkIdType size = static_cast<vtkIdType>(values.Size());
+
   vtkNew<vtkIntArray> labelArray;
   labelArray->SetName("Label");
-  labelArray->SetNumberOfTuples(lvMap.size());
+  labelArray->SetNumberOfTuples(size);
+  std::copy(values.Labels.begin(), values.Labels.end(), labelArray->GetPointer(0));
 
   vtkNew<vtkDoubleArray> volumeArray;
   volumeArray->SetName("Volume");
-  volumeArray->SetNumberOfTuples(lvMap.size());
+  volumeArray->SetNumberOfTuples(size);
+  std::copy(values.Volumes.begin(), values.Volumes.end(), volumeArray->GetPointer(0));
 
   vtkNew<vtkDoubleArray> barycenterArray;
   barycenterArray->SetName("Center");
   barycenterArray->SetNumberOfComponents(3);
-  barycenterArray->SetNumberOfTuples(lvMap.size());
-
-  vtkIdType idx = 0;
-  for (auto it = lvMap.begin(); it != lvMap.end(); ++it, ++idx)
-  {
-    labelArray->SetValue(idx, it->first);
-    volumeArray->SetValue(idx, it->second.first);
-    barycenterArray->SetTuple(idx, it->second.second.data());
-  }
+  barycenterArray->SetNumberOfTuples(size);
+  std::copy(values.Centers.begin(), values.Centers.end(), barycenterArray->GetPointer(0));
 
   table->AddColumn(labelArray.Get());
   table->AddColumn(volumeArray.Get());
@@ -105,47 +240,103 @@ void AppendMapToTable(LabelValuesMap& lvMap, vtkTable* table)
 }
 
 //----------------------------------------------------------------------------
-bool AppendTableToMap(vtkTable* table, LabelValuesMap& lvMap, int rockfillLabel, bool center = true)
+bool TableToValues(vtkTable* table, ClusterValues& values)
 {
   vtkIntArray* labelArray = vtkIntArray::SafeDownCast(table->GetColumnByName("Label"));
   vtkDoubleArray* volumeArray = vtkDoubleArray::SafeDownCast(table->GetColumnByName("Volume"));
   vtkDoubleArray* barycenterArray = vtkDoubleArray::SafeDownCast(table->GetColumnByName("Center"));
 
-  if (!labelArray || !volumeArray || (!barycenterArray && center))
+  if (!labelArray || !volumeArray || !barycenterArray ||
+    barycenterArray->GetNumberOfComponents() != 3)
   {
-    vtkErrorWithObjectMacro(table, "Could not Append table to map");
+    vtkErrorWithObjectMacro(table, "Could not convert table to cluster values");
     return false;
   }
 
-  std::array<double, 3> barycenter;
   vtkIdType nRows = table->GetNumberOfRows();
-  for (vtkIdType iRow = 0; iRow < nRows; iRow++)
+  values.Labels.assign(labelArray->GetPointer(0), labelArray->GetPointer(0) + nRows);
+  values.Volumes.assign(volumeArray->GetPointer(0), volumeArray->GetPointer(0) + nRows);
+  values.Centers.assign(
+    barycenterArray->GetPointer(0), barycenterArray->GetPointer(0) + 3 * nRows);
+  return true;
+}
+
+//----------------------------------------------------------------------------
+// Merge label-sorted cluster values, combining the clusters shared by several
+// inputs into their weighted barycenter.
+void MergeValues(const std::vector<ClusterValues>& inputs, ClusterValues& output)
+{
+  size_t total = 0;
+  for (const ClusterValues& values : inputs)
   {
-    int label = labelArray->GetValue(iRow);
-    if (label != rockfillLabel)
+    total += values.Size();
+  }
+
+  // (label, input index, row) of every input row, sorted by label
+  std::vector<std::array<int, 3> > rows;
+  rows.reserve(total);
+  for (size_t i = 0; i < inputs.size(); i++)
+  {
+    for (size_t row = 0; row < inputs[i].Size(); row++)
     {
-      double volume = volumeArray->GetValue(iRow);
-      if (center)
-      {
-        barycenterArray->GetTuple(iRow, &barycenter[0]);
-      }
-      auto iter = lvMap.emplace(label, std::make_pair(volume, barycenter));
-      if (!iter.second)
+      rows.push_back({ { inputs[i].Labels[row], static_cast<int>(i), static_cast<int>(row) } });
+    }
+  }
+  std::sort(rows.begin(), rows.end());
+
+  output.Clear();
+  output.Reserve(total);
+  for (size_t first = 0; first < rows.size();)
+  {
+    double volume = 0.;
+    double sums[3] = { 0., 0., 0. };
+    size_t last = first;
+    for (; last < rows.size() && rows[last][0] == rows[first][0]; last++)
+    {
+      const ClusterValues& values = inputs[rows[last][1]];
+      size_t row = static_cast<size_t>(rows[last][2]);
+      double rowVolume = values.Volumes[row];
+      volume += rowVolume;
+      for (int c = 0; c < 3; c++)
       {
-        if (center)
-        {
-          Barycenter(iter.first->second.first, &iter.first->second.second[0], volume,
-            &barycenter[0], &iter.first->second.second[0]);
-        }
-        iter.first->second.first += volume;
+        sums[c] += values.Centers[3 * row + c] * rowVolume;
       }
     }
+    for (int c = 0; c < 3; c++)
+    {
+      sums[c] /= volume;
+    }
+    output.Append(rows[first][0], volume, sums);
+    first = last;
   }
-  return true;
 }
 
 //----------------------------------------------------------------------------
-int ReduceTable(vtkAlgorithm* that, LabelValuesMap& lvMap, vtkTable* table, int rockfillLabel)
+// Extract from global the clusters whose label is present in local.
+// Both are sorted by label, so this is a linear intersection.
+void IntersectValues(const ClusterValues& global, const ClusterValues& local, ClusterValues& output)
+{
+  output.Clear();
+  output.Reserve(local.Size());
+  size_t iGlobal = 0;
+  for (int label : local.Labels)
+  {
+    while (iGlobal < global.Size() && global.Labels[iGlobal] < label)
+    {
+      iGlobal++;
+    }
+    if (iGlobal < global.Size() && global.Labels[iGlobal] == label)
+    {
+      output.Append(label, global.Volumes[iGlobal], &global.Centers[3 * iGlobal]);
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+// Reduce the local cluster values of all ranks. On output, the root holds all
+// the clusters and every other rank holds the global values of the clusters it
+// contributed to.
+int ReduceValues(vtkAlgorithm* that, ClusterValues& values)
 {
   vtkMultiProcessController* controller = vtkMultiProcessController::GetGlobalController();
   if (!controller || (controller && controller->GetNumberOfProcesses() <= 1))
@@ -155,16 +346,16 @@ int ReduceTable(vtkAlgorithm* that, LabelValuesMap& lvMap, vtkTable* table, int
 
   that->SetProgressText("Reducing data");
   that->UpdateProgress(0.0);
+
+  vtkNew<vtkTable> table;
+  ValuesToTable(values, table);
   std::vector<vtkSmartPointer<vtkDataObject> > recv;
   controller->Gather(table, recv, 0);
-  while (table->GetNumberOfColumns() != 0)
-  {
-    table->RemoveColumn(0);
-  }
 
   if (controller->GetLocalProcessId() == 0)
   {
-    LabelRanksMap ranksMap;
+    std::vector<ClusterValues> rankValues(recv.size());
+    rankValues[0] = std::move(values);
     for (size_t iRank = 1; iRank < recv.size(); iRank++)
     {
       vtkTable* localTable = vtkTable::SafeDownCast(recv[iRank]);
@@ -173,93 +364,69 @@ int ReduceTable(vtkAlgorithm* that, LabelValuesMap& lvMap, vtkTable* table, int
         vtkErrorWithObjectMacro(controller, "Could not reduce tables from other ranks");
         return 0;
       }
-
-      // Create Label Values Map
-      if (!AppendTableToMap(localTable, lvMap, rockfillLabel))
+      if (!TableToValues(localTable, rankValues[iRank]))
       {
         vtkErrorWithObjectMacro(
-          controller, "Could not append table to map. This rank will be ignored.");
-        continue;
-      }
-
-      // Create ranks map
-      vtkIdType nRows = localTable->GetNumberOfRows();
-      vtkIntArray* tmpLabelArray = vtkIntArray::SafeDownCast(localTable->GetColumnByName("Label"));
-      if (!tmpLabelArray)
-      {
-        vtkErrorWithObjectMacro(
-          controller, "Could not create ranks map. This rank will be ignored.");
-        continue;
-      }
-      for (vtkIdType iRow = 0; iRow < nRows; iRow++)
-      {
-        int tmpLabel = tmpLabelArray->GetValue(iRow);
-        ranksMap[tmpLabel].insert(static_cast<int>(iRank));
+          controller, "Could not read cluster values. This rank will be ignored.");
       }
     }
-    that->UpdateProgress(0.8);
+    recv.clear();
 
-    // Export map to a vtkTable
-    AppendMapToTable(lvMap, table);
+    MergeValues(rankValues, values);
+    that->UpdateProgress(0.8);
 
-    // Broadcast it rank by rank using the ranks map
-    vtkDataSetAttributes* attr = table->GetRowData();
-    vtkIntArray* labelArray = vtkIntArray::SafeDownCast(table->GetColumnByName("Label"));
+    // Send every rank the global values of its own clusters only
+    ClusterValues localValues;
     for (int iRank = 1; iRank < controller->GetNumberOfProcesses(); iRank++)
     {
+      IntersectValues(values, rankValues[iRank], localValues);
       vtkNew<vtkTable> localTable;
-      vtkDataSetAttributes* localAttr = localTable->GetRowData();
-      localAttr->CopyAllocate(attr);
-      vtkIdType iRowLocal = 0;
-      for (vtkIdType iRow = 0; iRow < table->GetNumberOfRows(); iRow++)
-      {
-        auto tmpSet = ranksMap[labelArray->GetValue(iRow)];
-        if (tmpSet.find(iRank) != tmpSet.end())
-        {
-          localAttr->CopyData(attr, iRow, iRowLocal);
-          iRowLocal++;
-        }
-      }
-      localAttr->Squeeze();
+      ValuesToTable(localValues, localTable);
       controller->Send(localTable, iRank, BROADCAST_VALUES_TAG);
     }
   }
   else
   {
-    // Receive our own label values map
-    controller->Receive(table, 0, BROADCAST_VALUES_TAG);
+    // Receive our own cluster values
+    vtkNew<vtkTable> localTable;
+    controller->Receive(localTable, 0, BROADCAST_VALUES_TAG);
+    if (!TableToValues(localTable, values))
+    {
+      return 0;
+    }
   }
 
   return 1;
 }
 
 //----------------------------------------------------------------------------
-struct vtkLocalDataType
-{
-  LabelValuesMap LabelMap;
-};
-
-//----------------------------------------------------------------------------
+template <typename AccumulatorType>
 struct AnalysisFunctor
 {
-  AnalysisFunctor(
-    vtkPMaterialClusterAnalysisFilter* filter, vtkImageData* input, vtkDataArray* array)
+  AnalysisFunctor(vtkPMaterialClusterAnalysisFilter* filter, vtkImageData* input,
+    vtkDataArray* array, int minLabel, int maxLabel)
     : Filter(filter)
     , Input(input)
     , Array(array)
+    , MinLabel(minLabel)
+    , MaxLabel(maxLabel)
   {
     this->ProcessedPoints = 0;
   }
 
   //----------------------------------------------------------------------------
-  void Initialize() { this->AmIFirstThread.Local() = 0; }
+  void Initialize()
+  {
+    this->AmIFirstThread.Local() = 0;
+    this->LocalData.Local().Initialize(this->MinLabel, this->MaxLabel);
+  }
 
   //----------------------------------------------------------------------------
   void operator()(vtkIdType firstPoint, vtkIdType lastPoint)
   {
     // Loop over the points, processing only the one that are needed
-    LabelValuesMap& lvMap = this->LocalData.Local();
-    std::array<double, 3> voxelPoint;
+    AccumulatorType& accumulator = this->LocalData.Local();
+    double voxelPoint[3];
     int& amITheFirstThread = this->AmIFirstThread.Local();
     if (amITheFirstThread == 0)
     {
@@ -278,17 +445,11 @@ struct AnalysisFunctor
           this->Filter->UpdateProgress(this->ProcessedPoints / totalNbPoints);
         }
       }
-      int tmpLabel = this->Array->GetVariantValue(pointId).ToInt();
+      int tmpLabel = static_cast<int>(this->Array->GetComponent(pointId, 0));
       if (tmpLabel != rockfillLabel)
       {
-        this->Input->GetPoint(pointId, &voxelPoint[0]);
-        auto iter = lvMap.emplace(tmpLabel, std::make_pair(1, voxelPoint));
-        if (!iter.second)
-        {
-          Barycenter(iter.first->second.first, &iter.first->second.second[0], 1, &voxelPoint[0],
-            &iter.first->second.second[0]);
-          iter.first->second.first++;
-        }
+        this->Input->GetPoint(pointId, voxelPoint);
+        accumulator.Add(tmpLabel, voxelPoint);
       }
     }
   }
@@ -298,34 +459,90 @@ struct AnalysisFunctor
   {
     this->Filter->SetProgressText("Reducing geometry");
     this->Filter->UpdateProgress(0.);
-    vtkSMPThreadLocal<LabelValuesMap>::iterator outIter = this->LocalData.begin();
-    this->OutputLabelMap = *outIter;
+    auto outIter = this->LocalData.begin();
+    if (outIter == this->LocalData.end())
+    {
+      this->OutputValues.Clear();
+      return;
+    }
+    AccumulatorType& output = *outIter;
     outIter++;
     for (int threadCnt = 0; outIter != this->LocalData.end(); ++outIter, ++threadCnt)
     {
       this->Filter->UpdateProgress(threadCnt / static_cast<double>(this->LocalData.size()));
-
-      for (auto it : *outIter)
-      {
-        auto iter = this->OutputLabelMap.emplace(it.first, it.second);
-        if (!iter.second)
-        {
-          Barycenter(iter.first->second.first, &iter.first->second.second[0], it.second.first,
-            &it.second.second[0], &iter.first->second.second[0]);
-          iter.first->second.first += it.second.first;
-        }
-      }
+      output.Merge(*outIter);
     }
+    output.Export(this->OutputValues);
   }
 
   //----------------------------------------------------------------------------
-  vtkSMPThreadLocal<LabelValuesMap> LocalData;
+  vtkSMPThreadLocal<AccumulatorType> LocalData;
   vtkSMPThreadLocal<int> AmIFirstThread;
   vtkPMaterialClusterAnalysisFilter* Filter;
   vtkImageData* Input;
   vtkDataArray* Array;
+  int MinLabel;
+  int MaxLabel;
   vtkAtomicIdType ProcessedPoints;
-  LabelValuesMap OutputLabelMap;
+  ClusterValues OutputValues;
+};
+
+//----------------------------------------------------------------------------
+// Fill the volume point data array from the reduced cluster values.
+struct VolumeFunctor
+{
+  VolumeFunctor(const ClusterValues& values, vtkDataArray* array, vtkDoubleArray* volumeArray,
+    int rockfillLabel, int minLabel, int maxLabel, bool dense)
+    : Values(values)
+    , Array(array)
+    , VolumeArray(volumeArray)
+    , RockfillLabel(rockfillLabel)
+    , MinLabel(minLabel)
+  {
+    if (dense)
+    {
+      // Label-indexed lookup table
+      this->DenseVolumes.assign(static_cast<size_t>(maxLabel) - minLabel + 1, 0.);
+      for (size_t i = 0; i < values.Size(); i++)
+      {
+        int label = values.Labels[i];
+        if (label >= minLabel && label <= maxLabel)
+        {
+          this->DenseVolumes[label - minLabel] = values.Volumes[i];
+        }
+      }
+    }
+  }
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    double* volumes = this->VolumeArray->GetPointer(0);
+    for (vtkIdType i = begin; i < end; i++)
+    {
+      int label = static_cast<int>(this->Array->GetComponent(i, 0));
+      double volume = 0.;
+      if (label != this->RockfillLabel)
+      {
+        if (!this->DenseVolumes.empty())
+        {
+          volume = this->DenseVolumes[label - this->MinLabel];
+        }
+        else
+        {
+          vtkIdType idx = this->Values.Find(label);
+          volume = idx >= 0 ? this->Values.Volumes[idx] : 0.;
+        }
+      }
+      volumes[i] = volume;
+    }
+  }
+
+  const ClusterValues& Values;
+  vtkDataArray* Array;
+  vtkDoubleArray* VolumeArray;
+  int RockfillLabel;
+  int MinLabel;
+  std::vector<double> DenseVolumes;
 };
 }
 
@@ -359,42 +576,50 @@ int vtkPMaterialClusterAnalysisFilter::RequestData(vtkInformation* vtkNotUsed(re
 
   vtkIdType nPoints = input->GetNumberOfPoints();
 
-  AnalysisFunctor functor(this, input, array);
-  vtkSMPTools::For(0, nPoints, functor);
-  LabelValuesMap& lvMap = functor.OutputLabelMap;
+  // Clusters are accumulated in flat label-indexed arrays when the label range
+  // is compact enough, falling back to hash tables otherwise.
+  double range[2] = { 0., -1. };
+  if (nPoints > 0)
+  {
+    array->GetRange(range, 0);
+  }
+  int minLabel = static_cast<int>(range[0]);
+  int maxLabel = static_cast<int>(range[1]);
+  bool dense = range[0] <= range[1] &&
+    (range[1] - range[0] + 1.) * ::DENSE_LABEL_RANGE_DIVISOR <= static_cast<double>(nPoints);
+
+  ::ClusterValues values;
+  if (dense)
+  {
+    ::AnalysisFunctor< ::DenseAccumulator> functor(this, input, array, minLabel, maxLabel);
+    vtkSMPTools::For(0, nPoints, functor);
+    values = std::move(functor.OutputValues);
+  }
+  else
+  {
+    ::AnalysisFunctor< ::SparseAccumulator> functor(this, input, array, minLabel, maxLabel);
+    vtkSMPTools::For(0, nPoints, functor);
+    values = std::move(functor.OutputValues);
+  }
 
   this->SetProgressText("Processing data");
   this->UpdateProgress(0.0);
 
-  vtkNew<vtkTable> table;
-  ::AppendMapToTable(lvMap, table.Get());
-
-  if (!::ReduceTable(this, lvMap, table.Get(), this->RockfillLabel))
+  if (!::ReduceValues(this, values))
   {
     return 0;
   }
 
-  // Copy reduced volume to map
-  LabelValuesMap localLvMap;
-  ::AppendTableToMap(table, localLvMap, this->RockfillLabel, false);
+  vtkNew<vtkTable> table;
+  ::ValuesToTable(values, table.Get());
 
-  // Use map to fill point data with volume and center
+  // Use reduced values to fill point data with volume
   vtkNew<vtkDoubleArray> volumeArray;
   volumeArray->SetName("Volume");
   volumeArray->SetNumberOfTuples(array->GetNumberOfTuples());
-  for (vtkIdType i = 0; i < array->GetNumberOfTuples(); i++)
-  {
-    int tmpLabel = array->GetVariantValue(i).ToInt();
-    if (tmpLabel != this->RockfillLabel)
-    {
-      auto& value = localLvMap[tmpLabel];
-      volumeArray->SetValue(i, value.first);
-    }
-    else
-    {
-      volumeArray->SetValue(i, 0.);
-    }
-  }
+  ::VolumeFunctor volumeFunctor(
+    values, array, volumeArray, this->RockfillLabel, minLabel, maxLabel, dense);
+  vtkSMPTools::For(0, array->GetNumberOfTuples(), volumeFunctor);
 
   vtkPointData* outputPd = output->GetPointData();
   outputPd->AddArray(volumeArray.Get());
@@ -0,0 +1,127 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    TestStreamingParticlesPriorityQueue.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkCompositeDataPipeline.h"
+#include "vtkDummyController.h"
+#include "vtkInformation.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkStreamingDemandDrivenPipeline.h"
+#include "vtkStreamingParticlesPriorityQueue.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <set>
+#include <vector>
+
+#define TEST_ASSERT(x)                                                                             \
+  if (!(x))                                                                                        \
+  {                                                                                                \
+    cerr << "ERROR: failed at " << __LINE__ << "!" << endl;                                        \
+    return EXIT_FAILURE;                                                                           \
+  }
+
+namespace
+{
+// Axis aligned view looking down -z on the slab xmin <= x <= xmax.
+void GetViewPlanes(double xmin, double xmax, double planes[24])
+{
+  const double values[24] = {
+    1, 0, 0, -xmin, // left
+    -1, 0, 0, xmax, // right
+    0, 1, 0, 1,     // bottom
+    0, -1, 0, 2,    // top
+    0, 0, -1, 10,   // near
+    0, 0, 1, 10     // far
+  };
+  std::copy(values, values + 24, planes);
+}
+
+std::set<unsigned int> PopAll(vtkStreamingParticlesPriorityQueue* queue)
+{
+  std::set<unsigned int> blocks;
+  while (!queue->IsEmpty())
+  {
+    blocks.insert(queue->Pop());
+  }
+  return blocks;
+}
+}
+
+int TestStreamingParticlesPriorityQueue(int, char* [])
+{
+  // A single level of 3 unit blocks along x, of 1 MiB each.
+  vtkNew<vtkMultiBlockDataSet> level;
+  level->SetNumberOfBlocks(3);
+  for (unsigned int cc = 0; cc < 3; ++cc)
+  {
+    const double bounds[6] = { 2.0 * cc, 2.0 * cc + 1, 0, 1, 0, 1 };
+    vtkInformation* info = level->GetMetaData(cc);
+    info->Set(vtkStreamingDemandDrivenPipeline::BOUNDS(), bounds, 6);
+    info->Set(vtkCompositeDataPipeline::BLOCK_AMOUNT_OF_DETAIL(), 32768);
+  }
+  vtkNew<vtkMultiBlockDataSet> metadata;
+  metadata->SetBlock(0, level.GetPointer());
+
+  vtkNew<vtkDummyController> controller;
+  vtkNew<vtkStreamingParticlesPriorityQueue> queue;
+  queue->SetController(controller.GetPointer());
+  queue->SetMemoryBudget(2.0);
+  queue->SetCameraMotionTolerance(0.1);
+  queue->Initialize(metadata.GetPointer());
+
+  // Blocks 0 and 1 are visible, block 2 does not fit in the budget.
+  double viewA[24];
+  GetViewPlanes(1.3, 3.6, viewA);
+  queue->Update(viewA);
+  TEST_ASSERT(queue->GetBlocksToPurge().empty());
+  TEST_ASSERT(PopAll(queue.GetPointer()) == std::set<unsigned int>({ 0, 1 }));
+  TEST_ASSERT(!queue->HasPendingUpdate());
+
+  // A small motion makes block 0 invisible and block 2 visible. It is
+  // deferred while the camera moves...
+  double viewB[24];
+  GetViewPlanes(1.4, 3.7, viewB);
+  queue->Update(viewB);
+  TEST_ASSERT(queue->HasPendingUpdate());
+  TEST_ASSERT(queue->IsEmpty() && queue->GetBlocksToPurge().empty());
+
+  // ... and applied once it stops: block 0, the least recently visible, is
+  // purged to make room for block 2.
+  queue->Update(viewB);
+  TEST_ASSERT(!queue->HasPendingUpdate());
+  TEST_ASSERT(queue->GetBlocksToPurge() == std::vector<unsigned int>({ 0 }));
+  TEST_ASSERT(PopAll(queue.GetPointer()) == std::set<unsigned int>({ 2 }));
+
+  // Nothing changes while the camera does not move.
+  queue->Update(viewB);
+  TEST_ASSERT(!queue->HasPendingUpdate());
+  TEST_ASSERT(queue->IsEmpty() && queue->GetBlocksToPurge().empty());
+
+  // A large motion is applied right away: block 0 comes back in place of
+  // block 2, while block 1, still visible, stays loaded.
+  double viewC[24];
+  GetViewPlanes(-0.5, 2.5, viewC);
+  queue->Update(viewC);
+  TEST_ASSERT(!queue->HasPendingUpdate());
+  TEST_ASSERT(queue->GetBlocksToPurge() == std::vector<unsigned int>({ 2 }));
+  TEST_ASSERT(PopAll(queue.GetPointer()) == std::set<unsigned int>({ 0 }));
+
+  // Without a budget, every block is loaded.
+  queue->SetMemoryBudget(0.0);
+  queue->Initialize(metadata.GetPointer());
+  queue->Update(viewC);
+  TEST_ASSERT(PopAll(queue.GetPointer()) == std::set<unsigned int>({ 0, 1, 2 }));
+  return EXIT_SUCCESS;
+}
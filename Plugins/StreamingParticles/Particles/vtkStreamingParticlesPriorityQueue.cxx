@@ -20,11 +20,14 @@
 #include "vtkMultiBlockDataSet.h"
 #include "vtkMultiProcessController.h"
 #include "vtkObjectFactory.h"
+#include "vtkPVLogger.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkStreamingPriorityQueue.h"
 
 #include <algorithm>
 #include <assert.h>
+#include <cmath>
+#include <list>
 #include <map>
 #include <queue>
 #include <set>
@@ -32,15 +35,34 @@
 
 namespace
 {
+// Estimated memory used by a loaded block, per unit of
+// BLOCK_AMOUNT_OF_DETAIL (i.e. per point for particle readers).
+const double BYTES_PER_DETAIL_UNIT = 32.0;
+
+// Estimated memory used by a loaded block without detail information.
+const double DEFAULT_BLOCK_BYTES = 1024.0 * 1024.0;
+
+// Combines the screen-space density of a block (the screen coverage shared
+// by the blocks of its refinement level) with its distance to the camera,
+// relative to its size.
+double vtkParticlesPriority(const vtkStreamingPriorityQueueItem& item)
+{
+  double diagonal = std::max(item.Bounds.GetDiagonalLength(), 1e-10);
+  double distance = std::max(item.Distance, 0.0) / diagonal;
+  return item.ScreenCoverage / ((1.0 + item.Refinement) * (1.0 + distance));
+}
+
 class vtkParticlesComparator
 {
 public:
   bool operator()(
     const vtkStreamingPriorityQueueItem& me, const vtkStreamingPriorityQueueItem& other) const
   {
-    if (me.ScreenCoverage != other.ScreenCoverage)
+    double myPriority = vtkParticlesPriority(me);
+    double otherPriority = vtkParticlesPriority(other);
+    if (myPriority != otherPriority)
     {
-      return me.ScreenCoverage < other.ScreenCoverage;
+      return myPriority < otherPriority;
     }
     if (me.Refinement != other.Refinement)
     {
@@ -56,14 +78,45 @@ public:
   vtkSmartPointer<vtkMultiBlockDataSet> Metadata;
   std::queue<unsigned int> BlocksToRequest;
   std::set<unsigned int> BlocksRequested;
-  std::set<unsigned int> BlocksToPurge;
+  std::vector<unsigned int> BlocksToPurge;
+
+  // Estimated memory of every block in the meta-data, in bytes.
+  std::map<unsigned int, double> BlocksMemory;
 
+  // Loaded blocks, most recently used first.
+  struct LoadedBlock
+  {
+    std::list<unsigned int>::iterator Position;
+    double Memory;
+    unsigned long LastUsed;
+  };
+  std::list<unsigned int> LRUBlocks;
+  std::map<unsigned int, LoadedBlock> LoadedBlocks;
+  double LoadedMemory;
+  unsigned long Generation;
+
+  // View planes used for the last priority computation, and the ones given
+  // to the last Update() call.
   double PreviousViewPlanes[24];
+  double LatestViewPlanes[24];
+  bool UpdatePending;
 
-  vtkInternals() { this->ResetPreviousViewPlanes(); }
-  void ResetPreviousViewPlanes() { memset(this->PreviousViewPlanes, 0, sizeof(double) * 24); }
-  bool PlanesChanged(const double view_planes[24])
+  vtkInternals()
+    : LoadedMemory(0.0)
+    , Generation(0)
+    , UpdatePending(false)
+  {
+    this->ResetPreviousViewPlanes();
+  }
+  void ResetPreviousViewPlanes()
+  {
+    memset(this->PreviousViewPlanes, 0, sizeof(double) * 24);
+    memset(this->LatestViewPlanes, 0, sizeof(double) * 24);
+  }
+  bool PlanesChanged(const double view_planes[24], double tolerance)
   {
+    if (tolerance <= 0.0)
+    {
 #ifdef _MSC_VER
 #pragma warning(push)
 // Disable C4996 because it warns us that the pointer range here cannot be
@@ -72,14 +125,84 @@ public:
 // suppress the warning.
 #pragma warning(disable : 4996)
 #endif
-    return !std::equal(this->PreviousViewPlanes, this->PreviousViewPlanes + 24, view_planes);
+      return !std::equal(this->PreviousViewPlanes, this->PreviousViewPlanes + 24, view_planes);
 #ifdef _MSC_VER
 #pragma warning(pop)
 #endif
+    }
+    for (int cc = 0; cc < 24; cc++)
+    {
+      double delta = std::abs(view_planes[cc] - this->PreviousViewPlanes[cc]);
+      if (delta > tolerance * std::max(1.0, std::abs(this->PreviousViewPlanes[cc])))
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  double GetBlockMemory(unsigned int block) const
+  {
+    auto iter = this->BlocksMemory.find(block);
+    return iter != this->BlocksMemory.end() ? iter->second : DEFAULT_BLOCK_BYTES;
+  }
+
+  // Marks a block as loaded (if needed) and most recently used.
+  void Touch(unsigned int block)
+  {
+    auto iter = this->LoadedBlocks.find(block);
+    if (iter == this->LoadedBlocks.end())
+    {
+      this->LRUBlocks.push_front(block);
+      LoadedBlock& loaded = this->LoadedBlocks[block];
+      loaded.Position = this->LRUBlocks.begin();
+      loaded.Memory = this->GetBlockMemory(block);
+      loaded.LastUsed = this->Generation;
+      this->LoadedMemory += loaded.Memory;
+    }
+    else
+    {
+      this->LRUBlocks.splice(this->LRUBlocks.begin(), this->LRUBlocks, iter->second.Position);
+      iter->second.LastUsed = this->Generation;
+    }
+  }
+
+  // Stops tracking a block, without purging it.
+  void Forget(unsigned int block)
+  {
+    auto iter = this->LoadedBlocks.find(block);
+    if (iter != this->LoadedBlocks.end())
+    {
+      this->LoadedMemory -= iter->second.Memory;
+      this->LRUBlocks.erase(iter->second.Position);
+      this->LoadedBlocks.erase(iter);
+    }
+  }
+
+  void Purge(unsigned int block)
+  {
+    this->BlocksToPurge.push_back(block);
+    this->Forget(block);
+  }
+  // Records view planes that moved by less than the tolerance. Returns false
+  // when they are the same as the last ones, i.e. the camera stopped and the
+  // deferred update must be applied now.
+  bool DeferUpdate(const double view_planes[24])
+  {
+    bool moving = false;
+    for (int cc = 0; cc < 24; cc++)
+    {
+      moving = moving || view_planes[cc] != this->LatestViewPlanes[cc];
+      this->LatestViewPlanes[cc] = view_planes[cc];
+    }
+    this->UpdatePending = moving;
+    return moving;
   }
   void SetViewPlanes(const double view_planes[24])
   {
     std::copy(view_planes, view_planes + 24, this->PreviousViewPlanes);
+    std::copy(view_planes, view_planes + 24, this->LatestViewPlanes);
+    this->UpdatePending = false;
   }
 };
 
@@ -93,6 +216,8 @@ vtkStreamingParticlesPriorityQueue::vtkStreamingParticlesPriorityQueue()
   this->UseBlockDetailInformation = false;
   this->AnyProcessCanLoadAnyBlock = true;
   this->DetailLevelToLoad = 8.5e-5;
+  this->MemoryBudget = 0.0;
+  this->CameraMotionTolerance = 0.0;
   this->SetController(vtkMultiProcessController::GetGlobalController());
 }
 
@@ -117,14 +242,18 @@ void vtkStreamingParticlesPriorityQueue::Reinitialize()
 {
   if (this->Internals->Metadata)
   {
-    std::set<unsigned int> blocksRequested;
-    blocksRequested.swap(this->Internals->BlocksRequested);
-
-    vtkSmartPointer<vtkMultiBlockDataSet> info = this->Internals->Metadata;
-    this->Initialize(info);
-
-    // restore blocks requested since data didn;t change.
-    this->Internals->BlocksRequested.swap(blocksRequested);
+    vtkInternals* previous = this->Internals;
+    this->Internals = new vtkInternals();
+    this->Internals->Metadata = previous->Metadata;
+
+    // restore blocks requested and their usage since data didn't change.
+    this->Internals->BlocksRequested.swap(previous->BlocksRequested);
+    this->Internals->BlocksMemory.swap(previous->BlocksMemory);
+    this->Internals->LRUBlocks.swap(previous->LRUBlocks);
+    this->Internals->LoadedBlocks.swap(previous->LoadedBlocks);
+    this->Internals->LoadedMemory = previous->LoadedMemory;
+    this->Internals->Generation = previous->Generation;
+    delete previous;
   }
 }
 
@@ -215,6 +344,7 @@ void vtkStreamingParticlesPriorityQueue::UpdatePriorities(const double view_plan
       if (blockInfo->Has(vtkCompositeDataPipeline::BLOCK_AMOUNT_OF_DETAIL()))
       {
         item.AmountOfDetail = blockInfo->Get(vtkCompositeDataPipeline::BLOCK_AMOUNT_OF_DETAIL());
+        this->Internals->BlocksMemory[block_index] = item.AmountOfDetail * BYTES_PER_DETAIL_UNIT;
       }
       if (this->AnyProcessCanLoadAnyBlock ||
         (blockInfo->Has(vtkCompositeDataSet::CURRENT_PROCESS_CAN_LOAD_BLOCK()) &&
@@ -241,6 +371,7 @@ void vtkStreamingParticlesPriorityQueue::UpdatePriorities(const double view_plan
   this->Internals->BlocksRequested.clear();
 
   this->Internals->BlocksToPurge.clear();
+  this->Internals->Generation++;
 
   std::deque<unsigned int> toRequest;
   std::map<unsigned, unsigned> keepInRequest;
@@ -270,7 +401,14 @@ void vtkStreamingParticlesPriorityQueue::UpdatePriorities(const double view_plan
       if (hasOneLikeXButGreater(item.Identifier, num_block_per_level, keepInRequest) ||
         hasOneLikeXButGreater(item.Identifier, num_block_per_level, blocksRequested))
       {
-        // we already requested a greater resolution of the block, do nothing
+        // we already requested a greater resolution of the block, keep it
+        // loaded if it is. Only visible blocks count as used, so that blocks
+        // out of the view are the first purged when over the memory budget.
+        if (item.ScreenCoverage > 0 &&
+          hasOneLikeXButGreater(item.Identifier, num_block_per_level, blocksRequested))
+        {
+          this->Internals->Touch(blocksRequested[item.Identifier % num_block_per_level]);
+        }
       }
       else if (hasOneLikeXButLess(item.Identifier, num_block_per_level, blocksRequested))
       {
@@ -279,8 +417,7 @@ void vtkStreamingParticlesPriorityQueue::UpdatePriorities(const double view_plan
         toRequest.push_back(item.Identifier);
         keepInRequest[item.Identifier % num_block_per_level] = item.Identifier;
         // 2: delete the one we currently have loaded
-        this->Internals->BlocksToPurge.insert(
-          blocksRequested[item.Identifier % num_block_per_level]);
+        this->Internals->Purge(blocksRequested[item.Identifier % num_block_per_level]);
         blocksRequested.erase(item.Identifier % num_block_per_level);
       }
       else if (hasOneLikeXButLess(item.Identifier, num_block_per_level, keepInRequest))
@@ -323,20 +460,22 @@ void vtkStreamingParticlesPriorityQueue::UpdatePriorities(const double view_plan
         // if the block is loaded, delete it
         if (hasOneLikeXButGreater(item.Identifier, num_block_per_level, blocksRequested))
         {
-          this->Internals->BlocksToPurge.insert(
-            blocksRequested[item.Identifier % num_block_per_level]);
+          this->Internals->Purge(blocksRequested[item.Identifier % num_block_per_level]);
           blocksRequested.erase(item.Identifier % num_block_per_level);
         }
       }
     }
   }
 
+  std::vector<unsigned int>& blocksToPurge = this->Internals->BlocksToPurge;
+  std::sort(blocksToPurge.begin(), blocksToPurge.end());
+  blocksToPurge.erase(std::unique(blocksToPurge.begin(), blocksToPurge.end()), blocksToPurge.end());
   for (std::deque<unsigned int>::iterator itr = toRequest.begin(); itr != toRequest.end(); ++itr)
   {
     std::map<unsigned, unsigned>::iterator keep = keepInRequest.find(*itr % num_block_per_level);
-    std::set<unsigned>::iterator purge = this->Internals->BlocksToPurge.find(*itr);
     if (keep != keepInRequest.end() && keep->second == *itr &&
-      (all_levels_have_same_block_count || purge == this->Internals->BlocksToPurge.end()))
+      (all_levels_have_same_block_count ||
+          !std::binary_search(blocksToPurge.begin(), blocksToPurge.end(), *itr)))
     {
       this->Internals->BlocksToRequest.push(*itr);
     }
@@ -347,10 +486,79 @@ void vtkStreamingParticlesPriorityQueue::UpdatePriorities(const double view_plan
     this->Internals->BlocksRequested.insert(itr->second);
   }
 
-  cout << "Update information  : " << endl
-       << "  To request        : " << this->Internals->BlocksToRequest.size() << endl
-       << "  Already requested : " << this->Internals->BlocksRequested.size() << endl
-       << "  To purge          : " << this->Internals->BlocksToPurge.size() << endl;
+  // Stop tracking the usage of blocks that are no longer considered requested.
+  for (auto iter = this->Internals->LoadedBlocks.begin();
+       iter != this->Internals->LoadedBlocks.end();)
+  {
+    unsigned int block = (iter++)->first;
+    if (this->Internals->BlocksRequested.find(block) == this->Internals->BlocksRequested.end())
+    {
+      this->Internals->Forget(block);
+    }
+  }
+
+  this->EnforceMemoryBudget();
+
+  vtkVLogF(PARAVIEW_LOG_RENDERING_VERBOSITY(),
+    "streaming particles priorities: %d to request, %d already requested, %d to purge",
+    static_cast<int>(this->Internals->BlocksToRequest.size()),
+    static_cast<int>(this->Internals->BlocksRequested.size()),
+    static_cast<int>(this->Internals->BlocksToPurge.size()));
+}
+
+//----------------------------------------------------------------------------
+void vtkStreamingParticlesPriorityQueue::EnforceMemoryBudget()
+{
+  if (this->MemoryBudget <= 0.0)
+  {
+    return;
+  }
+
+  vtkInternals& internals = *this->Internals;
+  const double budget = this->MemoryBudget * 1024.0 * 1024.0;
+
+  std::vector<unsigned int> pending;
+  double pendingMemory = 0.0;
+  for (; !internals.BlocksToRequest.empty(); internals.BlocksToRequest.pop())
+  {
+    pending.push_back(internals.BlocksToRequest.front());
+    pendingMemory += internals.GetBlockMemory(pending.back());
+  }
+
+  // Purge the least recently used blocks that are not needed for the current
+  // view.
+  bool purged = false;
+  while (internals.LoadedMemory + pendingMemory > budget && !internals.LRUBlocks.empty())
+  {
+    unsigned int block = internals.LRUBlocks.back();
+    if (internals.LoadedBlocks[block].LastUsed == internals.Generation)
+    {
+      // all remaining blocks are needed for the current view.
+      break;
+    }
+    internals.Purge(block);
+    internals.BlocksRequested.erase(block);
+    purged = true;
+  }
+  if (purged)
+  {
+    std::sort(internals.BlocksToPurge.begin(), internals.BlocksToPurge.end());
+    internals.BlocksToPurge.erase(
+      std::unique(internals.BlocksToPurge.begin(), internals.BlocksToPurge.end()),
+      internals.BlocksToPurge.end());
+  }
+
+  // Defer the lowest priority requests that still do not fit.
+  while (internals.LoadedMemory + pendingMemory > budget && !pending.empty())
+  {
+    pendingMemory -= internals.GetBlockMemory(pending.back());
+    pending.pop_back();
+  }
+
+  for (unsigned int block : pending)
+  {
+    internals.BlocksToRequest.push(block);
+  }
 }
 
 //----------------------------------------------------------------------------
@@ -378,6 +586,7 @@ unsigned int vtkStreamingParticlesPriorityQueue::Pop()
       items[i] = this->Internals->BlocksToRequest.front();
       this->Internals->BlocksToRequest.pop();
       this->Internals->BlocksRequested.insert(items[i]);
+      this->Internals->Touch(items[i]);
     }
     return items[myid];
   }
@@ -388,6 +597,7 @@ unsigned int vtkStreamingParticlesPriorityQueue::Pop()
     item = this->Internals->BlocksToRequest.front();
     this->Internals->BlocksToRequest.pop();
     this->Internals->BlocksRequested.insert(item);
+    this->Internals->Touch(item);
 
     // As the queue is assumed to be of the local process's blocks now, return
     // the first block in the queue (will be different on each process
@@ -415,10 +625,21 @@ void vtkStreamingParticlesPriorityQueue::Update(
   }
 
   // Check if the view has changed. If so, we update the priorities.
-  if (!this->Internals->PlanesChanged(view_planes))
+  vtkInternals& internals = *this->Internals;
+  if (!internals.PlanesChanged(view_planes, 0.0))
   {
+    internals.UpdatePending = false;
     return;
   }
+  if (!internals.PlanesChanged(view_planes, this->CameraMotionTolerance))
+  {
+    // Small motion: defer the update while the camera keeps moving, and apply
+    // it once the camera stops, i.e. the same view planes are given again.
+    if (internals.DeferUpdate(view_planes))
+    {
+      return;
+    }
+  }
 
   this->Reinitialize();
   this->UpdatePriorities(view_planes);
@@ -426,7 +647,13 @@ void vtkStreamingParticlesPriorityQueue::Update(
 }
 
 //----------------------------------------------------------------------------
-const std::set<unsigned int>& vtkStreamingParticlesPriorityQueue::GetBlocksToPurge() const
+bool vtkStreamingParticlesPriorityQueue::HasPendingUpdate()
+{
+  return this->Internals->UpdatePending;
+}
+
+//----------------------------------------------------------------------------
+const std::vector<unsigned int>& vtkStreamingParticlesPriorityQueue::GetBlocksToPurge() const
 {
   return this->Internals->BlocksToPurge;
 }
@@ -436,4 +663,6 @@ void vtkStreamingParticlesPriorityQueue::PrintSelf(ostream& os, vtkIndent indent
 {
   this->Superclass::PrintSelf(os, indent);
   os << indent << "Controller: " << this->Controller << endl;
+  os << indent << "MemoryBudget: " << this->MemoryBudget << endl;
+  os << indent << "CameraMotionTolerance: " << this->CameraMotionTolerance << endl;
 }
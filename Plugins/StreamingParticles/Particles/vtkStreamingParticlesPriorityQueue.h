@@ -32,7 +32,7 @@
 
 #include "vtkObject.h"
 #include "vtkStreamingParticlesModule.h" // for export macro
-#include <set>                           // needed for set
+#include <vector>                        // needed for vector
 
 class vtkMultiBlockDataSet;
 class vtkMultiProcessController;
@@ -83,9 +83,9 @@ public:
   unsigned int Pop();
 
   // Description:
-  // After every Update() call, returns the list of blocks that should be purged
-  // given the current view.
-  const std::set<unsigned int>& GetBlocksToPurge() const;
+  // After every Update() call, returns the sorted list of blocks that should be
+  // purged given the current view and the memory budget.
+  const std::vector<unsigned int>& GetBlocksToPurge() const;
 
   // Description:
   // If this variable is set to true and the blocks have
@@ -112,20 +112,57 @@ public:
     // the block to compute approximate distance between features in the dataset.  This
     // computed distance is compared with this value.  Default: 8.5e-5 seems to work
     // well with point clouds where the BLOCK_AMOUNT_OF_DETAIL is the number of points.
-    vtkGetMacro(DetailLevelToLoad, double) vtkSetMacro(DetailLevelToLoad, double)
+    vtkGetMacro(DetailLevelToLoad, double) vtkSetMacro(DetailLevelToLoad, double);
 
-      protected : vtkStreamingParticlesPriorityQueue();
+  // Description:
+  // Maximum amount of memory, in MiB, the loaded blocks are allowed to use.
+  // When loading the requested blocks would exceed this budget, the least
+  // recently visible blocks are purged first, then the lowest priority
+  // requests are deferred. The size of a block is estimated from its
+  // vtkCompositeDataPipeline::BLOCK_AMOUNT_OF_DETAIL meta-data so that all
+  // processes take the same decisions. 0 (default) means no budget.
+  vtkSetClampMacro(MemoryBudget, double, 0.0, VTK_DOUBLE_MAX);
+  vtkGetMacro(MemoryBudget, double);
+
+  // Description:
+  // Relative tolerance on the view planes under which a camera motion does not
+  // immediately trigger a new priority computation. While the camera keeps
+  // moving by small amounts, the current queue is reused instead of
+  // recomputing the priority of every block. The update is deferred, not
+  // dropped: it is applied as soon as Update() is called twice with the same
+  // view planes, i.e. once the camera has stopped. Changes are measured from
+  // the view planes used for the last priority computation, so a slow motion
+  // also triggers an update once it accumulates.
+  // Default is 0, i.e. any camera motion updates the priorities.
+  vtkSetClampMacro(CameraMotionTolerance, double, 0.0, 1.0);
+  vtkGetMacro(CameraMotionTolerance, double);
+
+  // Description:
+  // Returns true if a small camera motion was deferred by the last Update()
+  // call. Callers should call Update() again, e.g. on the next streaming pass,
+  // to apply it.
+  bool HasPendingUpdate();
+
+protected:
+  vtkStreamingParticlesPriorityQueue();
   ~vtkStreamingParticlesPriorityQueue();
 
   // Description:
   // Updates priorities and builds a BlocksToPurge list.
   void UpdatePriorities(const double view_planes[24]);
 
+  // Description:
+  // Purges least recently used blocks and defers requests so that the loaded
+  // blocks fit in MemoryBudget. Called at the end of UpdatePriorities().
+  void EnforceMemoryBudget();
+
   vtkMultiProcessController* Controller;
 
   bool UseBlockDetailInformation;
   bool AnyProcessCanLoadAnyBlock;
   double DetailLevelToLoad;
+  double MemoryBudget;
+  double CameraMotionTolerance;
 
 private:
   vtkStreamingParticlesPriorityQueue(const vtkStreamingParticlesPriorityQueue&) = delete;
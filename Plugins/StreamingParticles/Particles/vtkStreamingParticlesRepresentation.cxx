@@ -43,8 +43,9 @@
 
 static char const BLOCKS_TO_PURGE_ARRAY_NAME[] = "__blocks_to_purge";
 
+// blocksToPurge must be sorted.
 static inline void purge_blocks(
-  vtkMultiBlockDataSet* data, const std::set<unsigned int>& blocksToPurge)
+  vtkMultiBlockDataSet* data, const std::vector<unsigned int>& blocksToPurge)
 {
   unsigned int block_index = 0;
   unsigned int num_levels = data->GetNumberOfBlocks();
@@ -56,7 +57,7 @@ static inline void purge_blocks(
     unsigned int num_blocks = mb->GetNumberOfBlocks();
     for (unsigned int cc = 0; cc < num_blocks; cc++, block_index++)
     {
-      if (blocksToPurge.find(block_index) != blocksToPurge.end())
+      if (std::binary_search(blocksToPurge.begin(), blocksToPurge.end(), block_index))
       {
         mb->SetBlock(cc, NULL);
       }
@@ -148,6 +149,38 @@ double vtkStreamingParticlesRepresentation::GetDetailLevelToLoad()
   return this->PriorityQueue->GetDetailLevelToLoad();
 }
 
+//----------------------------------------------------------------------------
+void vtkStreamingParticlesRepresentation::SetMemoryBudget(double budget)
+{
+  if (budget != this->PriorityQueue->GetMemoryBudget())
+  {
+    this->PriorityQueue->SetMemoryBudget(budget);
+    this->Modified();
+  }
+}
+
+//----------------------------------------------------------------------------
+double vtkStreamingParticlesRepresentation::GetMemoryBudget()
+{
+  return this->PriorityQueue->GetMemoryBudget();
+}
+
+//----------------------------------------------------------------------------
+void vtkStreamingParticlesRepresentation::SetCameraMotionTolerance(double tolerance)
+{
+  if (tolerance != this->PriorityQueue->GetCameraMotionTolerance())
+  {
+    this->PriorityQueue->SetCameraMotionTolerance(tolerance);
+    this->Modified();
+  }
+}
+
+//----------------------------------------------------------------------------
+double vtkStreamingParticlesRepresentation::GetCameraMotionTolerance()
+{
+  return this->PriorityQueue->GetCameraMotionTolerance();
+}
+
 //----------------------------------------------------------------------------
 int vtkStreamingParticlesRepresentation::ProcessViewRequest(
   vtkInformationRequestKey* request_type, vtkInformation* inInfo, vtkInformation* outInfo)
@@ -215,11 +248,9 @@ int vtkStreamingParticlesRepresentation::ProcessViewRequest(
       {
         piece->GetFieldData()->RemoveArray(BLOCKS_TO_PURGE_ARRAY_NAME);
         vtkMultiBlockDataSet* data = vtkMultiBlockDataSet::SafeDownCast(this->RenderedData);
-        std::set<unsigned int> blocksToPurge;
-        for (int i = 0; i < array->GetNumberOfTuples(); ++i)
-        {
-          blocksToPurge.insert(array->GetValue(i));
-        }
+        std::vector<unsigned int> blocksToPurge(
+          array->GetPointer(0), array->GetPointer(0) + array->GetNumberOfTuples());
+        std::sort(blocksToPurge.begin(), blocksToPurge.end());
         purge_blocks(data, blocksToPurge);
       }
 
@@ -403,7 +434,7 @@ bool vtkStreamingParticlesRepresentation::StreamingUpdate(const double view_plan
   {
     // purge blocks that no longer have sufficient coverage in the new
     // view-frustum.
-    const std::set<unsigned int>& blocksToPurge = this->PriorityQueue->GetBlocksToPurge();
+    const std::vector<unsigned int>& blocksToPurge = this->PriorityQueue->GetBlocksToPurge();
 
     vtkMultiBlockDataSet* data = vtkMultiBlockDataSet::SafeDownCast(this->RenderedData);
 
@@ -419,16 +450,11 @@ bool vtkStreamingParticlesRepresentation::StreamingUpdate(const double view_plan
     }
   }
 
-  const std::set<unsigned int>& toPurge = this->PriorityQueue->GetBlocksToPurge();
+  const std::vector<unsigned int>& toPurge = this->PriorityQueue->GetBlocksToPurge();
   vtkSmartPointer<vtkUnsignedIntArray> localPurgeArray =
     vtkSmartPointer<vtkUnsignedIntArray>::New();
   localPurgeArray->SetNumberOfTuples(toPurge.size());
-  int i = 0;
-  for (std::set<unsigned int>::const_iterator itr = toPurge.begin(); itr != toPurge.end();
-       ++itr, ++i)
-  {
-    localPurgeArray->SetValue(i, *itr);
-  }
+  std::copy(toPurge.begin(), toPurge.end(), localPurgeArray->GetPointer(0));
   vtkMultiProcessController* controller = vtkMultiProcessController::GetGlobalController();
   vtkSmartPointer<vtkUnsignedIntArray> globalPurgeArray =
     vtkSmartPointer<vtkUnsignedIntArray>::New();
@@ -436,8 +462,10 @@ bool vtkStreamingParticlesRepresentation::StreamingUpdate(const double view_plan
   globalPurgeArray->SetName(BLOCKS_TO_PURGE_ARRAY_NAME);
 
   int needsToStream = !this->PriorityQueue->IsEmpty();
+  // A deferred camera motion also needs another streaming pass to be applied.
+  int needsAnotherPass = needsToStream || this->PriorityQueue->HasPendingUpdate();
   int allNeedToStream;
-  controller->AllReduce(&needsToStream, &allNeedToStream, 1, vtkCommunicator::LOGICAL_OR_OP);
+  controller->AllReduce(&needsAnotherPass, &allNeedToStream, 1, vtkCommunicator::LOGICAL_OR_OP);
   // If this process doesn't need to fetch another block, return without executing the pipeline
   // The return value should be true if ANY process needs to fetch another block
   if (!needsToStream)
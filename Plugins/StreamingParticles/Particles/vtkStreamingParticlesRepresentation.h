@@ -111,6 +111,20 @@ public:
     void SetDetailLevelToLoad(double level);
   double GetDetailLevelToLoad();
 
+  // Description:
+  // Maximum amount of memory, in MiB, used by the streamed blocks. Least
+  // recently visible blocks are purged to stay within this budget.
+  // 0 means no budget. Defaults to 0.
+  void SetMemoryBudget(double budget);
+  double GetMemoryBudget();
+
+  // Description:
+  // Relative view planes change under which the block priorities are not
+  // recomputed, to avoid thrashing blocks during slow camera motions.
+  // Defaults to 0.
+  void SetCameraMotionTolerance(double tolerance);
+  double GetCameraMotionTolerance();
+
   //---------------------------------------------------------------------------
   // The following API is to simply provide the functionality similar to
   // vtkGeometryRepresentation.
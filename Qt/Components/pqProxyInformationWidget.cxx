@@ -142,6 +142,13 @@ void pqProxyInformationWidget::setOutputPort(pqOutputPort* source)
   {
     QObject::connect(this->OutputPort->getSource(), SIGNAL(dataUpdated(pqPipelineSource*)), this,
       SLOT(updateInformation()));
+
+    // the panel only needs the hierarchy of composite datasets, the details of
+    // a block are gathered when it is selected (see onCurrentChanged).
+    if (vtkSMOutputPort* port = this->OutputPort->getOutputPortProxy())
+    {
+      port->SetSummaryOnly(true);
+    }
   }
 
   this->updateInformation();
@@ -490,12 +497,13 @@ void pqProxyInformationWidget::fillDataInformation(vtkPVDataInformation* dataInf
 //-----------------------------------------------------------------------------
 void pqProxyInformationWidget::onCurrentChanged(const QModelIndex& idx)
 {
-  vtkPVDataInformation* dataInformation =
-    this->OutputPort ? this->OutputPort->getDataInformation() : nullptr;
-  if (dataInformation && idx.isValid())
+  vtkSMOutputPort* port = this->OutputPort ? this->OutputPort->getOutputPortProxy() : nullptr;
+  if (port && idx.isValid())
   {
+    // the tree is built from summarized block information, so pull the
+    // details of the selected block on demand.
     unsigned int cid = this->Ui->compositeTreeModel->compositeIndex(idx);
-    vtkPVDataInformation* info = dataInformation->GetDataInformationForCompositeIndex(cid);
+    vtkPVDataInformation* info = port->GetDataInformationForCompositeIndex(cid);
     this->fillDataInformation(info);
   }
 }
@@ -40,6 +40,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <QLocale>
 #include <QMessageBox>
 #include <QStyle>
+#include <QTimer>
 
 #include <pqApplicationCore.h>
 #include <pqServer.h>
@@ -47,6 +48,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <vtkCollection.h>
 #include <vtkCollectionIterator.h>
 #include <vtkDirectory.h>
+#include <vtkNew.h>
 #include <vtkPVFileInformation.h>
 #include <vtkPVFileInformationHelper.h>
 #include <vtkSMDirectoryProxy.h>
@@ -314,6 +316,9 @@ class pqFileDialogModel::pqImplementation
 public:
   pqImplementation(pqServer* server)
     : Separator(0)
+    , ListingSpecialDirectories(false)
+    , NumberOfListedEntries(0)
+    , TotalNumberOfEntries(0)
     , Server(server)
   {
 
@@ -378,11 +383,24 @@ public:
       pqSMAdaptor::setElementProperty(helper->GetProperty("DirectoryListing"), dirListing);
       pqSMAdaptor::setElementProperty(helper->GetProperty("Path"), path.toUtf8());
       pqSMAdaptor::setElementProperty(helper->GetProperty("SpecialDirectories"), specialDirs);
+      // large directories are fetched in pages to keep each message bounded,
+      // only the first one here, the others when the view needs them.
+      vtkSMPropertyHelper(helper, "ListingOffset").Set(0);
+      vtkSMPropertyHelper(helper, "MaximumListingSize").Set(dirListing ? PageSize : 0);
       helper->UpdateVTKObjects();
 
       // get data from server
       this->FileInformation->Initialize();
       this->FileInformationHelperProxy->GatherInformation(this->FileInformation);
+
+      if (dirListing)
+      {
+        this->ListingWorkingDirectory = workingDir;
+        this->ListingPath = path;
+        this->ListingSpecialDirectories = specialDirs;
+        this->NumberOfListedEntries = this->FileInformation->GetContents()->GetNumberOfItems();
+        this->TotalNumberOfEntries = this->FileInformation->GetTotalNumberOfEntries();
+      }
     }
     else
     {
@@ -392,16 +410,63 @@ public:
       helper->SetSpecialDirectories(specialDirs);
       helper->SetWorkingDirectory(workingDir.toUtf8().data());
       this->FileInformation->CopyFromObject(helper);
+      if (dirListing)
+      {
+        this->NumberOfListedEntries = this->TotalNumberOfEntries = 0;
+      }
     }
     return this->FileInformation;
   }
 
+  /// returns true if the last directory listed has entries left to fetch.
+  bool canFetchMore() const { return this->NumberOfListedEntries < this->TotalNumberOfEntries; }
+
+  /// query the next page of the last directory listed. Returns NULL if the
+  /// directory changed on the server since the previous page, it has to be
+  /// listed again.
+  vtkPVFileInformation* GetNextPage()
+  {
+    vtkSMProxy* helper = this->FileInformationHelperProxy;
+    pqSMAdaptor::setElementProperty(
+      helper->GetProperty("WorkingDirectory"), this->ListingWorkingDirectory.toUtf8());
+    pqSMAdaptor::setElementProperty(helper->GetProperty("DirectoryListing"), true);
+    pqSMAdaptor::setElementProperty(helper->GetProperty("Path"), this->ListingPath.toUtf8());
+    pqSMAdaptor::setElementProperty(
+      helper->GetProperty("SpecialDirectories"), this->ListingSpecialDirectories);
+    vtkSMPropertyHelper(helper, "ListingOffset").Set(this->NumberOfListedEntries);
+    vtkSMPropertyHelper(helper, "MaximumListingSize").Set(PageSize);
+    helper->UpdateVTKObjects();
+
+    this->FileInformation->Initialize();
+    helper->GatherInformation(this->FileInformation);
+    const int count = this->FileInformation->GetContents()->GetNumberOfItems();
+    if (this->FileInformation->GetTotalNumberOfEntries() != this->TotalNumberOfEntries)
+    {
+      this->NumberOfListedEntries = this->TotalNumberOfEntries = 0;
+      return NULL;
+    }
+    // an empty page ends the listing.
+    this->NumberOfListedEntries = count > 0 ? this->NumberOfListedEntries + count
+                                            : this->TotalNumberOfEntries;
+    return this->FileInformation;
+  }
+
   /// put queried information into our model
   void Update(const QString& path, vtkPVFileInformation* dir)
   {
     this->CurrentPath = path;
     this->FileList.clear();
+    // the group children indices point into FileList, it must not be
+    // reallocated when the next pages are appended.
+    this->FileList.reserve(
+      std::max(this->TotalNumberOfEntries, dir->GetContents()->GetNumberOfItems()));
+    this->FileList += this->Convert(dir);
+  }
 
+  /// converts the queried information, directories first then files.
+  QVector<pqFileDialogModelFileInfo> Convert(vtkPVFileInformation* dir)
+  {
+    QVector<pqFileDialogModelFileInfo> result;
     QList<pqFileDialogModelFileInfo> dirs;
     QList<pqFileDialogModelFileInfo> files;
 
@@ -462,12 +527,13 @@ public:
 
     for (int i = 0; i != dirs.size(); ++i)
     {
-      this->FileList.push_back(dirs[i]);
+      result.push_back(dirs[i]);
     }
     for (int i = 0; i != files.size(); ++i)
     {
-      this->FileList.push_back(files[i]);
+      result.push_back(files[i]);
     }
+    return result;
   }
 
   QStringList getFilePaths(const QModelIndex& index)
@@ -530,6 +596,15 @@ public:
   /// Caches information about the set of files within the current path.
   QVector<pqFileDialogModelFileInfo> FileList; // adjacent memory occupation for QModelIndex
 
+  /// Number of entries of a remote directory listing fetched in each request.
+  static const int PageSize = 10000;
+  /// The last directory listed, for fetching its next pages.
+  QString ListingWorkingDirectory;
+  QString ListingPath;
+  bool ListingSpecialDirectories;
+  int NumberOfListedEntries;
+  int TotalNumberOfEntries;
+
   const pqFileDialogModelFileInfo* infoForIndex(const QModelIndex& idx) const
   {
     if (idx.isValid() && NULL == idx.internalPointer() && idx.row() >= 0 &&
@@ -998,6 +1073,38 @@ QModelIndex pqFileDialogModel::parent(const QModelIndex& idx) const
   return this->createIndex(row, idx.column());
 }
 
+bool pqFileDialogModel::canFetchMore(const QModelIndex& idx) const
+{
+  return !idx.isValid() && this->Implementation->canFetchMore();
+}
+
+void pqFileDialogModel::fetchMore(const QModelIndex& idx)
+{
+  if (!this->canFetchMore(idx))
+  {
+    return;
+  }
+
+  vtkPVFileInformation* page = this->Implementation->GetNextPage();
+  if (!page)
+  {
+    // the directory changed since the first page was fetched, list it again
+    // once the view is done with the current request.
+    QTimer::singleShot(0, this, [this]() { this->setCurrentPath(this->getCurrentPath()); });
+    return;
+  }
+
+  QVector<pqFileDialogModelFileInfo> entries = this->Implementation->Convert(page);
+  if (entries.isEmpty())
+  {
+    return;
+  }
+  const int first = this->Implementation->FileList.size();
+  this->beginInsertRows(QModelIndex(), first, first + entries.size() - 1);
+  this->Implementation->FileList += entries;
+  this->endInsertRows();
+}
+
 int pqFileDialogModel::rowCount(const QModelIndex& idx) const
 {
   if (!idx.isValid())
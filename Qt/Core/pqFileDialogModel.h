@@ -164,6 +164,15 @@ public:
   */
   QModelIndex parent(const QModelIndex&) const override;
   /**
+  * return whether more rows of a remote directory listing can be fetched,
+  * large directories are listed in pages
+  */
+  bool canFetchMore(const QModelIndex&) const override;
+  /**
+  * fetch the next page of a remote directory listing
+  */
+  void fetchMore(const QModelIndex&) override;
+  /**
   * return the number of rows under a given index
   */
   int rowCount(const QModelIndex&) const override;
@@ -25,6 +25,18 @@ FunctionInfo* wrappedFunctions[1000];
 extern FunctionInfo* currentFunction;
 HierarchyInfo* hierarchyInfo = NULL;
 
+/* FNV-1a hash of a method name, must match
+   vtkClientServerInterpreter::HashMethodName() */
+static unsigned int hash_method_name(const char* name)
+{
+  unsigned long hash = 2166136261ul;
+  for (; name && *name; ++name)
+  {
+    hash = ((hash ^ (unsigned char)*name) * 16777619ul) & 0xfffffffful;
+  }
+  return (unsigned int)hash;
+}
+
 /* make a guess about whether a class is wrapped */
 static int class_is_wrapped(const char* classname)
 {
@@ -1200,6 +1212,8 @@ int main(int argc, char* argv[])
   FILE* fp;
   NewClassInfo* classData;
   int i, j;
+  int* functionDone;
+  unsigned int methodHash;
 
   /* pre-define a macro to identify the language */
   vtkParse_DefineMacro("__VTK_WRAP_CLIENTSERVER__", 0);
@@ -1399,12 +1413,36 @@ int main(int argc, char* argv[])
 
   /*fprintf(fp,"  vtkClientServerStream resultStream;\n");*/
 
-  /* insert function handling code here */
+  /* insert function handling code here, grouped by the hash of the method
+     name so that only the methods with a matching hash are compared.
+     Overloads keep their declaration order within a group. */
+  fprintf(fp, "  switch (vtkClientServerInterpreter::HashMethodName(method))\n"
+              "  {\n");
+  functionDone = (int*)calloc(data->NumberOfFunctions + 1, sizeof(int));
   for (i = 0; i < data->NumberOfFunctions; i++)
   {
-    currentFunction = data->Functions[i];
-    outputFunction(fp, data);
+    if (functionDone[i] || notWrappable(data->Functions[i]))
+    {
+      continue;
+    }
+    methodHash = hash_method_name(data->Functions[i]->Name);
+    fprintf(fp, "  case %uu:\n", methodHash);
+    for (j = i; j < data->NumberOfFunctions; j++)
+    {
+      if (!functionDone[j] && !notWrappable(data->Functions[j]) &&
+        hash_method_name(data->Functions[j]->Name) == methodHash)
+      {
+        functionDone[j] = 1;
+        currentFunction = data->Functions[j];
+        outputFunction(fp, data);
+      }
+    }
+    fprintf(fp, "    break;\n");
   }
+  free(functionDone);
+  fprintf(fp, "  default:\n"
+              "    break;\n"
+              "  }\n");
 
   /* try superclasses */
   for (i = 0; i < data->NumberOfSuperClasses; i++)
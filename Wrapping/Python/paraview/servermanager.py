@@ -2009,6 +2009,20 @@ class Connection(object):
            connection"""
         return self.Session.GetServerInformation().GetNumberOfProcesses()
 
+    def BatchPushes(self):
+        """Returns a context manager that coalesces the state pushed to the
+        server while the block executes. The pushes are sent in order, as a
+        single message, when the block exits or as soon as another request
+        needs to reach the server. Blocks can be nested.
+
+        Usage::
+
+          with connection.BatchPushes():
+              for source in sources:
+                  source.UpdateVTKObjects()
+        """
+        return _PushBatch(self.Session)
+
     def AttachDefinitionUpdater(self):
         """Attach observer to automatically update modules when needed."""
         dfnMgr = self.Session.GetProxyDefinitionManager()
@@ -2030,6 +2044,19 @@ class Connection(object):
         if self.Alive:
            self.close()
 
+class _PushBatch(object):
+    """Context manager returned by Connection.BatchPushes()."""
+    def __init__(self, session):
+        self.Session = session
+
+    def __enter__(self):
+        self.Session.BeginPushBatch()
+        return self
+
+    def __exit__(self, *args):
+        self.Session.EndPushBatch()
+        return False
+
 def SaveState(filename):
     """Given a state filename, saves the state of objects registered
     with the proxy manager."""
@@ -1225,6 +1225,13 @@ def SaveAnimation(filename, viewOrLayout=None, scene=None, **params):
           To save a part of the animation, provide the range in frames or
           timesteps index.
 
+        FrameQueueDepth (int)
+          Number of rendered frames that can wait to be written, defaults to 0.
+          When positive, frames are encoded and written on a separate thread
+          while the next ones are rendered, e.g. `FrameQueueDepth=2`. This is
+          not exposed in the GUI, scripts run with `pvbatch` or `pvpython` can
+          opt in with this parameter.
+
     In addition, several format-specific keyword parameters can be specified.
     The format is chosen based on the file extension.
 